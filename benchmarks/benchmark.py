@@ -0,0 +1,580 @@
+"""Benchmarks for the descriptors of DScribe.
+
+The benchmarks are run on representative workloads: small molecules, bulk
+periodic cells, large slabs and MD trajectories. They are measured on two
+levels:
+
+- kernel: Calls into the C++ extension with preprocessed input. Tracks the
+  performance of the native kernels without the Python input handling.
+- end-to-end: The public Python API, as used in applications.
+
+Each benchmark is run in a separate process so that its peak memory can be
+measured. The throughput and the peak memory are printed, and can be stored as
+JSON and compared against earlier results to find regressions:
+
+    python benchmark.py --output baseline.json
+    python benchmark.py --compare baseline.json
+
+With --profile the time per phase and the counters collected by the C++
+extension are reported as well, see dscribe.ext.get_profiling_stats.
+"""
+import argparse
+import concurrent.futures
+import json
+import multiprocessing
+import platform
+import resource
+import sys
+import time
+from datetime import datetime, timezone
+
+import ase.geometry
+import numpy as np
+
+import dscribe.ext
+from dscribe.descriptors import ACSF, MBTR, SOAP, CoulombMatrix
+
+from workloads import get_workload
+
+BENCHMARKS = {}
+
+
+def benchmark(name, workloads):
+    """Registers a benchmark for the given workloads. The decorated function
+    receives the structures of a workload and returns a function that runs the
+    benchmark once, and the number of centers it calculates.
+    """
+
+    def register(setup):
+        for workload in workloads:
+            BENCHMARKS[f"{name}/{workload}"] = (workload, setup)
+        return setup
+
+    return register
+
+
+def get_species(systems):
+    return sorted({number for system in systems for number in system.numbers})
+
+
+def is_periodic(systems):
+    return any(system.pbc.any() for system in systems)
+
+
+def get_soap(systems, rbf, **kwargs):
+    return SOAP(
+        r_cut=5.0,
+        n_max=8,
+        l_max=6,
+        sigma=0.5,
+        rbf=rbf,
+        species=get_species(systems),
+        periodic=is_periodic(systems),
+        **kwargs,
+    )
+
+
+def get_mbtr(systems, k):
+    species = get_species(systems)
+    if k == 1:
+        geometry = {"function": "atomic_number"}
+        grid = {"min": 0, "max": max(species) + 1, "n": 100, "sigma": 0.1}
+        weighting = {"function": "unity"}
+    elif k == 2:
+        geometry = {"function": "inverse_distance"}
+        grid = {"min": 0, "max": 1, "n": 100, "sigma": 0.02}
+        weighting = {"function": "exp", "scale": 0.5, "threshold": 1e-3}
+    else:
+        geometry = {"function": "cosine"}
+        grid = {"min": -1, "max": 1, "n": 100, "sigma": 0.02}
+        weighting = {"function": "exp", "scale": 0.5, "threshold": 1e-3}
+    return MBTR(
+        species=species,
+        geometry=geometry,
+        grid=grid,
+        weighting=weighting,
+        periodic=is_periodic(systems),
+    )
+
+
+def get_acsf(systems):
+    return ACSF(
+        r_cut=6.0,
+        g2_params=[[1, 1], [1, 2], [1, 3]],
+        g4_params=[[1, 1, 1], [1, 2, 1], [1, 1, -1], [1, 2, -1]],
+        species=get_species(systems),
+        periodic=is_periodic(systems),
+    )
+
+
+def get_derivative_centers(systems, n_max=4):
+    """The derivatives of large systems are calculated only for a few centers
+    to keep the size of the output reasonable.
+    """
+    return [list(range(min(len(system), n_max))) for system in systems]
+
+
+def n_atoms(systems):
+    return sum(len(system) for system in systems)
+
+
+# Kernel level
+@benchmark("kernel/celllist", ["bulk", "slab"])
+def celllist(systems):
+    inputs = [
+        (
+            system.get_positions(),
+            ase.geometry.cell.complete_cell(system.get_cell()),
+            np.asarray(system.get_pbc(), dtype=bool),
+        )
+        for system in systems
+    ]
+
+    def run():
+        for pos, cell, pbc in inputs:
+            cell_list = dscribe.ext.CellList(pos, 5.0, cell, pbc)
+            for i in range(len(pos)):
+                cell_list.get_neighbours_for_index(i)
+
+    return run, n_atoms(systems)
+
+
+def soap_kernel(systems, rbf):
+    soap = get_soap(systems, rbf)
+    extension = soap.get_extension()
+    inputs = []
+    for system in systems:
+        centers, _ = soap.prepare_centers(system)
+        inputs.append(
+            (
+                soap.init_descriptor_array(len(centers), soap.get_native_dtype()),
+                system.get_positions(),
+                system.get_atomic_numbers(),
+                ase.geometry.cell.complete_cell(system.get_cell()),
+                np.asarray(system.get_pbc(), dtype=bool),
+                centers,
+            )
+        )
+
+    def run():
+        for out, *args in inputs:
+            out.fill(0)
+            extension.create(out, *args)
+
+    return run, n_atoms(systems)
+
+
+@benchmark("kernel/soap_gto", ["molecules", "bulk", "slab"])
+def soap_gto_kernel(systems):
+    return soap_kernel(systems, "gto")
+
+
+@benchmark("kernel/soap_polynomial", ["molecules", "bulk", "slab"])
+def soap_polynomial_kernel(systems):
+    return soap_kernel(systems, "polynomial")
+
+
+def soap_derivatives_kernel(systems, rbf, method):
+    soap = get_soap(systems, rbf)
+    inputs = []
+    for system, centers in zip(systems, get_derivative_centers(systems)):
+        indices = np.arange(len(system))
+        dtype = soap.get_native_dtype(method)
+        c = soap.init_descriptor_array(len(centers), dtype)
+        d = soap.init_derivatives_array(len(centers), len(indices), dtype)
+        inputs.append((d, c, system, centers, indices))
+
+    def run():
+        for d, c, system, centers, indices in inputs:
+            d.fill(0)
+            c.fill(0)
+            if method == "analytical":
+                soap.derivatives_analytical(d, c, system, centers, indices, False)
+            else:
+                soap.derivatives_numerical(d, c, system, centers, indices, False)
+
+    return run, sum(len(centers) for _, _, _, centers, _ in inputs)
+
+
+@benchmark("kernel/soap_gto_derivatives", ["molecules", "bulk"])
+def soap_gto_derivatives_kernel(systems):
+    return soap_derivatives_kernel(systems, "gto", "analytical")
+
+
+@benchmark("kernel/soap_polynomial_derivatives", ["molecules", "bulk"])
+def soap_polynomial_derivatives_kernel(systems):
+    return soap_derivatives_kernel(systems, "polynomial", "analytical")
+
+
+@benchmark("kernel/soap_gto_numerical_derivatives", ["molecules"])
+def soap_gto_numerical_derivatives_kernel(systems):
+    return soap_derivatives_kernel(systems, "gto", "numerical")
+
+
+def mbtr_kernel(systems, k, derivatives):
+    mbtr = get_mbtr(systems, k)
+    get_k = getattr(mbtr, f"_get_k{k}")
+
+    def run():
+        for system in systems:
+            mbtr.system = system
+            mbtr._interaction_limit = len(system)
+            get_k(system, True, derivatives)
+
+    return run, n_atoms(systems)
+
+
+for k in (1, 2, 3):
+    benchmark(f"kernel/mbtr_k{k}", ["molecules", "bulk"])(
+        lambda systems, k=k: mbtr_kernel(systems, k, False)
+    )
+    benchmark(f"kernel/mbtr_k{k}_derivatives", ["molecules"])(
+        lambda systems, k=k: mbtr_kernel(systems, k, True)
+    )
+
+
+@benchmark("kernel/acsf", ["molecules", "bulk", "slab"])
+def acsf_kernel(systems):
+    acsf = get_acsf(systems)
+    inputs = []
+    for system in systems:
+        output = np.zeros((len(system), acsf.get_number_of_features()))
+        inputs.append((output, acsf.get_system_arrays(system), np.arange(len(system))))
+
+    def run():
+        for output, arrays, indices in inputs:
+            output.fill(0)
+            acsf.acsf_wrapper.create(output, *arrays, indices)
+
+    return run, n_atoms(systems)
+
+
+@benchmark("kernel/acsf_derivatives", ["molecules", "bulk"])
+def acsf_derivatives_kernel(systems):
+    acsf = get_acsf(systems)
+    inputs = []
+    for system, centers in zip(systems, get_derivative_centers(systems)):
+        indices = np.arange(len(system))
+        c = acsf.init_descriptor_array(len(centers))
+        d = acsf.init_derivatives_array(len(centers), len(indices))
+        inputs.append((d, c, system, centers, indices))
+
+    def run():
+        for d, c, system, centers, indices in inputs:
+            d.fill(0)
+            c.fill(0)
+            acsf.derivatives_analytical(d, c, system, centers, indices, False)
+
+    return run, sum(len(centers) for _, _, _, centers, _ in inputs)
+
+
+@benchmark("kernel/cm", ["molecules"])
+def cm_kernel(systems):
+    cm = CoulombMatrix(n_atoms_max=max(len(system) for system in systems))
+    inputs = [
+        (
+            np.zeros(cm.get_number_of_features()),
+            system.get_positions(),
+            system.get_atomic_numbers(),
+            system.get_cell(),
+            system.get_pbc(),
+        )
+        for system in systems
+    ]
+
+    def run():
+        for out, *args in inputs:
+            out.fill(0)
+            cm.wrapper.create(out, *args)
+
+    return run, n_atoms(systems)
+
+
+# End-to-end level
+@benchmark("end-to-end/soap_gto", ["molecules", "bulk", "slab", "trajectory"])
+def soap_gto(systems):
+    soap = get_soap(systems, "gto")
+    return lambda: soap.create(systems), n_atoms(systems)
+
+
+@benchmark("end-to-end/soap_gto_batch", ["molecules", "bulk"])
+def soap_gto_batch(systems):
+    soap = get_soap(systems, "gto")
+    return lambda: soap.create_batch(systems), n_atoms(systems)
+
+
+@benchmark("end-to-end/soap_gto_trajectory", ["trajectory"])
+def soap_gto_trajectory(systems):
+    soap = get_soap(systems, "gto")
+    return lambda: soap.create_trajectory(systems), n_atoms(systems)
+
+
+@benchmark("end-to-end/soap_gto_float32", ["molecules", "bulk"])
+def soap_gto_float32(systems):
+    soap = get_soap(systems, "gto", dtype="float32")
+    return lambda: soap.create(systems), n_atoms(systems)
+
+
+@benchmark("end-to-end/soap_polynomial", ["molecules", "bulk", "slab"])
+def soap_polynomial(systems):
+    soap = get_soap(systems, "polynomial")
+    return lambda: soap.create(systems), n_atoms(systems)
+
+
+def soap_derivatives(systems, rbf):
+    soap = get_soap(systems, rbf)
+    centers = get_derivative_centers(systems)
+
+    def run():
+        soap.derivatives(systems, centers=centers, method="auto")
+
+    return run, sum(len(c) for c in centers)
+
+
+@benchmark("end-to-end/soap_gto_derivatives", ["molecules", "bulk"])
+def soap_gto_derivatives(systems):
+    return soap_derivatives(systems, "gto")
+
+
+@benchmark("end-to-end/soap_polynomial_derivatives", ["molecules", "bulk"])
+def soap_polynomial_derivatives(systems):
+    return soap_derivatives(systems, "polynomial")
+
+
+def mbtr(systems, k, derivatives):
+    mbtr = get_mbtr(systems, k)
+    function = mbtr.derivatives if derivatives else mbtr.create
+    return lambda: function(systems), n_atoms(systems)
+
+
+for k in (1, 2, 3):
+    benchmark(f"end-to-end/mbtr_k{k}", ["molecules", "bulk"])(
+        lambda systems, k=k: mbtr(systems, k, False)
+    )
+    benchmark(f"end-to-end/mbtr_k{k}_derivatives", ["molecules"])(
+        lambda systems, k=k: mbtr(systems, k, True)
+    )
+
+
+@benchmark("end-to-end/acsf", ["molecules", "bulk", "slab"])
+def acsf(systems):
+    acsf = get_acsf(systems)
+    return lambda: acsf.create(systems), n_atoms(systems)
+
+
+@benchmark("end-to-end/acsf_derivatives", ["molecules", "bulk"])
+def acsf_derivatives(systems):
+    acsf = get_acsf(systems)
+    centers = get_derivative_centers(systems)
+
+    def run():
+        acsf.derivatives(systems, centers=centers)
+
+    return run, sum(len(c) for c in centers)
+
+
+@benchmark("end-to-end/cm", ["molecules"])
+def cm(systems):
+    cm = CoulombMatrix(n_atoms_max=max(len(system) for system in systems))
+    return lambda: cm.create(systems), n_atoms(systems)
+
+
+@benchmark("end-to-end/cm_derivatives", ["molecules"])
+def cm_derivatives(systems):
+    cm = CoulombMatrix(n_atoms_max=max(len(system) for system in systems))
+    return lambda: cm.derivatives(systems), n_atoms(systems)
+
+
+def get_peak_memory():
+    """Returns the peak resident memory of the process in MiB."""
+    peak = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # The peak is reported in bytes on macOS and in kilobytes elsewhere.
+    if sys.platform == "darwin":
+        return peak / 1024**2
+    return peak / 1024
+
+
+def run_benchmark(name, repeat, quick, n_threads, profile):
+    """Runs a single benchmark. Called in a separate process."""
+    if n_threads is not None:
+        dscribe.ext.set_num_threads(n_threads)
+    workload, setup = BENCHMARKS[name]
+    systems = get_workload(workload, quick)
+    run, n_centers = setup(systems)
+
+    # The peak memory already reached during the setup is not counted for the
+    # benchmark, and the first call warms up the caches.
+    baseline_memory = get_peak_memory()
+    run()
+    dscribe.ext.set_profiling(profile)
+    times = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        run()
+        times.append(time.perf_counter() - start)
+    peak_memory = get_peak_memory()
+    dscribe.ext.set_profiling(False)
+
+    best = min(times)
+    return {
+        "name": name,
+        "workload": workload,
+        "n_structures": len(systems),
+        "n_centers": n_centers,
+        "time": best,
+        "times": times,
+        "structures_per_second": len(systems) / best,
+        "centers_per_second": n_centers / best,
+        "peak_memory": peak_memory,
+        "memory_increase": peak_memory - baseline_memory,
+        "profile": dscribe.ext.get_profiling_stats() if profile else None,
+    }
+
+
+def print_profile(profile, n_runs):
+    """Prints the time per phase and the counters of each descriptor class,
+    averaged over the timed runs.
+    """
+    for descriptor, stats in profile.items():
+        for phase, phase_stats in stats["phases"].items():
+            time_per_run = phase_stats["time"] / n_runs
+            print(f"    {descriptor}.{phase:<30} {time_per_run:>10.4f} s")
+        for counter, value in stats["counters"].items():
+            print(f"    {descriptor}.{counter:<30} {value / n_runs:>12.0f}")
+
+
+def get_metadata(args):
+    try:
+        from importlib.metadata import version
+
+        dscribe_version = version("dscribe")
+    except Exception:
+        dscribe_version = "unknown"
+    return {
+        "dscribe": dscribe_version,
+        "python": platform.python_version(),
+        "numpy": np.__version__,
+        "platform": platform.platform(),
+        "processor": platform.processor(),
+        "cpu_count": multiprocessing.cpu_count(),
+        "threads": args.threads,
+        "quick": args.quick,
+        "repeat": args.repeat,
+        "profile": args.profile,
+        "date": datetime.now(timezone.utc).isoformat(),
+    }
+
+
+def compare(results, baseline, threshold):
+    """Prints the relative change against the baseline results. Returns the
+    names of the benchmarks that have regressed by more than the threshold in
+    either the time or the peak memory.
+    """
+    baseline = {result["name"]: result for result in baseline["results"]}
+    regressions = []
+    print()
+    print(f"{'benchmark':<52} {'time':>8} {'memory':>8}")
+    for result in results:
+        old = baseline.get(result["name"])
+        if old is None:
+            continue
+        time_ratio = result["time"] / old["time"]
+        memory_ratio = result["memory_increase"] / max(old["memory_increase"], 1)
+        regressed = time_ratio > 1 + threshold or memory_ratio > 1 + threshold
+        if regressed:
+            regressions.append(result["name"])
+        print(
+            f"{result['name']:<52} {time_ratio:>7.2f}x {memory_ratio:>7.2f}x"
+            f"{'  REGRESSION' if regressed else ''}"
+        )
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument(
+        "--level",
+        choices=["kernel", "end-to-end", "all"],
+        default="all",
+        help="The level of the benchmarks to run.",
+    )
+    parser.add_argument(
+        "--filter",
+        nargs="+",
+        default=[],
+        help="Only run the benchmarks whose name contains one of these strings.",
+    )
+    parser.add_argument(
+        "--repeat", type=int, default=5, help="Number of timed runs per benchmark."
+    )
+    parser.add_argument(
+        "--quick",
+        action="store_true",
+        help="Use small workloads, e.g. to check that the benchmarks run.",
+    )
+    parser.add_argument(
+        "--threads", type=int, default=None, help="Number of native threads."
+    )
+    parser.add_argument("--output", help="Store the results as JSON in this file.")
+    parser.add_argument("--compare", help="JSON file with baseline results.")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.1,
+        help="Relative slowdown or memory increase that counts as a regression.",
+    )
+    parser.add_argument(
+        "--profile",
+        action="store_true",
+        help="Collect the time per phase and the counters of the C++ extension "
+        "during the timed runs. Adds some overhead to the timings.",
+    )
+    parser.add_argument("--list", action="store_true", help="List the benchmarks.")
+    args = parser.parse_args()
+
+    names = [
+        name
+        for name in BENCHMARKS
+        if (args.level == "all" or name.startswith(f"{args.level}/"))
+        and (not args.filter or any(pattern in name for pattern in args.filter))
+    ]
+    if args.list:
+        for name in names:
+            print(name)
+        return 0
+
+    print(f"{'benchmark':<52} {'time (s)':>10} {'structures/s':>13} ", end="")
+    print(f"{'centers/s':>12} {'peak (MiB)':>11} {'increase':>9}")
+    results = []
+    context = multiprocessing.get_context("spawn")
+    for name in names:
+        with concurrent.futures.ProcessPoolExecutor(1, mp_context=context) as pool:
+            result = pool.submit(
+                run_benchmark, name, args.repeat, args.quick, args.threads, args.profile
+            ).result()
+        results.append(result)
+        print(
+            f"{name:<52} {result['time']:>10.4f} "
+            f"{result['structures_per_second']:>13.1f} "
+            f"{result['centers_per_second']:>12.1f} "
+            f"{result['peak_memory']:>11.1f} {result['memory_increase']:>9.1f}"
+        )
+        if args.profile:
+            print_profile(result["profile"], len(result["times"]))
+
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump({"metadata": get_metadata(args), "results": results}, f, indent=2)
+
+    if args.compare:
+        with open(args.compare) as f:
+            baseline = json.load(f)
+        regressions = compare(results, baseline, args.threshold)
+        if regressions:
+            print(f"\n{len(regressions)} benchmark(s) regressed.")
+            return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
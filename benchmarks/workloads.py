@@ -0,0 +1,77 @@
+"""Representative atomic structures for the benchmarks.
+
+The workloads are generated deterministically, so that results from different
+runs and different versions can be compared with each other.
+"""
+import numpy as np
+from ase.build import add_adsorbate, bulk, fcc111, molecule
+
+MOLECULES = ["H2O", "NH3", "CH4", "CH3OH", "C6H6", "CH3CH2OH", "CH3CONH2", "HCOOH"]
+
+
+def get_molecules(n_structures=200, seed=0):
+    """Small finite molecules with slightly perturbed geometries."""
+    systems = []
+    for i in range(n_structures):
+        system = molecule(MOLECULES[i % len(MOLECULES)])
+        system.rattle(0.05, seed=seed + i)
+        systems.append(system)
+    return systems
+
+
+def get_bulk(n_structures=8, size=3, seed=0):
+    """Periodic NaCl rocksalt supercells with thermal noise."""
+    base = bulk("NaCl", "rocksalt", a=5.64, cubic=True) * (size, size, size)
+    systems = []
+    for i in range(n_structures):
+        system = base.copy()
+        system.rattle(0.1, seed=seed + i)
+        systems.append(system)
+    return systems
+
+
+def get_slab(n_structures=2, size=(12, 12, 6), seed=0):
+    """Cu(111) slabs with a row of oxygen adsorbates, periodic in the surface
+    plane.
+    """
+    base = fcc111("Cu", size=size, vacuum=10.0)
+    for i in range(size[0] // 2):
+        add_adsorbate(base, "O", 1.2, "fcc", offset=(2 * i, 2 * i))
+    systems = []
+    for i in range(n_structures):
+        system = base.copy()
+        system.rattle(0.05, seed=seed + i)
+        systems.append(system)
+    return systems
+
+
+def get_trajectory(n_frames=100, size=2, step=0.02, seed=0):
+    """Consecutive frames of a random walk in a periodic silicon cell. Mimics
+    an MD trajectory where the atoms move only little between the frames.
+    """
+    base = bulk("Si", "diamond", a=5.43, cubic=True) * (size, size, size)
+    rng = np.random.default_rng(seed)
+    positions = base.get_positions()
+    frames = []
+    for _ in range(n_frames):
+        positions = positions + rng.normal(scale=step, size=positions.shape)
+        frame = base.copy()
+        frame.set_positions(positions)
+        frame.wrap()
+        frames.append(frame)
+    return frames
+
+
+# The arguments of the workloads for the full and the quick runs.
+WORKLOADS = {
+    "molecules": (get_molecules, {}, {"n_structures": 16}),
+    "bulk": (get_bulk, {}, {"n_structures": 2, "size": 2}),
+    "slab": (get_slab, {}, {"n_structures": 1, "size": (6, 6, 4)}),
+    "trajectory": (get_trajectory, {}, {"n_frames": 10}),
+}
+
+
+def get_workload(name, quick=False):
+    """Returns the structures of the workload with the given name."""
+    function, kwargs, quick_kwargs = WORKLOADS[name]
+    return function(**(quick_kwargs if quick else kwargs))
@@ -13,16 +13,13 @@ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 See the License for the specific language governing permissions and
 limitations under the License.
 """
-import sys
 
 import numpy as np
 import sparse as sp
-from scipy.sparse import coo_matrix
 from ase import Atoms
 
 from dscribe.descriptors.descriptorlocal import DescriptorLocal
 from dscribe.ext import ACSFWrapper
-import dscribe.utils.geometry
 
 
 class ACSF(DescriptorLocal):
@@ -89,7 +86,13 @@ class ACSF(DescriptorLocal):
         self.r_cut = r_cut
 
     def create(
-        self, system, centers=None, n_jobs=1, only_physical_cores=False, verbose=False
+        self,
+        system,
+        centers=None,
+        n_jobs=1,
+        only_physical_cores=False,
+        verbose=False,
+        out=None,
     ):
         """Return the ACSF output for the given systems and given centers.
 
@@ -113,6 +116,12 @@ class ACSF(DescriptorLocal):
                 are counted.  If set to True, only physical CPUs are counted.
             verbose(bool): Controls whether to print the progress of each job
                 into to the console.
+            out (array-like): Preallocated array, e.g. a np.memmap, into
+                which the output of multiple systems is written by the jobs
+                as it is created. It must have the shape of the returned
+                array and requires dense output with the same shape for every
+                system. With process parallelization only memory mapped
+                arrays are shared with the processes.
 
         Returns:
             np.ndarray | sparse.COO: The ACSF output for the given
@@ -169,6 +178,7 @@ class ACSF(DescriptorLocal):
             static_size,
             only_physical_cores,
             verbose=verbose,
+            out=out,
         )
 
         return output
@@ -187,96 +197,98 @@ class ACSF(DescriptorLocal):
             first dimension is given by the number of centers and the second
             dimension is determined by the get_number_of_features()-function.
         """
-        # Check if there are types that have not been declared
-        self.check_atomic_numbers(system.get_atomic_numbers())
-
         # Create C-compatible list of atomic indices for which the ACSF is
         # calculated
-        calculate_all = False
         if centers is None:
-            calculate_all = True
             indices = np.arange(len(system))
         else:
-            indices = centers
-
-        # If periodicity is not requested, and the output is requested for all
-        # atoms, we skip all the intricate optimizations that will make things
-        # actually slower for this case.
-        if calculate_all and not self.periodic:
-            n_atoms = len(system)
-            all_pos = system.get_positions()
-            dmat = dscribe.utils.geometry.get_adjacency_matrix(
-                self.r_cut, all_pos, all_pos
-            )
-        # Otherwise the amount of pairwise distances that are calculated is
-        # kept at minimum. Only distances for the given indices (and possibly
-        # the secondary neighbours if G4 is specified) are calculated.
-        else:
-            # Create the extended system if periodicity is requested. For ACSF only
-            # the distance from central atom needs to be considered in extending
-            # the system.
-            if self.periodic:
-                system = dscribe.utils.geometry.get_extended_system(
-                    system, self.r_cut, return_cell_indices=False
-                )
-
-            # First calculate distances from specified centers to all other
-            # atoms. This is already enough for everything else except G4.
-            n_atoms = len(system)
-            all_pos = system.get_positions()
-            central_pos = all_pos[indices]
-            dmat_primary = dscribe.utils.geometry.get_adjacency_matrix(
-                self.r_cut, central_pos, all_pos
-            )
+            indices = np.asarray(centers, dtype=int)
 
-            # Create symmetric full matrix
-            col = dmat_primary.col
-            row = [
-                indices[x] for x in dmat_primary.row
-            ]  # Fix row numbering to refer to original system
-            data = dmat_primary.data
-            dmat = coo_matrix((data, (row, col)), shape=(n_atoms, n_atoms))
-            dmat_lil = dmat.tolil()
-            dmat_lil[col, row] = dmat_lil[row, col]
-
-            # If G4 terms are requested, calculate also secondary neighbour distances
-            if len(self.g4_params) != 0:
-                neighbour_indices = np.unique(col)
-                neigh_pos = all_pos[neighbour_indices]
-                dmat_secondary = dscribe.utils.geometry.get_adjacency_matrix(
-                    self.r_cut, neigh_pos, neigh_pos
-                )
-                col = [
-                    neighbour_indices[x] for x in dmat_secondary.col
-                ]  # Fix col numbering to refer to original system
-                row = [
-                    neighbour_indices[x] for x in dmat_secondary.row
-                ]  # Fix row numbering to refer to original system
-                dmat_lil[row, col] = np.array(dmat_secondary.data)
-
-            dmat = dmat_lil.tocoo()
-
-        # Get adjancency list and full dense adjancency matrix
-        neighbours = dscribe.utils.geometry.get_adjacency_list(dmat)
-        dmat_dense = np.full(
-            (n_atoms, n_atoms), sys.float_info.max
-        )  # The non-neighbor values are treated as "infinitely far".
-        dmat_dense[dmat.col, dmat.row] = dmat.data
-
-        # Calculate ACSF with C++
-        output = np.array(
-            self.acsf_wrapper.create(
-                system.get_positions(),
-                system.get_atomic_numbers(),
-                dmat_dense,
-                neighbours,
-                indices,
-            ),
-            dtype=np.float64,
+        # Calculate ACSF with C++. The periodic images are handled by the
+        # neighbour search, so no extended system is created here.
+        output = np.zeros(
+            (len(indices), self.get_number_of_features()), dtype=np.float64
         )
+        self.acsf_wrapper.create(output, *self.get_system_arrays(system), indices)
 
         return output
 
+    def get_system_arrays(self, system):
+        """Validates the given system and returns the positions, atomic
+        numbers, cell and periodic boundary conditions that are passed to the
+        C++ extension.
+
+        Args:
+            system (:class:`ase.Atoms`): Input system.
+
+        Returns:
+            tuple: The positions, atomic numbers, cell and periodic boundary
+            conditions as numpy arrays.
+        """
+        # Check if there are types that have not been declared
+        self.check_atomic_numbers(system.get_atomic_numbers())
+
+        # Check if periodic is valid
+        if self.periodic:
+            cell = system.get_cell()
+            if np.cross(cell[0], cell[1]).dot(cell[2]) == 0:
+                raise ValueError("System doesn't have cell to justify periodicity.")
+
+        return (
+            system.get_positions(),
+            system.get_atomic_numbers(),
+            np.asarray(system.get_cell()),
+            system.get_pbc() if self.periodic else np.zeros(3, dtype=bool),
+        )
+
+    def derivatives_analytical(
+        self,
+        d,
+        c,
+        system,
+        centers,
+        indices,
+        attach,
+        return_descriptor=True,
+    ):
+        """Return the analytical derivatives for the given system. The
+        symmetry functions and their derivatives are calculated in the same
+        pass over the neighbours and triplets.
+
+        Args:
+            d (np.ndarray | None): Array for the derivatives. If None, the
+                derivatives are created in the sparse format and returned.
+            c (np.ndarray): Array for the descriptor.
+            system (:class:`ase.Atoms`): Atomic structure.
+            centers (list): Indices of the atoms around which the ACSF is
+                calculated. If None, all atoms are used.
+            indices (list): Indices of atoms for which the derivatives will be
+                computed for.
+            attach (bool): Must be True, the centers move together with the
+                atoms they are defined by.
+            return_descriptor (bool): Whether to also calculate the descriptor
+                in the same function call.
+        """
+        if centers is None:
+            centers = np.arange(len(system))
+        else:
+            centers = np.asarray(centers, dtype=int)
+        indices = np.asarray(indices, dtype=int)
+        arrays = self.get_system_arrays(system)
+
+        # Sparse derivatives only store the atoms within the cutoff of each
+        # center and need no dense intermediate arrays.
+        if d is None:
+            coords, data = self.acsf_wrapper.derivatives_analytical_sparse(
+                c, *arrays, centers, indices, return_descriptor
+            )
+            shape = (len(centers), len(indices), 3, self.get_number_of_features())
+            return sp.COO(coords, data, shape=shape, has_duplicates=False, sorted=True)
+
+        self.acsf_wrapper.derivatives_analytical(
+            d, c, *arrays, centers, indices, return_descriptor
+        )
+
     def get_number_of_features(self):
         """Used to inquire the final number of features that this descriptor
         will have.
@@ -291,11 +303,28 @@ class ACSF(DescriptorLocal):
         return int(descsize)
 
     def validate_derivatives_method(self, method, attach):
+        """Used to validate and determine the final method for calculating the
+        derivatives.
+        """
         if not attach:
             raise ValueError(
                 "ACSF derivatives can only be calculated with attach=True."
             )
-        return super().validate_derivatives_method(method, attach)
+        methods = {"numerical", "analytical", "auto"}
+        if method not in methods:
+            raise ValueError(
+                "Invalid method specified. Please choose from: {}".format(methods)
+            )
+        if method == "auto":
+            method = "analytical"
+        return method
+
+    def has_native_sparse_derivatives(self, method):
+        """The analytical derivatives are created directly in the sparse
+        format: only the atoms within the cutoff of a center contribute to its
+        derivatives.
+        """
+        return method == "analytical"
 
     @property
     def species(self):
@@ -59,6 +59,7 @@ class CoulombMatrix(DescriptorMatrix):
         sigma=None,
         seed=None,
         sparse=False,
+        triangular=False,
     ):
         super().__init__(
             n_atoms_max,
@@ -66,15 +67,19 @@ class CoulombMatrix(DescriptorMatrix):
             sigma,
             seed,
             sparse,
+            triangular=triangular,
         )
         self.wrapper = dscribe.ext.CoulombMatrix(
             n_atoms_max,
             permutation,
             0 if sigma is None else sigma,
             0 if seed is None else seed,
+            triangular,
         )
 
-    def create(self, system, n_jobs=1, only_physical_cores=False, verbose=False):
+    def create(
+        self, system, n_jobs=1, only_physical_cores=False, verbose=False, out=None
+    ):
         """Return the Coulomb matrix for the given systems.
 
         Args:
@@ -92,6 +97,12 @@ class CoulombMatrix(DescriptorMatrix):
                 are counted.  If set to True, only physical CPUs are counted.
             verbose(bool): Controls whether to print the progress of each job
                 into to the console.
+            out (array-like): Preallocated array, e.g. a np.memmap, into
+                which the output of multiple systems is written by the jobs
+                as it is created. It must have the shape of the returned
+                array and requires dense output with the same shape for every
+                system. With process parallelization only memory mapped
+                arrays are shared with the processes.
 
         Returns:
             np.ndarray | sparse.COO: Coulomb matrix for the given systems. The
@@ -108,6 +119,13 @@ class CoulombMatrix(DescriptorMatrix):
                 )
         inp = [(i_sys,) for i_sys in system]
 
+        # Without process parallelization all systems are handled by a single
+        # call to the extension, which avoids the per-system overhead. The
+        # extension can also write directly into a preallocated numpy array.
+        is_native = out is None or self.is_native_output(out)
+        if n_jobs == 1 and len(system) > 1 and not verbose and is_native:
+            return self.create_batch(system, out=out)
+
         # Create in parallel
         output = self.create_parallel(
             inp,
@@ -116,10 +134,56 @@ class CoulombMatrix(DescriptorMatrix):
             [self.get_number_of_features()],
             only_physical_cores,
             verbose=verbose,
+            out=out,
         )
 
         return output
 
+    def create_batch(self, systems, out=None):
+        """Return the Coulomb matrices for multiple systems with a single call
+        to the C++ extension. The extension can divide the systems between
+        native threads, see :func:`dscribe.ext.set_num_threads`.
+
+        Args:
+            systems (list of :class:`ase.Atoms`): The atomic structures.
+            out (array-like): Preallocated array for the output, see
+                :func:`create`. The extension writes directly into
+                C-contiguous float64 numpy arrays.
+
+        Returns:
+            np.ndarray | sparse.COO: Coulomb matrices for the given systems
+            with one row per system.
+        """
+        n_samples = len(systems)
+        atom_offsets = np.zeros(n_samples + 1, dtype=np.int32)
+        atom_offsets[1:] = np.cumsum([len(i_sys) for i_sys in systems])
+        if n_samples > 0:
+            positions = np.concatenate([i_sys.get_positions() for i_sys in systems])
+            atomic_numbers = np.concatenate(
+                [i_sys.get_atomic_numbers() for i_sys in systems]
+            )
+        else:
+            positions = np.empty((0, 3), dtype=np.float64)
+            atomic_numbers = np.empty(0, dtype=np.int32)
+
+        shape = (n_samples, self.get_number_of_features())
+        if out is not None:
+            (out,) = self.check_output(out, [shape])
+        is_native = out is not None and self.is_native_output(out)
+        if is_native:
+            out_des = out
+            out_des[...] = 0
+        else:
+            out_des = np.zeros(shape, dtype=np.float64)
+        self.wrapper.create_batch(out_des, positions, atomic_numbers, atom_offsets)
+
+        if out is not None:
+            if not is_native:
+                out[...] = self.format_array(out_des)
+            self.flush_output((out,))
+            return out
+        return self.format_array(out_des)
+
     def create_single(self, system):
         """
         Args:
@@ -149,6 +213,7 @@ class CoulombMatrix(DescriptorMatrix):
         system,
         indices,
         return_descriptor=True,
+        stencil_order=2,
     ):
         """Return the numerical derivatives for the given system.
         Args:
@@ -158,6 +223,8 @@ class CoulombMatrix(DescriptorMatrix):
             return_descriptor (bool): Whether to also calculate the descriptor
                 in the same function call. This is true by default as it
                 typically is faster to calculate both in one go.
+            stencil_order (int): Order of the finite difference stencil,
+                either 2 or 4.
         Returns:
             If return_descriptor is True, returns a tuple, where the first item
             is the derivative array and the second is the descriptor array.
@@ -182,4 +249,5 @@ class CoulombMatrix(DescriptorMatrix):
             pbc,
             indices,
             return_descriptor,
+            stencil_order,
         )
@@ -20,6 +20,7 @@ import numpy as np
 import sparse as sp
 
 from dscribe.utils.species import get_atomic_numbers
+import dscribe.ext
 
 import joblib
 from joblib import Parallel, delayed
@@ -83,6 +84,23 @@ class Descriptor(ABC):
             method = "numerical"
         return method
 
+    def _get_stencil(self, stencil_order):
+        """Returns the central finite difference stencil that is used for the
+        numerical derivatives. The stencil is defined in the C++ extension,
+        so that the derivatives calculated in python and natively agree.
+
+        Args:
+            stencil_order (int): Order of the error term, either 2 or 4. The
+                fourth order stencil needs twice as many descriptor
+                evaluations, but is considerably more accurate.
+
+        Returns:
+            tuple: The step size, the displacements in units of the step size
+            and the coefficients of the stencil.
+        """
+        stencil = dscribe.ext.central_stencil(stencil_order)
+        return stencil.h, stencil.displacements, stencil.coefficients
+
     @property
     def sparse(self):
         return self._sparse
@@ -145,16 +163,125 @@ class Descriptor(ABC):
             )
 
     def format_array(self, input):
-        """Used to format a float64 numpy array in the final format that will be
-        returned to the user.
+        """Used to format a numpy array in the final format that will be
+        returned to the user. Arrays that are already in the requested
+        precision are not copied.
         """
-        if self.dtype != "float64":
+        if input.dtype != self.dtype:
             input = input.astype(self.dtype)
         if self.sparse:
             input = sp.COO.from_numpy(input)
 
         return input
 
+    def check_output(self, out, shapes, n_jobs=1, prefer="threads"):
+        """Used to check that a preallocated output has the shape of the
+        output and that every job can write into it.
+
+        Args:
+            out (array-like | tuple): The preallocated output. A tuple of
+                arrays is given when several arrays are returned.
+            shapes (list): Shape of each returned array, or None for variable
+                sized output.
+            n_jobs (int): Number of parallel jobs.
+            prefer (str): The parallelization method.
+
+        Returns:
+            tuple: The preallocated arrays.
+        """
+        if self._sparse:
+            raise ValueError("Preallocated output is not available for sparse output.")
+        if any(shape is None for shape in shapes):
+            raise ValueError(
+                "Preallocated output is only available when the output of "
+                "every system has the same shape."
+            )
+        outs = out if isinstance(out, tuple) else (out,)
+        if len(outs) != len(shapes):
+            raise ValueError(
+                "Provide a preallocated array for each of the {} returned "
+                "arrays.".format(len(shapes))
+            )
+        for i_out, shape in zip(outs, shapes):
+            if tuple(i_out.shape) != tuple(shape):
+                raise ValueError(
+                    "The preallocated output has the shape {}, but the output "
+                    "has the shape {}.".format(tuple(i_out.shape), tuple(shape))
+                )
+            # Regular numpy arrays are copied to separate processes, so only
+            # memory mapped arrays are shared with them.
+            is_copied = isinstance(i_out, np.ndarray) and not isinstance(
+                i_out, np.memmap
+            )
+            if n_jobs > 1 and prefer == "processes" and is_copied:
+                raise ValueError(
+                    "Separate processes cannot write into a numpy array. Use a "
+                    "np.memmap or prefer='threads' instead."
+                )
+        return outs
+
+    def is_native_output(self, out, dtypes=(np.float64,)):
+        """Used to determine whether the extension can write directly into the
+        given preallocated output.
+        """
+        return (
+            isinstance(out, np.ndarray)
+            and out.dtype == self.dtype
+            and out.dtype in dtypes
+            and out.flags.c_contiguous
+        )
+
+    def write_output(self, outs, output, index=Ellipsis):
+        """Used to write the output of a single system into the preallocated
+        arrays. The output is a tuple if there are several arrays.
+        """
+        output = output if len(outs) > 1 else (output,)
+        for i_out, i_output in zip(outs, output):
+            i_out[index] = self.format_array(i_output)
+
+    def flush_output(self, outs):
+        """Used to flush the memory mapped arrays of a preallocated output to
+        the disk.
+        """
+        for i_out in outs:
+            if isinstance(i_out, np.memmap):
+                i_out.flush()
+
+    def write_parallel(self, inp, func, n_jobs, outs, verbose, prefer):
+        """Used to write the output of multiple systems directly into the
+        preallocated arrays, where the first dimension goes over the systems.
+        Each job writes its own systems, so the output is never gathered in
+        memory.
+        """
+        n_samples = len(inp)
+        k, m = divmod(n_samples, n_jobs)
+        starts = [i * k + min(i, m) for i in range(n_jobs + 1)]
+        jobs = (inp[starts[i] : starts[i + 1]] for i in range(n_jobs))
+
+        def write_multiple(arguments, func, index, verbose, outs, start):
+            """This is the function that is called by each job but with
+            different parts of the data. The results are written starting from
+            the given row.
+            """
+            old_percent = 0
+            n_samples = len(arguments)
+            for i_sample, i_arg in enumerate(arguments):
+                self.write_output(outs, func(*i_arg), start + i_sample)
+
+                if verbose:
+                    current_percent = (i_sample + 1) / n_samples * 100
+                    if current_percent >= old_percent + 1:
+                        old_percent = current_percent
+                        print("Process {0}: {1:.1f} %".format(index, current_percent))
+
+        # The arrays are passed as arguments, so that joblib shares memory
+        # mapped arrays with the processes instead of copying them.
+        Parallel(n_jobs=n_jobs, prefer=prefer)(
+            delayed(write_multiple)(i_args, func, index, verbose, outs, starts[index])
+            for index, i_args in enumerate(jobs)
+        )
+        self.flush_output(outs)
+
     def create_parallel(
         self,
         inp,
@@ -164,6 +291,7 @@ class Descriptor(ABC):
         only_physical_cores=False,
         verbose=False,
         prefer="processes",
+        out=None,
     ):
         """Used to parallelize the descriptor creation across multiple systems.
 
@@ -203,14 +331,26 @@ class Descriptor(ABC):
                   the amount of pure python code that needs to run. Ideal when
                   most of the calculation time is used by C/C++ extensions that
                   release the GIL.
+            out (array-like): Preallocated array into which the output is
+                written, e.g. a np.memmap or a chunked on-disk store. Each job
+                writes its systems directly to their rows, so the output is
+                never gathered in memory. Only available for dense output with
+                the same shape for every system.
 
         Returns:
             np.ndarray | sparse.COO | list: The descriptor output
             for each given input. The return type depends on the desciptor
-            setup.
+            setup. If a preallocated output is given, it is returned.
         """
+        n_samples = len(inp)
+
         # If single system given, skip the parallelization overhead
-        if len(inp) == 1:
+        if n_samples == 1:
+            if out is not None:
+                outs = self.check_output(out, [static_size])
+                self.write_output(outs, func(*inp[0]))
+                self.flush_output(outs)
+                return out
             return self.format_array(func(*inp[0]))
 
         # Determine the number of jobs
@@ -218,9 +358,13 @@ class Descriptor(ABC):
             n_jobs = joblib.cpu_count(only_physical_cores) + n_jobs
         if n_jobs <= 0:
             raise ValueError("Invalid number of jobs specified.")
+        if out is not None:
+            shape = None if static_size is None else [n_samples] + static_size
+            outs = self.check_output(out, [shape], n_jobs, prefer)
+            self.write_parallel(inp, func, n_jobs, outs, verbose, prefer)
+            return out
 
         # Split data into n_jobs (almost) equal jobs
-        n_samples = len(inp)
         is_sparse = self._sparse
         k, m = divmod(n_samples, n_jobs)
         jobs = (
@@ -372,6 +516,7 @@ class Descriptor(ABC):
         only_physical_cores=False,
         verbose=False,
         prefer="processes",
+        out=None,
     ):
         """Used to parallelize the descriptor creation across multiple systems.
 
@@ -413,14 +558,27 @@ class Descriptor(ABC):
                   the amount of pure python code that needs to run. Ideal when
                   most of the calculation time is used by C/C++ extensions that
                   release the GIL.
+            out (array-like | tuple): Preallocated array for the derivatives,
+                or a tuple of arrays for the derivatives and the descriptor if
+                return_descriptor is True. See :func:`create_parallel`.
 
         Returns:
             np.ndarray | sparse.COO | list: The descriptor output
             for each given input. The return type depends on the desciptor
-            setup.
+            setup. If a preallocated output is given, it is returned.
         """
+        n_samples = len(inp)
+        shapes = [derivatives_shape]
+        if return_descriptor:
+            shapes.append(descriptor_shape)
+
         # If single system given, skip the parallelization overhead
-        if len(inp) == 1:
+        if n_samples == 1:
+            if out is not None:
+                outs = self.check_output(out, shapes)
+                self.write_output(outs, func(*inp[0]))
+                self.flush_output(outs)
+                return out
             return func(*inp[0])
 
         # Determine the number of jobs
@@ -428,9 +586,13 @@ class Descriptor(ABC):
             n_jobs = joblib.cpu_count(only_physical_cores) + n_jobs
         if n_jobs <= 0:
             raise ValueError("Invalid number of jobs specified.")
+        if out is not None:
+            shapes = [None if x is None else [n_samples] + list(x) for x in shapes]
+            outs = self.check_output(out, shapes, n_jobs, prefer)
+            self.write_parallel(inp, func, n_jobs, outs, verbose, prefer)
+            return out
 
         # Split data into n_jobs (almost) equal jobs
-        n_samples = len(inp)
         is_sparse = self._sparse
         k, m = divmod(n_samples, n_jobs)
         jobs = (
@@ -31,6 +31,8 @@ class DescriptorGlobal(Descriptor):
         n_jobs=1,
         only_physical_cores=False,
         verbose=False,
+        stencil_order=2,
+        out=None,
     ):
         """Return the descriptor derivatives for the given system(s).
         Args:
@@ -64,6 +66,18 @@ class DescriptorGlobal(Descriptor):
                 are counted.  If set to True, only physical CPUs are counted.
             verbose(bool): Controls whether to print the progress of each job
                 into to the console.
+            stencil_order (int): Order of the error term in the central finite
+                difference stencil used by the numerical method: 2 (default)
+                or 4. The fourth order stencil needs twice as many descriptor
+                evaluations, but is considerably more accurate.
+            out (array-like | tuple): Preallocated array for the derivatives,
+                or a tuple of arrays for the derivatives and the descriptor if
+                return_descriptor is True. The arrays, e.g. np.memmaps, must
+                have the shapes of the returned arrays and the output is
+                written into them by the jobs as it is created. Requires dense
+                output with the same shape for every system. With process
+                parallelization only memory mapped arrays are shared with the
+                processes.
         Returns:
             If return_descriptor is True, returns a tuple, where the first item
             is the derivative array and the second is the descriptor array.
@@ -81,6 +95,7 @@ class DescriptorGlobal(Descriptor):
             fourth dimension goes over the features in the default order.
         """
         method = self.validate_derivatives_method(method)
+        self._get_stencil(stencil_order)
 
         # Check input validity
         system = [system] if isinstance(system, Atoms) else system
@@ -119,6 +134,7 @@ class DescriptorGlobal(Descriptor):
                 indices,
                 [method] * n_samples,
                 [return_descriptor] * n_samples,
+                [stencil_order] * n_samples,
             )
         )
 
@@ -152,6 +168,7 @@ class DescriptorGlobal(Descriptor):
             return_descriptor,
             only_physical_cores,
             verbose=verbose,
+            out=out,
         )
 
         return output
@@ -162,6 +179,7 @@ class DescriptorGlobal(Descriptor):
         indices,
         method="numerical",
         return_descriptor=True,
+        stencil_order=2,
     ):
         """Return the derivatives for the given system.
         Args:
@@ -173,6 +191,8 @@ class DescriptorGlobal(Descriptor):
             return_descriptor (bool): Whether to also calculate the descriptor
                 in the same function call. This is true by default as it
                 typically is faster to calculate both in one go.
+            stencil_order (int): Order of the finite difference stencil used
+                by the numerical method, either 2 or 4.
         Returns:
             If return_descriptor is True, returns a tuple, where the first item
             is the derivative array and the second is the descriptor array.
@@ -194,7 +214,9 @@ class DescriptorGlobal(Descriptor):
         d = np.zeros((n_indices, 3, n_features), dtype=np.float64)
 
         if method == "numerical":
-            self.derivatives_numerical(d, c, system, indices, return_descriptor)
+            self.derivatives_numerical(
+                d, c, system, indices, return_descriptor, stencil_order
+            )
         elif method == "analytical":
             self.derivatives_analytical(d, c, system, indices, return_descriptor)
 
@@ -212,6 +234,7 @@ class DescriptorGlobal(Descriptor):
         system,
         indices,
         return_descriptor=True,
+        stencil_order=2,
     ):
         """Return the numerical derivatives for the given system. This is the
         default numerical implementation using python. You should overwrite this
@@ -226,32 +249,27 @@ class DescriptorGlobal(Descriptor):
             return_descriptor (bool): Whether to also calculate the descriptor
                 in the same function call. This is true by default as it
                 typically is faster to calculate both in one go.
+            stencil_order (int): Order of the finite difference stencil,
+                either 2 or 4.
         """
-        h = 0.0001
-        n_atoms = len(system)
-        n_features = self.get_number_of_features()
-
         # The maximum error depends on how big the system is. With a small system
         # the error is smaller for non-periodic systems than the corresponding
         # error when periodicity is turned on. The errors become equal (~1e-5) when
         # the size of the system is increased.
-        coeffs = [-1.0 / 2.0, 1.0 / 2.0]
-        deltas = [-1.0, 1.0]
-        derivatives_python = np.zeros((n_atoms, 3, n_features))
-        for i_atom in range(len(system)):
+        h, deltas, coeffs = self._get_stencil(stencil_order)
+
+        # Only the requested atoms are moved. The same copy of the system is
+        # reused for every stencil point.
+        system_disturbed = system.copy()
+        positions = system.get_positions()
+        for i, i_atom in enumerate(indices):
             for i_comp in range(3):
-                for i_stencil in range(2):
-                    system_disturbed = system.copy()
-                    i_pos = system_disturbed.get_positions()
+                for i_stencil in range(len(deltas)):
+                    i_pos = positions.copy()
                     i_pos[i_atom, i_comp] += h * deltas[i_stencil]
                     system_disturbed.set_positions(i_pos)
                     d1 = self.create_single(system_disturbed)
-                    derivatives_python[i_atom, i_comp, :] += coeffs[i_stencil] * d1 / h
-
-        i = 0
-        for index in indices:
-            d[i, :] = derivatives_python[index, :, :]
-            i += 1
+                    d[i, i_comp, :] += coeffs[i_stencil] * d1 / h
 
         if return_descriptor:
             np.copyto(c, self.create_single(system))
@@ -38,6 +38,20 @@ class DescriptorLocal(Descriptor):
             method = "numerical"
         return method
 
+    def has_native_sparse_derivatives(self, method):
+        """Used to determine whether the derivatives for the given method are
+        created directly in the sparse format. If not, sparse derivatives are
+        converted from a dense array.
+        """
+        return False
+
+    def get_native_dtype(self, method=None):
+        """Used to determine the precision in which the extension writes the
+        output of create (method=None) or the derivatives of the given method.
+        Output in any other precision is converted from float64.
+        """
+        return np.float64
+
     def derivatives(
         self,
         system,
@@ -50,6 +64,8 @@ class DescriptorLocal(Descriptor):
         n_jobs=1,
         only_physical_cores=False,
         verbose=False,
+        stencil_order=2,
+        out=None,
     ):
         """Return the descriptor derivatives for the given systems and given centers.
 
@@ -98,6 +114,18 @@ class DescriptorLocal(Descriptor):
                 are counted.  If set to True, only physical CPUs are counted.
             verbose(bool): Controls whether to print the progress of each job
                 into to the console.
+            stencil_order (int): Order of the error term in the central finite
+                difference stencil used by the numerical method: 2 (default)
+                or 4. The fourth order stencil needs twice as many descriptor
+                evaluations, but is considerably more accurate.
+            out (array-like | tuple): Preallocated array for the derivatives,
+                or a tuple of arrays for the derivatives and the descriptor if
+                return_descriptor is True. The arrays, e.g. np.memmaps, must
+                have the shapes of the returned arrays and the output is
+                written into them by the jobs as it is created. Requires dense
+                output with the same shape for every system. With process
+                parallelization only memory mapped arrays are shared with the
+                processes.
 
         Returns:
             If return_descriptor is True, returns a tuple, where the first item
@@ -119,9 +147,11 @@ class DescriptorLocal(Descriptor):
             the features in the default order.
         """
         method = self.validate_derivatives_method(method, attach)
+        self._get_stencil(stencil_order)
 
-        # If single system given, skip the parallelization
-        if isinstance(system, Atoms):
+        # If single system given, skip the parallelization. A preallocated
+        # output is filled through the parallel code path instead.
+        if isinstance(system, Atoms) and out is None:
             n_atoms = len(system)
             indices = self._get_indices(n_atoms, include, exclude)
             return self.derivatives_single(
@@ -131,9 +161,13 @@ class DescriptorLocal(Descriptor):
                 method=method,
                 attach=attach,
                 return_descriptor=return_descriptor,
+                stencil_order=stencil_order,
             )
 
         # Check input validity
+        if isinstance(system, Atoms):
+            system = [system]
+            centers = [centers]
         n_samples = len(system)
         if centers is None:
             centers = [None] * n_samples
@@ -179,6 +213,7 @@ class DescriptorLocal(Descriptor):
                 [method] * n_samples,
                 [attach] * n_samples,
                 [return_descriptor] * n_samples,
+                [stencil_order] * n_samples,
             )
         )
 
@@ -189,10 +224,12 @@ class DescriptorLocal(Descriptor):
 
         def get_shapes(job):
             centers = job[1]
-            if centers is None:
+            if self.average != "off":
+                n_centers = 1
+            elif centers is None:
                 n_centers = len(job[0])
             else:
-                n_centers = 1 if self.average != "off" else len(centers)
+                n_centers = len(centers)
             n_indices = len(job[2])
             return (n_centers, n_indices, 3, n_features), (n_centers, n_features)
 
@@ -219,26 +256,27 @@ class DescriptorLocal(Descriptor):
             return_descriptor,
             only_physical_cores,
             verbose=verbose,
+            out=out,
         )
 
         return output
 
-    def init_descriptor_array(self, n_centers):
+    def init_descriptor_array(self, n_centers, dtype=np.float64):
         """Return a zero-initialized numpy array for the descriptor."""
         n_features = self.get_number_of_features()
         if self.average != "off":
-            c = np.zeros((1, n_features), dtype=np.float64)
+            c = np.zeros((1, n_features), dtype=dtype)
         else:
-            c = np.zeros((n_centers, n_features), dtype=np.float64)
+            c = np.zeros((n_centers, n_features), dtype=dtype)
         return c
 
-    def init_derivatives_array(self, n_centers, n_indices):
+    def init_derivatives_array(self, n_centers, n_indices, dtype=np.float64):
         """Return a zero-initialized numpy array for the derivatives."""
         n_features = self.get_number_of_features()
         if self.average != "off":
-            return np.zeros((1, n_indices, 3, n_features), dtype=np.float64)
+            return np.zeros((1, n_indices, 3, n_features), dtype=dtype)
         else:
-            return np.zeros((n_centers, n_indices, 3, n_features), dtype=np.float64)
+            return np.zeros((n_centers, n_indices, 3, n_features), dtype=dtype)
 
     def derivatives_single(
         self,
@@ -248,6 +286,7 @@ class DescriptorLocal(Descriptor):
         method="numerical",
         attach=False,
         return_descriptor=True,
+        stencil_order=2,
     ):
         """Return the derivatives for the given system.
         Args:
@@ -271,6 +310,8 @@ class DescriptorLocal(Descriptor):
             return_descriptor (bool): Whether to also calculate the descriptor
                 in the same function call. This is true by default as it
                 typically is faster to calculate both in one go.
+            stencil_order (int): Order of the finite difference stencil used
+                by the numerical method, either 2 or 4.
         Returns:
             If return_descriptor is True, returns a tuple, where the first item
             is the derivative array and the second is the descriptor array.
@@ -287,23 +328,34 @@ class DescriptorLocal(Descriptor):
         n_centers = len(system) if centers is None else len(centers)
 
         # Initialize numpy arrays for storing the descriptor and derivatives.
+        # Derivatives that are created directly in the sparse format are
+        # returned by the calculation instead, so that no dense array is
+        # needed.
+        dtype = self.get_native_dtype(method)
         if return_descriptor:
-            c = self.init_descriptor_array(n_centers)
+            c = self.init_descriptor_array(n_centers, dtype)
+        else:
+            c = np.empty(0, dtype=dtype)
+        native_sparse = self.sparse and self.has_native_sparse_derivatives(method)
+        if native_sparse:
+            d = None
         else:
-            c = np.empty(0)
-        d = self.init_derivatives_array(n_centers, n_indices)
+            d = self.init_derivatives_array(n_centers, n_indices, dtype)
 
         # Calculate numerically with extension
         if method == "numerical":
             self.derivatives_numerical(
-                d, c, system, centers, indices, attach, return_descriptor
+                d, c, system, centers, indices, attach, return_descriptor, stencil_order
             )
         elif method == "analytical":
-            self.derivatives_analytical(
+            d_sparse = self.derivatives_analytical(
                 d, c, system, centers, indices, attach, return_descriptor
             )
 
-        d = self.format_array(d)
+        if native_sparse:
+            d = d_sparse if self.dtype == "float64" else d_sparse.astype(self.dtype)
+        else:
+            d = self.format_array(d)
         c = self.format_array(c)
 
         if return_descriptor:
@@ -319,6 +371,7 @@ class DescriptorLocal(Descriptor):
         indices,
         attach=False,
         return_descriptor=True,
+        stencil_order=2,
     ):
         """Return the numerical derivatives for the given system. This is the
         default numerical implementation with python. You should overwrite this
@@ -345,21 +398,22 @@ class DescriptorLocal(Descriptor):
             return_descriptor (bool): Whether to also calculate the descriptor
                 in the same function call. This is true by default as it
                 typically is faster to calculate both in one go.
+            stencil_order (int): Order of the finite difference stencil,
+                either 2 or 4.
         """
-        h = 0.0001
-        coeffs = [-1.0 / 2.0, 1.0 / 2.0]
-        deltas = [-1.0, 1.0]
+        h, deltas, coeffs = self._get_stencil(stencil_order)
         if centers is None:
             centers = range(len(system))
         if not attach and np.issubdtype(type(centers[0]), np.integer):
             centers = system.get_positions()[centers]
 
+        system_disturbed = system.copy()
+        positions = system.get_positions()
         for index, i_atom in enumerate(indices):
             for i_center, center in enumerate(centers):
                 for i_comp in range(3):
-                    for i_stencil in range(2):
-                        system_disturbed = system.copy()
-                        i_pos = system_disturbed.get_positions()
+                    for i_stencil in range(len(deltas)):
+                        i_pos = positions.copy()
                         i_pos[i_atom, i_comp] += h * deltas[i_stencil]
                         system_disturbed.set_positions(i_pos)
                         d1 = self.create_single(system_disturbed, [center])
@@ -32,6 +32,7 @@ class DescriptorMatrix(DescriptorGlobal):
         seed=None,
         sparse=False,
         dtype="float64",
+        triangular=False,
     ):
         """
         Args:
@@ -58,6 +59,10 @@ class DescriptorMatrix(DescriptorGlobal):
                 distribution.
             sparse (bool): Whether the output should be a sparse matrix or a
                 dense numpy array.
+            triangular (bool): Whether only the upper triangular part of the
+                symmetric matrix, including the diagonal, is returned. The
+                elements are ordered row by row. Cannot be used together with
+                the *eigenspectrum*-permutation option.
         """
         super().__init__(periodic=False, sparse=sparse, dtype=dtype)
 
@@ -83,12 +88,19 @@ class DescriptorMatrix(DescriptorGlobal):
                 "as 'random'."
             )
 
+        if triangular and permutation == "eigenspectrum":
+            raise ValueError(
+                "The triangular output cannot be used together with the "
+                "'eigenspectrum' permutation option."
+            )
+
         self.seed = seed
         self.random_state = RandomState(seed)
         self.n_atoms_max = n_atoms_max
         self.permutation = permutation
         self._norm_vector = None
         self.sigma = sigma
+        self.triangular = triangular
 
     def get_matrix(self, system):
         """Used to get the final matrix for this descriptor.
@@ -126,7 +138,10 @@ class DescriptorMatrix(DescriptorGlobal):
         # Add zero padding
         matrix = self.zero_pad(matrix)
         # Flatten
-        matrix = np.reshape(matrix, (matrix.size,))
+        if self.triangular and matrix.ndim == 2:
+            matrix = matrix[np.triu_indices(self.n_atoms_max)]
+        else:
+            matrix = np.reshape(matrix, (matrix.size,))
 
         return matrix
 
@@ -198,6 +213,8 @@ class DescriptorMatrix(DescriptorGlobal):
         """
         if self.permutation == "eigenspectrum":
             return int(self.n_atoms_max)
+        elif self.triangular:
+            return int(self.n_atoms_max * (self.n_atoms_max + 1) / 2)
         else:
             return int(self.n_atoms_max**2)
 
@@ -256,6 +273,18 @@ class DescriptorMatrix(DescriptorGlobal):
         if n_systems is None:
             n_dim = len(features.shape)
             n_systems = 1 if n_dim == 1 else features.shape[0]
+        if self.triangular:
+            triangle = features.todense() if self.sparse else np.asarray(features)
+            triangle = triangle.reshape((n_systems, -1))
+            rows, cols = np.triu_indices(self.n_atoms_max)
+            full = np.zeros((n_systems, self.n_atoms_max, self.n_atoms_max))
+            full[:, rows, cols] = triangle
+            full[:, cols, rows] = triangle
+            if n_systems == 1:
+                full = full[0]
+            if self.sparse:
+                full = sparse.COO.from_numpy(full)
+            return full
         if self.sparse:
             if n_systems != 1:
                 full = sparse.zeros(
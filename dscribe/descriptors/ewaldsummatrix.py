@@ -18,11 +18,11 @@ import math
 import numpy as np
 
 from ase import Atoms
-
-from scipy.special import erfc
+from ase.geometry import wrap_positions
 
 from dscribe.descriptors.descriptormatrix import DescriptorMatrix
-from dscribe.core.lattice import Lattice
+
+import dscribe.ext
 
 
 class EwaldSumMatrix(DescriptorMatrix):
@@ -71,6 +71,7 @@ class EwaldSumMatrix(DescriptorMatrix):
         n_jobs=1,
         only_physical_cores=False,
         verbose=False,
+        out=None,
     ):
         """Return the Ewald sum matrix for the given systems.
 
@@ -111,6 +112,12 @@ class EwaldSumMatrix(DescriptorMatrix):
                 are counted.  If set to True, only physical CPUs are counted.
             verbose(bool): Controls whether to print the progress of each job
                 into to the console.
+            out (array-like): Preallocated array, e.g. a np.memmap, into
+                which the output of multiple systems is written by the jobs
+                as it is created. It must have the shape of the returned
+                array and requires dense output with the same shape for every
+                system. With process parallelization only memory mapped
+                arrays are shared with the processes.
 
         Returns:
             np.ndarray | sparse.COO: Ewald sum matrix for the given systems.
@@ -172,6 +179,7 @@ class EwaldSumMatrix(DescriptorMatrix):
             static_size,
             only_physical_cores,
             verbose=verbose,
+            out=out,
         )
 
         return output
@@ -197,16 +205,89 @@ class EwaldSumMatrix(DescriptorMatrix):
                 Gaussians. If not provided, a default value of :math:`\\alpha =
                 \\sqrt{\\pi}\\left(\\frac{N}{V^2}\\right)^{1/6}` is used.
                 Corresponds to the standard deviation of the Gaussians.
+
+        Returns:
+            ndarray: The zero padded matrix as a flattened 1D array.
+        """
+        # Initialize output array in dense format.
+        out_des = np.zeros((self.get_number_of_features()), dtype=np.float64)
+
+        # Calculate with C++ extension
+        pos, Z, cell, pbc = self.get_system_arrays(system)
+        wrapper = self.get_wrapper(system, accuracy, w, r_cut, g_cut, a)
+        wrapper.create(out_des, pos, Z, cell, pbc)
+
+        return out_des
+
+    def derivatives_numerical(
+        self,
+        d,
+        c,
+        system,
+        indices,
+        return_descriptor=True,
+        stencil_order=2,
+    ):
+        """Return the numerical derivatives for the given system. The
+        derivatives are calculated with the default Ewald parameters.
+
+        Args:
+            system (:class:`ase.Atoms`): Atomic structure.
+            indices (list): Indices of atoms for which the derivatives will be
+                computed for.
+            return_descriptor (bool): Whether to also calculate the descriptor
+                in the same function call. This is true by default as it
+                typically is faster to calculate both in one go.
+            stencil_order (int): Order of the finite difference stencil,
+                either 2 or 4.
+        Returns:
+            If return_descriptor is True, returns a tuple, where the first item
+            is the derivative array and the second is the descriptor array.
+            Otherwise only returns the derivatives array. The derivatives array
+            is a 3D numpy array. The dimensions are: [n_atoms, 3, n_features].
+            The first dimension goes over the included atoms. The order is same
+            as the order of atoms in the given system. The second dimension
+            goes over the cartesian components, x, y and z. The last dimension
+            goes over the features in the default order.
         """
-        self.q = system.get_atomic_numbers()
-        self.q_squared = self.q**2
-        self.n_atoms = len(system)
-        self.volume = system.get_volume()
-        self.sqrt_pi = math.sqrt(np.pi)
+        pos, Z, cell, pbc = self.get_system_arrays(system)
+        wrapper = self.get_wrapper(system)
+        wrapper.derivatives_numerical(
+            d,
+            c,
+            pos,
+            Z,
+            cell,
+            pbc,
+            indices,
+            return_descriptor,
+            stencil_order,
+        )
+
+    def get_wrapper(self, system, accuracy=1e-5, w=1, r_cut=None, g_cut=None, a=None):
+        """Returns the C++ extension that calculates the matrix for the given
+        system. The Ewald parameters depend on the system, so a new extension
+        is created for each system. The seed for the random permutation is
+        drawn from the random state of this descriptor so that each system
+        gets a different noise.
+
+        Args:
+            system (:class:`ase.Atoms`): Input system.
+            accuracy (float): See :meth:`create_single`.
+            w (float): See :meth:`create_single`.
+            r_cut (float): See :meth:`create_single`.
+            g_cut (float): See :meth:`create_single`.
+            a (float): See :meth:`create_single`.
+
+        Returns:
+            The C++ extension for the given system.
+        """
+        n_atoms = len(system)
+        volume = system.get_volume()
 
         # If a is not provided, use a default value
         if a is None:
-            a = (self.n_atoms * w / (self.volume**2)) ** (1 / 6) * self.sqrt_pi
+            a = (n_atoms * w / (volume**2)) ** (1 / 6) * math.sqrt(np.pi)
 
         # If the real space cutoff, reciprocal space cutoff and a have not been
         # specified, use the accuracy and the weighting w to determine default
@@ -221,170 +302,39 @@ class EwaldSumMatrix(DescriptorMatrix):
                 "both cutoffs r_cut and g_cut."
             )
 
-        self.a = a
-        self.a_squared = self.a**2
-        self.g_cut = g_cut
-        self.r_cut = r_cut
-
-        matrix = super().create_single(system)
-        return matrix
-
-    def get_matrix(self, system):
-        """
-        The total energy matrix. Each matrix element (i, j) corresponds to the
-        total interaction energy in a system with atoms i and j.
-
-        Args:
-            system (:class:`ase.Atoms` | :class:`.System`): Input system.
-
-        Returns:
-            np.ndarray: Ewald matrix.
-        """
-        # Calculate the regular real and reciprocal space sums of the Ewald sum.
-        ereal = self._calc_real(system)
-        erecip = self._calc_recip(system)
-        ezero = self._calc_zero()
-        total = erecip + ereal + ezero
-
-        return total
-
-    def _calc_zero(self):
-        """Calculates the constant part of the Ewald sum matrix.
-
-        The constant part contains the correction for the self-interaction
-        between the point charges and the Gaussian charge distribution added on
-        top of them and the intearction between the point charges and a uniform
-        neutralizing background charge.
+        seed = 0
+        if self.permutation == "random":
+            seed = self.random_state.randint(np.iinfo(np.int32).max)
+
+        return dscribe.ext.EwaldSumMatrix(
+            self.n_atoms_max,
+            self.permutation,
+            0 if self.sigma is None else self.sigma,
+            seed,
+            a,
+            r_cut,
+            g_cut,
+        )
 
-        Returns:
-            np.ndarray(): A 2D matrix containing the constant terms for each
-            i,j pair.
-        """
-        # Calculate the self-interaction correction. The self term corresponds
-        # to the interaction of the point charge with cocentric Gaussian cloud
-        # introduced in the Ewald method. The correction is only applied to the
-        # diagonal terms so that the correction is not counted multiple times
-        # when calculating the total Ewald energy as the sum of diagonal
-        # element + upper diagonal part.
-        q = self.q
-        matself = np.zeros((self.n_atoms, self.n_atoms))
-        diag = q**2
-        np.fill_diagonal(matself, diag)
-        matself *= -self.a / self.sqrt_pi
-
-        # Calculate the interaction energy between constant neutralizing
-        # background charge. On the diagonal this is defined by
-        matbg = 2 * q[None, :] * q[:, None].astype(float)
-        matbg *= -np.pi / (2 * self.volume * self.a_squared)
-
-        # The diagonal terms are divided by two
-        diag = np.diag(matbg) / 2
-        np.fill_diagonal(matbg, diag)
-
-        correction_matrix = matself + matbg
-
-        return correction_matrix
-
-    def _calc_real(self, system):
-        """Used to calculate the Ewald real-space sum.
-
-        Corresponds to equation (5) in
-        https://doi.org/10.1016/0010-4655(96)00016-1
+    def get_system_arrays(self, system):
+        """Returns the arrays that are passed to the C++ extension. The
+        system is always treated as periodic, and the positions are wrapped
+        inside the cell.
 
         Args:
-            system (:class:`ase.Atoms` | :class:`.System`): Input system.
+            system (:class:`ase.Atoms`): Input system.
 
         Returns:
-            np.ndarray(): A 2D matrix containing the real space terms for each
-            i,j pair.
+            tuple: The positions, atomic numbers, cell and periodic boundary
+            conditions.
         """
-        fcoords = system.get_scaled_positions()
-        coords = system.get_positions()
-        n_atoms = len(system)
-        ereal = np.zeros((n_atoms, n_atoms), dtype=np.float64)
-        lattice = Lattice(system.get_cell())
-
-        # For each atom in the original cell, get the neighbours in the
-        # infinite system within the real space cutoff and calculate the real
-        # space portion of the Ewald sum.
-        for i in range(n_atoms):
-            # Get points that are within the real space cutoff
-            nfcoords, rij, js = lattice.get_points_in_sphere(
-                fcoords, coords[i], self.r_cut, zip_results=False
+        cell = np.array(system.get_cell(), dtype=np.float64)
+        if np.linalg.matrix_rank(cell) < 3:
+            raise ValueError(
+                "The given system has a non-invertible cell matrix: {}.".format(cell)
             )
-            # Remove the rii term, because a charge does not interact with
-            # itself (but does interact with copies of itself).
-            mask = rij > 1e-8
-            js = js[mask]
-            rij = rij[mask]
-            nfcoords = nfcoords[mask]
-
-            qi = self.q[i]
-            qj = self.q[js]
+        pbc = np.ones(3, dtype=bool)
+        pos = wrap_positions(system.get_positions(), cell, pbc=pbc)
+        Z = system.get_atomic_numbers()
 
-            erfcval = erfc(self.a * rij)
-            new_ereals = erfcval * qi * qj / rij
-
-            # Insert new_ereals
-            for k in range(n_atoms):
-                ereal[k, i] = np.sum(new_ereals[js == k])
-
-        # The diagonal terms are divided by two
-        diag = np.diag(ereal) / 2
-        np.fill_diagonal(ereal, diag)
-
-        return ereal
-
-    def _calc_recip(self, system):
-        """
-        Perform the reciprocal space summation. Uses the fastest non mesh-based
-        method described as given by equation (16) in
-        https://doi.org/10.1016/0010-4655(96)00016-1
-
-        The term G=0 is neglected, even if the system has nonzero charge.
-        Physically this would mean that we are adding a constant background
-        charge to make the cell charge neutral.
-
-        Args:
-            system (:class:`ase.Atoms` | :class:`.System`): Input system.
-
-        Returns:
-            np.ndarray(): A 2D matrix containing the real space terms for each
-            i,j pair.
-        """
-        n_atoms = self.n_atoms
-        erecip = np.zeros((n_atoms, n_atoms), dtype=np.float64)
-        coords = system.get_positions()
-
-        # Get the reciprocal lattice points within the reciprocal space cutoff
-        rcp_latt = 2 * np.pi * system.cell.reciprocal()
-        rcp_latt = Lattice(rcp_latt)
-        recip_nn = rcp_latt.get_points_in_sphere([[0, 0, 0]], [0, 0, 0], self.g_cut)
-
-        # Ignore the terms with G=0.
-        frac_coords = [fcoords for (fcoords, dist, i) in recip_nn if dist != 0]
-
-        gs = rcp_latt.get_cartesian_coords(frac_coords)
-        g2s = np.sum(gs**2, 1)
-        expvals = np.exp(-g2s / (4 * self.a_squared))
-        grs = np.sum(gs[:, None] * coords[None, :], 2)
-        factors = np.divide(expvals, g2s)
-        charges = self.q
-
-        # Create array where q_2[i,j] is qi * qj
-        qiqj = charges[None, :] * charges[:, None]
-
-        for gr, factor in zip(grs, factors):
-            # Uses the identity sin(x)+cos(x) = 2**0.5 sin(x + pi/4)
-            m = (gr[None, :] + math.pi / 4) - gr[:, None]
-            np.sin(m, m)
-            m *= factor
-            erecip += m
-
-        erecip *= 4 * math.pi / self.volume * qiqj * 2**0.5
-
-        # The diagonal terms are divided by two
-        diag = np.diag(erecip) / 2
-        np.fill_diagonal(erecip, diag)
-
-        return erecip
+        return pos, Z, cell, pbc
@@ -13,17 +13,13 @@ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 See the License for the specific language governing permissions and
 limitations under the License.
 """
-import sys
 import math
 
 import numpy as np
-import scipy.spatial.distance
 from sklearn.preprocessing import normalize
-import sparse
 from ase import Atoms
 import ase.data
 
-from dscribe.core import System
 from dscribe.descriptors.mbtr import (
     check_geometry,
     check_weighting,
@@ -32,7 +28,6 @@ from dscribe.descriptors.mbtr import (
 )
 from dscribe.descriptors.descriptorlocal import DescriptorLocal
 from dscribe.ext import MBTRWrapper
-import dscribe.utils.geometry
 
 
 class LMBTR(DescriptorLocal):
@@ -280,7 +275,13 @@ class LMBTR(DescriptorLocal):
         self._normalization = value
 
     def create(
-        self, system, centers=None, n_jobs=1, only_physical_cores=False, verbose=False
+        self,
+        system,
+        centers=None,
+        n_jobs=1,
+        only_physical_cores=False,
+        verbose=False,
+        out=None,
     ):
         """Return the LMBTR output for the given systems and given centers.
 
@@ -304,6 +305,12 @@ class LMBTR(DescriptorLocal):
                 are counted.  If set to True, only physical CPUs are counted.
             verbose(bool): Controls whether to print the progress of each job
                 into to the console.
+            out (array-like): Preallocated array, e.g. a np.memmap, into
+                which the output of multiple systems is written by the jobs
+                as it is created. It must have the shape of the returned
+                array and requires dense output with the same shape for every
+                system. With process parallelization only memory mapped
+                arrays are shared with the processes.
 
         Returns:
             np.ndarray | scipy.sparse.csr_matrix: The LMBTR output for the given
@@ -365,6 +372,7 @@ class LMBTR(DescriptorLocal):
             static_size,
             only_physical_cores,
             verbose=verbose,
+            out=out,
         )
 
         return output
@@ -391,13 +399,34 @@ class LMBTR(DescriptorLocal):
             centers, for k terms, as an array. These are ordered as given in
             centers.
         """
+        positions, center_indices = self.prepare_centers(system, centers)
+        mbtr, _ = getattr(self, f"_get_k{self.k}")(
+            system, positions, center_indices, [], True, False
+        )
+
+        # Handle normalization
+        if self.normalization == "l2":
+            normalize(mbtr, norm="l2", axis=1, copy=False)
+
+        # Convert to the final output precision.
+        if self.dtype == "float32":
+            mbtr = mbtr.astype(self.dtype)
+
+        return mbtr
+
+    def prepare_centers(self, system, centers=None):
+        """Validates the system and the centers for the C++ extension.
+
+        Returns:
+            tuple: The cartesian positions of the centers and the index of the
+            atom each center is attached to. Centers given as cartesian
+            positions are not attached to any atom and have the index -1.
+        """
         # Check that the system does not have elements that are not in the list
         # of atomic numbers
         atomic_number_set = set(system.get_atomic_numbers())
         self.check_atomic_numbers(atomic_number_set)
         self._interaction_limit = len(system)
-        system_positions = system.get_positions()
-        system_atomic_numbers = system.get_atomic_numbers()
 
         # Ensure that the atomic number 0 is not present in the system
         if 0 in atomic_number_set:
@@ -406,86 +435,102 @@ class LMBTR(DescriptorLocal):
                 "is reserved to mark the atoms use as analysis centers."
             )
 
-        # Form a list of indices, centers and atomic numbers for the local
-        # centers. k=3 and k=2 use a slightly different approach, so two
-        # versions are built
-        i_new = len(system)
-        indices_k2 = []
-        new_pos_k2 = []
-        new_atomic_numbers_k2 = []
-        indices_k3 = []
-        new_pos_k3 = []
-        new_atomic_numbers_k3 = []
-        n_atoms = len(system)
-        if centers is not None:
-            # Check validity of centers definitions and create final cartesian
-            # position list
-            if len(centers) == 0:
+        # If centers are not supplied, it is assumed that each atom is used
+        # as a center
+        if centers is None:
+            return system.get_positions(), np.arange(len(system))
+
+        # Check validity of centers definitions and create final cartesian
+        # position list
+        error = ValueError(
+            "The argument 'centers' should contain a non-empty set of"
+            " atomic indices or cartesian coordinates with x, y and z "
+            "components."
+        )
+        if len(centers) == 0:
+            raise error
+        system_positions = system.get_positions()
+        positions = np.empty((len(centers), 3))
+        center_indices = np.full(len(centers), -1, dtype=int)
+        for i_center, i in enumerate(centers):
+            if np.issubdtype(type(i), np.integer):
+                i_len = len(system)
+                if i >= i_len or i < 0:
+                    raise ValueError(
+                        "The provided index {} is not valid for the system "
+                        "with {} atoms.".format(i, i_len)
+                    )
+                positions[i_center] = system_positions[i]
+                center_indices[i_center] = i
+            elif isinstance(i, (list, tuple, np.ndarray)):
+                if len(i) != 3:
+                    raise error
+                positions[i_center] = i
+            else:
                 raise ValueError(
-                    "The argument 'centers' should contain a non-empty set of"
-                    " atomic indices or cartesian coordinates with x, y and z "
-                    "components."
+                    "Create method requires the argument 'centers', a "
+                    "list of atom indices and/or positions."
                 )
-            for i in centers:
-                if np.issubdtype(type(i), np.integer):
-                    i_len = len(system)
-                    if i >= i_len or i < 0:
-                        raise ValueError(
-                            "The provided index {} is not valid for the system "
-                            "with {} atoms.".format(i, i_len)
-                        )
-                    indices_k2.append(i)
-                    indices_k3.append(i)
-                    new_pos_k2.append(system_positions[i])
-                    new_atomic_numbers_k2.append(system_atomic_numbers[i])
-                elif isinstance(i, (list, tuple, np.ndarray)):
-                    if len(i) != 3:
-                        raise ValueError(
-                            "The argument 'centers' should contain a "
-                            "non-empty set of atomic indices or cartesian "
-                            "coordinates with x, y and z components."
-                        )
-                    new_pos_k2.append(np.array(i))
-                    new_pos_k3.append(np.array(i))
-                    new_atomic_numbers_k2.append(0)
-                    new_atomic_numbers_k3.append(0)
-                    i_new += 1
-                else:
-                    raise ValueError(
-                        "Create method requires the argument 'centers', a "
-                        "list of atom indices and/or positions."
+
+        return positions, center_indices
+
+    def validate_derivatives_method(self, method, attach):
+        """Used to validate and determine the final method for calculating the
+        derivatives.
+        """
+        methods = {"numerical", "analytical", "auto"}
+        if method not in methods:
+            raise ValueError(
+                "Invalid method specified. Please choose from: {}".format(methods)
+            )
+
+        if method == "numerical":
+            return method
+
+        # Check if analytical derivatives can be used
+        try:
+            supported_normalization = ["none"]
+            if self.normalization not in supported_normalization:
+                raise ValueError(
+                    "Analytical derivatives not implemented for normalization option '{}'. Please choose from: {}".format(
+                        self.normalization, supported_normalization
                     )
-        # If centers are not supplied, it is assumed that each atom is used
-        # as a center
+                )
+            # "angle" function is not differentiable
+            if self.k == 3 and self.geometry["function"] == "angle":
+                raise ValueError(
+                    "Analytical derivatives not implemented for k3 geometry function 'angle'."
+                )
+        except Exception as e:
+            if method == "analytical":
+                raise e
+            elif method == "auto":
+                method = "numerical"
         else:
-            indices_k2 = np.arange(n_atoms)
-            indices_k3 = np.arange(n_atoms)
-            new_pos_k2 = system.get_positions()
-            new_atomic_numbers_k2 = system.get_atomic_numbers()
+            if method == "auto":
+                method = "analytical"
 
-        # Calculate the "raw" output
-        if self.k == 2:
-            new_system = System(
-                symbols=new_atomic_numbers_k2,
-                positions=new_pos_k2,
-            )
-            indices = indices_k2
-        elif self.k == 3:
-            new_system = System(
-                symbols=new_atomic_numbers_k3,
-                positions=new_pos_k3,
-            )
-            indices = indices_k3
-        mbtr = getattr(self, f"_get_k{self.k}")(system, new_system, indices)
+        return method
 
-        # Handle normalization
-        if self.normalization == "l2":
-            normalize(mbtr.tocsr(), norm="l2", axis=1, copy=False)
+    def derivatives_analytical(
+        self, d, c, system, centers, indices, attach, return_descriptor=True
+    ):
+        """Return the analytical derivatives for the given system. The
+        arguments are the same as for :func:`derivatives_numerical`.
+        """
+        positions, center_indices = self.prepare_centers(system, centers)
 
-        # Make into a dense array
-        result = mbtr.todense()
+        # Centers that are not attached move independently of the atoms, which
+        # is the same as having no atom to follow.
+        if not attach:
+            center_indices = np.full(len(positions), -1, dtype=int)
 
-        return result
+        mbtr, mbtr_d = getattr(self, f"_get_k{self.k}")(
+            system, positions, center_indices, indices, return_descriptor, True
+        )
+        np.copyto(d, mbtr_d)
+        if return_descriptor:
+            np.copyto(c, mbtr)
 
     def get_number_of_features(self):
         """Used to inquire the final number of features that this descriptor
@@ -522,264 +567,168 @@ class LMBTR(DescriptorLocal):
 
         return int(n_features)
 
-    def _make_new_klist_local(self, kx_list):
-        new_kx_list = []
-
-        for item in kx_list:
-            new_kx_map = {}
-            item = dict(item)
-            for key, value in item.items():
-                new_key = tuple(int(x) for x in key.split(","))
-                new_kx_map[new_key] = np.array(value, dtype=self.dtype)
-            new_kx_list.append(new_kx_map)
-
-        return new_kx_list
-
-    def _get_k2(self, system, new_system, indices):
-        """Calculates the second order terms where the scalar mapping is the
-        inverse distance between atoms.
+    def _get_k2(
+        self,
+        system,
+        centers,
+        center_indices,
+        indices,
+        return_descriptor,
+        return_derivatives,
+    ):
+        """Calculates the second order term and/or its derivatives with
+        regard to atomic positions for the given centers.
 
         Returns:
-            1D ndarray: flattened K2 values.
+            2D ndarray: K2 values with one row per center. If
+                return_descriptor=False, returns an array of shape (0, 0).
+            4D ndarray: K2 derivatives. If return_derivatives=False, returns
+                an array of shape (0, 0, 0, 0).
         """
-        start = self.grid["min"]
-        stop = self.grid["max"]
-        n = self.grid["n"]
-        sigma = self.grid["sigma"]
-
         # Determine the weighting function and possible radial cutoff
-        radial_cutoff = None
+        r_cut = None
         parameters = {}
         if self.weighting is not None:
             weighting_function = self.weighting["function"]
-            if weighting_function == "exponential" or weighting_function == "exp":
-                scale = self.weighting["scale"]
+            if weighting_function == "exp":
                 threshold = self.weighting["threshold"]
-                if scale != 0:
-                    radial_cutoff = -math.log(threshold) / scale
-                parameters = {
-                    b"scale": self.weighting["scale"],
-                    b"threshold": self.weighting["threshold"],
-                }
+                r_cut = self.weighting.get("r_cut")
+                scale = self.weighting.get("scale")
+                if scale is not None and r_cut is None:
+                    if scale != 0:
+                        r_cut = -math.log(threshold) / scale
+                elif scale is None and r_cut is not None:
+                    scale = -math.log(threshold) / r_cut
+                parameters = {b"scale": scale, b"threshold": threshold}
+            elif weighting_function == "inverse_square":
+                r_cut = self.weighting["r_cut"]
         else:
             weighting_function = "unity"
 
-        # Determine the geometry function
-        geom_func_name = self.geometry["function"]
-
-        # Calculate extended system
-        if self.periodic:
-            centers = new_system.get_positions()
-            ext_system, cell_indices = dscribe.utils.geometry.get_extended_system(
-                system,
-                radial_cutoff,
-                centers,
-                return_cell_indices=True,
-            )
-            ext_system = System.from_atoms(ext_system)
-        else:
-            ext_system = System.from_atoms(system)
-            cell_indices = np.zeros((len(system), 3), dtype=int)
-
-        cmbtr = MBTRWrapper(
-            self.atomic_number_to_index, self._interaction_limit, cell_indices
-        )
-
-        # If radial cutoff is finite, use it to calculate the sparse distance
-        # matrix to reduce computational complexity from O(n^2) to O(n log(n)).
-        # If radial cutoff is not available, calculate full matrix.
-        n_atoms_ext = len(ext_system)
-        n_atoms_new = len(new_system)
-        ext_pos = ext_system.get_positions()
-        new_pos = new_system.get_positions()
-        if radial_cutoff is not None:
-            dmat = new_system.get_distance_matrix_within_radius(
-                radial_cutoff, pos=ext_pos
-            )
-            adj_list = dscribe.utils.geometry.get_adjacency_list(dmat)
-            dmat_dense = np.full(
-                (n_atoms_new, n_atoms_ext), sys.float_info.max
-            )  # The non-neighbor values are treated as "infinitely far".
-            dmat_dense[dmat.row, dmat.col] = dmat.data
-        else:
-            dmat_dense = scipy.spatial.distance.cdist(new_pos, ext_pos)
-            adj_list = np.tile(np.arange(n_atoms_ext), (n_atoms_new, 1))
-
-        # Form new indices that include the existing atoms and the newly added
-        # ones
-        indices = np.array(
-            np.append(
-                indices, [n_atoms_ext + i for i in range(n_atoms_new - len(indices))]
-            ),
-            dtype=int,
-        )
-
-        k2_list = cmbtr.get_k2_local(
+        return self._get_local(
+            system,
+            centers,
+            center_indices,
             indices,
-            ext_system.get_atomic_numbers(),
-            dmat_dense,
-            adj_list,
-            geom_func_name.encode(),
-            weighting_function.encode(),
+            return_descriptor,
+            return_derivatives,
+            "get_k2_local",
+            r_cut,
+            weighting_function,
             parameters,
-            start,
-            stop,
-            sigma,
-            n,
         )
-        k2_list = self._make_new_klist_local(k2_list)
-        n_elem = self.n_elements
-        n_loc = len(indices)
-        k2 = sparse.DOK((n_loc, n_elem * n), dtype=self.dtype)
-
-        for i_loc, k2_map in enumerate(k2_list):
-            for key, gaussian_sum in k2_map.items():
-                i = key[1]
-                m = i
-                start = int(m * n)
-                end = int((m + 1) * n)
-
-                # Denormalize if requested
-                if not self.normalize_gaussians:
-                    max_val = 1 / (sigma * math.sqrt(2 * math.pi))
-                    gaussian_sum /= max_val
-
-                k2[i_loc, start:end] = gaussian_sum
-        k2 = k2.to_coo()
 
-        return k2
-
-    def _get_k3(self, system, new_system, indices):
-        """Calculates the second order terms where the scalar mapping is the
-        inverse distance between atoms.
+    def _get_k3(
+        self,
+        system,
+        centers,
+        center_indices,
+        indices,
+        return_descriptor,
+        return_derivatives,
+    ):
+        """Calculates the third order term and/or its derivatives with
+        regard to atomic positions for the given centers.
 
         Returns:
-            1D ndarray: flattened K2 values.
+            2D ndarray: K3 values with one row per center. If
+                return_descriptor=False, returns an array of shape (0, 0).
+            4D ndarray: K3 derivatives. If return_derivatives=False, returns
+                an array of shape (0, 0, 0, 0).
         """
-        start = self.grid["min"]
-        stop = self.grid["max"]
-        n = self.grid["n"]
-        sigma = self.grid["sigma"]
-
         # Determine the weighting function and possible radial cutoff
-        radial_cutoff = None
+        r_cut = None
         parameters = {}
         if self.weighting is not None:
             weighting_function = self.weighting["function"]
-            if weighting_function == "exponential" or weighting_function == "exp":
-                scale = self.weighting["scale"]
+            if weighting_function == "exp":
                 threshold = self.weighting["threshold"]
-                if scale != 0:
-                    radial_cutoff = -0.5 * math.log(threshold) / scale
+                r_cut = self.weighting.get("r_cut")
+                scale = self.weighting.get("scale")
+                # If we want to limit the triplets to a distance r_cut, we need
+                # to allow x=2*r_cut in the case of k=3.
+                if scale is not None and r_cut is None:
+                    if scale != 0:
+                        r_cut = -0.5 * math.log(threshold) / scale
+                elif scale is None and r_cut is not None:
+                    scale = -0.5 * math.log(threshold) / r_cut
                 parameters = {b"scale": scale, b"threshold": threshold}
+            if weighting_function == "smooth_cutoff":
+                sharpness = self.weighting.get("sharpness", 2)
+                parameters = {
+                    b"sharpness": sharpness,
+                    b"cutoff": self.weighting["r_cut"],
+                }
+                # The smooth cutoff is applied to the distances from the middle
+                # atom. When the center is at the end of the triplet, the
+                # other end may thus be twice the cutoff away from it.
+                r_cut = 2 * self.weighting["r_cut"]
         else:
             weighting_function = "unity"
 
-        # Determine the geometry function
-        geom_func_name = self.geometry["function"]
-
-        # Calculate extended system
-        if self.periodic:
-            centers_new = new_system.get_positions()
-            centers_existing = system.get_positions()[indices]
-            centers = np.concatenate((centers_new, centers_existing), axis=0)
-            ext_system, cell_indices = dscribe.utils.geometry.get_extended_system(
-                system,
-                radial_cutoff,
-                centers,
-                return_cell_indices=True,
-            )
-            ext_system = System.from_atoms(ext_system)
-        else:
-            ext_system = System.from_atoms(system)
-            cell_indices = np.zeros((len(system), 3), dtype=int)
-
-        cmbtr = MBTRWrapper(
-            self.atomic_number_to_index, self._interaction_limit, cell_indices
+        return self._get_local(
+            system,
+            centers,
+            center_indices,
+            indices,
+            return_descriptor,
+            return_derivatives,
+            "get_k3_local",
+            r_cut,
+            weighting_function,
+            parameters,
         )
 
-        # If radial cutoff is finite, use it to calculate the sparse
-        # distance matrix to reduce computational complexity from O(n^2) to
-        # O(n log(n))
-        fin_system = ext_system + new_system
-        n_atoms_ext = len(ext_system)
-        n_atoms_fin = len(fin_system)
-        n_atoms_new = len(new_system)
-        ext_pos = ext_system.get_positions()
-        new_pos = new_system.get_positions()
-        if radial_cutoff is not None:
-            # Calculate distance within the extended system
-            dmat_ext_to_ext = ext_system.get_distance_matrix_within_radius(
-                radial_cutoff, pos=ext_pos
-            )
-            col = dmat_ext_to_ext.col
-            row = dmat_ext_to_ext.row
-            data = dmat_ext_to_ext.data
-            dmat = scipy.sparse.coo_matrix(
-                (data, (row, col)), shape=(n_atoms_fin, n_atoms_fin)
-            )
+    def _get_local(
+        self,
+        system,
+        centers,
+        center_indices,
+        indices,
+        return_descriptor,
+        return_derivatives,
+        function_name,
+        r_cut,
+        weighting_function,
+        parameters,
+    ):
+        """Calls the given function of the C++ extension that fills in the
+        descriptor and/or the derivatives for the k-term.
+        """
+        start = self.grid["min"]
+        stop = self.grid["max"]
+        n = self.grid["n"]
+        sigma = self.grid["sigma"]
+        n_features = self.get_number_of_features()
+        n_centers = len(centers)
 
-            # Calculate the distances from the new positions to atoms in the
-            # extended system using the cutoff
-            if len(new_pos) != 0:
-                dmat_ext_to_new = ext_system.get_distance_matrix_within_radius(
-                    radial_cutoff, pos=new_pos
-                )
-                col = dmat_ext_to_new.col
-                row = dmat_ext_to_new.row
-                data = dmat_ext_to_new.data
-                dmat.col = np.append(dmat.col, col + n_atoms_ext)
-                dmat.row = np.append(dmat.row, row)
-                dmat.data = np.append(dmat.data, data)
-                dmat.col = np.append(dmat.col, row)
-                dmat.row = np.append(dmat.row, col + n_atoms_ext)
-                dmat.data = np.append(dmat.data, data)
-
-            # Calculate adjacencies and transform to the dense matrix for
-            # sending information to C++
-            adj_list = dscribe.utils.geometry.get_adjacency_list(dmat)
-            dmat_dense = np.full(
-                (n_atoms_fin, n_atoms_fin), sys.float_info.max
-            )  # The non-neighbor values are treated as "infinitely far".
-            dmat_dense[dmat.row, dmat.col] = dmat.data
-
-        # If no weighting is used, the full distance matrix is calculated
+        if return_descriptor:
+            mbtr = np.zeros((n_centers, n_features), dtype=np.float64)
         else:
-            dmat = scipy.sparse.lil_matrix((n_atoms_fin, n_atoms_fin))
-
-            # Fill in block for extended system
-            dmat_ext_to_ext = ext_system.get_distance_matrix()
-            dmat[0:n_atoms_ext, 0:n_atoms_ext] = dmat_ext_to_ext
-
-            # Fill in block for extended system to new system
-            dmat_ext_to_new = scipy.spatial.distance.cdist(ext_pos, new_pos)
-            dmat[
-                0:n_atoms_ext, n_atoms_ext : n_atoms_ext + n_atoms_new
-            ] = dmat_ext_to_new
-            dmat[
-                n_atoms_ext : n_atoms_ext + n_atoms_new, 0:n_atoms_ext
-            ] = dmat_ext_to_new.T
-
-            # Calculate adjacencies and the dense version
-            dmat = dmat.tocoo()
-            adj_list = dscribe.utils.geometry.get_adjacency_list(dmat)
-            dmat_dense = np.full(
-                (n_atoms_fin, n_atoms_fin), sys.float_info.max
-            )  # The non-neighbor values are treated as "infinitely far".
-            dmat_dense[dmat.row, dmat.col] = dmat.data
-
-        # Form new indices that include the existing atoms and the newly added
-        # ones
-        indices = np.array(
-            np.append(indices, [n_atoms_ext + i for i in range(n_atoms_new)]), dtype=int
-        )
+            mbtr = np.zeros((0, 0), dtype=np.float64)
 
-        k3_list = cmbtr.get_k3_local(
-            indices,
-            fin_system.get_atomic_numbers(),
-            dmat_dense,
-            adj_list,
-            geom_func_name.encode(),
+        if return_derivatives:
+            mbtr_d = np.zeros(
+                (n_centers, len(indices), 3, n_features), dtype=np.float64
+            )
+        else:
+            mbtr_d = np.zeros((0, 0, 0, 0), dtype=np.float64)
+
+        cmbtr = MBTRWrapper(self.atomic_number_to_index, self._interaction_limit)
+        getattr(cmbtr, function_name)(
+            mbtr,
+            mbtr_d,
+            return_descriptor,
+            return_derivatives,
+            system.get_positions(),
+            system.get_atomic_numbers(),
+            np.asarray(system.get_cell()),
+            system.get_pbc() if self.periodic else np.zeros(3, dtype=bool),
+            np.asarray(centers, dtype=np.float64),
+            np.asarray(center_indices, dtype=int),
+            np.asarray(indices, dtype=int),
+            -1 if r_cut is None else r_cut,
+            self.geometry["function"].encode(),
             weighting_function.encode(),
             parameters,
             start,
@@ -788,41 +737,13 @@ class LMBTR(DescriptorLocal):
             n,
         )
 
-        k3_list = self._make_new_klist_local(k3_list)
-
-        n_elem = self.n_elements
-        n_loc = len(indices)
-        k3 = sparse.DOK(
-            (n_loc, int((n_elem * (3 * n_elem - 1) * n / 2))), dtype=self.dtype
-        )
-
-        for i_loc, k3_map in enumerate(k3_list):
-            for key, gaussian_sum in k3_map.items():
-                i = key[0]
-                j = key[1]
-                k = key[2]
-
-                # This is the index of the spectrum. It is given by enumerating the
-                # elements of a three-dimensional array and only considering
-                # elements for which k>=i and i || j == 0. The enumeration begins
-                # from [0, 0, 0], and ends at [n_elem, n_elem, n_elem], looping the
-                # elements in the order k, i, j.
-                if j == 0:
-                    m = k + i * n_elem - i * (i + 1) / 2
-                else:
-                    m = n_elem * (n_elem + 1) / 2 + (j - 1) * n_elem + k
-                start = int(m * n)
-                end = int((m + 1) * n)
-
-                # Denormalize if requested
-                if not self.normalize_gaussians:
-                    max_val = 1 / (sigma * math.sqrt(2 * math.pi))
-                    gaussian_sum /= max_val
-
-                k3[i_loc, start:end] = gaussian_sum
-        k3 = k3.to_coo()
+        # Denormalize if requested
+        if not self.normalize_gaussians:
+            max_val = 1 / (sigma * math.sqrt(2 * math.pi))
+            mbtr /= max_val
+            mbtr_d /= max_val
 
-        return k3
+        return (mbtr, mbtr_d)
 
     def get_location(self, species):
         """Can be used to query the location of a species combination in the
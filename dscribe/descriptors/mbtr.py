@@ -13,17 +13,14 @@ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 See the License for the specific language governing permissions and
 limitations under the License.
 """
-import sys
 import math
 import numpy as np
 
 from ase import Atoms
 import ase.data
 
-from dscribe.core import System
 from dscribe.descriptors.descriptorglobal import DescriptorGlobal
 from dscribe.ext import MBTRWrapper
-import dscribe.utils.geometry
 
 
 k1_geometry_functions = set(["atomic_number"])
@@ -346,7 +343,9 @@ class MBTR(DescriptorGlobal):
             )
         self._normalization = value
 
-    def create(self, system, n_jobs=1, only_physical_cores=False, verbose=False):
+    def create(
+        self, system, n_jobs=1, only_physical_cores=False, verbose=False, out=None
+    ):
         """Return MBTR output for the given systems.
 
         Args:
@@ -363,6 +362,12 @@ class MBTR(DescriptorGlobal):
                 are counted.  If set to True, only physical CPUs are counted.
             verbose(bool): Controls whether to print the progress of each job
                 into to the console.
+            out (array-like): Preallocated array, e.g. a np.memmap, into
+                which the output of multiple systems is written by the jobs
+                as it is created. It must have the shape of the returned
+                array and requires dense output with the same shape for every
+                system. With process parallelization only memory mapped
+                arrays are shared with the processes.
 
         Returns:
             np.ndarray | sparse.COO: MBTR for the given systems. The return type
@@ -383,6 +388,7 @@ class MBTR(DescriptorGlobal):
             static_size,
             only_physical_cores,
             verbose=verbose,
+            out=out,
         )
 
         return output
@@ -541,11 +547,7 @@ class MBTR(DescriptorGlobal):
             # Determine the geometry function
             geom_func_name = self.geometry["function"]
 
-            cmbtr = MBTRWrapper(
-                self.atomic_number_to_index,
-                self._interaction_limit,
-                np.zeros((len(system), 3), dtype=int),
-            )
+            cmbtr = MBTRWrapper(self.atomic_number_to_index, self._interaction_limit)
 
             k1 = np.zeros((n_features), dtype=np.float64)
             cmbtr.get_k1(
@@ -616,36 +618,7 @@ class MBTR(DescriptorGlobal):
         # Determine the geometry function
         geom_func_name = self.geometry["function"]
 
-        # If needed, create the extended system
-        if self.periodic:
-            centers = system.get_positions()
-            ext_system, cell_indices = dscribe.utils.geometry.get_extended_system(
-                system, r_cut, centers, return_cell_indices=True
-            )
-            ext_system = System.from_atoms(ext_system)
-        else:
-            ext_system = System.from_atoms(system)
-            cell_indices = np.zeros((len(system), 3), dtype=int)
-
-        cmbtr = MBTRWrapper(
-            self.atomic_number_to_index, self._interaction_limit, cell_indices
-        )
-
-        # If radial cutoff is finite, use it to calculate the sparse
-        # distance matrix to reduce computational complexity from O(n^2) to
-        # O(n log(n))
-        n_atoms = len(ext_system)
-        if r_cut is not None:
-            dmat = ext_system.get_distance_matrix_within_radius(r_cut)
-            adj_list = dscribe.utils.geometry.get_adjacency_list(dmat)
-            dmat_dense = np.full(
-                (n_atoms, n_atoms), sys.float_info.max
-            )  # The non-neighbor values are treated as "infinitely far".
-            dmat_dense[dmat.row, dmat.col] = dmat.data
-        # If no weighting is used, the full distance matrix is calculated
-        else:
-            dmat_dense = ext_system.get_distance_matrix()
-            adj_list = np.tile(np.arange(n_atoms), (n_atoms, 1))
+        cmbtr = MBTRWrapper(self.atomic_number_to_index, self._interaction_limit)
 
         n_elem = self.n_elements
         n_features = int((n_elem * (n_elem + 1) / 2) * n)
@@ -666,10 +639,11 @@ class MBTR(DescriptorGlobal):
             k2_d,
             return_descriptor,
             return_derivatives,
-            ext_system.get_atomic_numbers(),
-            ext_system.get_positions(),
-            dmat_dense,
-            adj_list,
+            system.get_positions(),
+            system.get_atomic_numbers(),
+            np.asarray(system.get_cell()),
+            system.get_pbc() if self.periodic else np.zeros(3, dtype=bool),
+            -1 if r_cut is None else r_cut,
             geom_func_name.encode(),
             weighting_function.encode(),
             parameters,
@@ -774,33 +748,7 @@ class MBTR(DescriptorGlobal):
         # Determine the geometry function
         geom_func_name = self.geometry["function"]
 
-        # If needed, create the extended system
-        if self.periodic:
-            centers = system.get_positions()
-            ext_system, cell_indices = dscribe.utils.geometry.get_extended_system(
-                system, r_cut, centers, return_cell_indices=True
-            )
-            ext_system = System.from_atoms(ext_system)
-        else:
-            ext_system = System.from_atoms(system)
-            cell_indices = np.zeros((len(system), 3), dtype=int)
-
-        cmbtr = MBTRWrapper(
-            self.atomic_number_to_index, self._interaction_limit, cell_indices
-        )
-
-        n_atoms = len(ext_system)
-        if r_cut is not None:
-            dmat = ext_system.get_distance_matrix_within_radius(r_cut)
-            adj_list = dscribe.utils.geometry.get_adjacency_list(dmat)
-            dmat_dense = np.full(
-                (n_atoms, n_atoms), sys.float_info.max
-            )  # The non-neighbor values are treated as "infinitely far".
-            dmat_dense[dmat.col, dmat.row] = dmat.data
-        # If no weighting is used, the full distance matrix is calculated
-        else:
-            dmat_dense = ext_system.get_distance_matrix()
-            adj_list = np.tile(np.arange(n_atoms), (n_atoms, 1))
+        cmbtr = MBTRWrapper(self.atomic_number_to_index, self._interaction_limit)
 
         n_elem = self.n_elements
         n_features = int((n_elem * n_elem * (n_elem + 1) / 2) * n)
@@ -821,10 +769,11 @@ class MBTR(DescriptorGlobal):
             k3_d,
             return_descriptor,
             return_derivatives,
-            ext_system.get_atomic_numbers(),
-            ext_system.get_positions(),
-            dmat_dense,
-            adj_list,
+            system.get_positions(),
+            system.get_atomic_numbers(),
+            np.asarray(system.get_cell()),
+            system.get_pbc() if self.periodic else np.zeros(3, dtype=bool),
+            -1 if r_cut is None else r_cut,
             geom_func_name.encode(),
             weighting_function.encode(),
             parameters,
@@ -17,9 +17,10 @@ import numpy as np
 
 from ase import Atoms
 
-from dscribe.core import System
 from dscribe.descriptors.descriptormatrix import DescriptorMatrix
 
+import dscribe.ext
+
 
 class SineMatrix(DescriptorMatrix):
     """Calculates the zero padded Sine matrix for different systems.
@@ -45,7 +46,31 @@ class SineMatrix(DescriptorMatrix):
         https://doi.org/10.1002/qua.24917
     """
 
-    def create(self, system, n_jobs=1, only_physical_cores=False, verbose=False):
+    def __init__(
+        self,
+        n_atoms_max,
+        permutation="sorted_l2",
+        sigma=None,
+        seed=None,
+        sparse=False,
+    ):
+        super().__init__(
+            n_atoms_max,
+            permutation,
+            sigma,
+            seed,
+            sparse,
+        )
+        self.wrapper = dscribe.ext.SineMatrix(
+            n_atoms_max,
+            permutation,
+            0 if sigma is None else sigma,
+            0 if seed is None else seed,
+        )
+
+    def create(
+        self, system, n_jobs=1, only_physical_cores=False, verbose=False, out=None
+    ):
         """Return the Sine matrix for the given systems.
 
         Args:
@@ -63,6 +88,12 @@ class SineMatrix(DescriptorMatrix):
                 are counted.  If set to True, only physical CPUs are counted.
             verbose(bool): Controls whether to print the progress of each job
                 into to the console.
+            out (array-like): Preallocated array, e.g. a np.memmap, into
+                which the output of multiple systems is written by the jobs
+                as it is created. It must have the shape of the returned
+                array and requires dense output with the same shape for every
+                system. With process parallelization only memory mapped
+                arrays are shared with the processes.
 
         Returns:
             np.ndarray | sparse.COO: Sine matrix for the given systems. The
@@ -91,51 +122,88 @@ class SineMatrix(DescriptorMatrix):
             static_size,
             only_physical_cores,
             verbose=verbose,
+            out=out,
         )
 
         return output
 
-    def get_matrix(self, system):
-        """Creates the Sine matrix for the given system.
-
+    def create_single(self, system):
+        """
         Args:
-            system (:class:`ase.Atoms` | :class:`.System`): Input system.
+            system (:class:`ase.Atoms`): Input system.
 
         Returns:
-            np.ndarray: Sine matrix as a 2D array.
+            ndarray: The zero padded matrix as a flattened 1D array.
         """
-        # Force the use of periodic boundary conditions
-        system = System.from_atoms(system)
-        system.set_pbc(True)
-
-        # Cell and inverse cell
-        B = system.get_cell()
-        try:
-            B_inv = system.get_cell_inverse()
-        except:
-            raise ValueError(
-                "The given system has a non-invertible cell matrix: {}.".format(B)
-            )
-
-        # Difference vectors as a 3D tensor
-        diff_tensor = system.get_displacement_tensor()
-
-        # Calculate phi
-        arg_to_sin = np.pi * np.dot(diff_tensor, B_inv)
-        phi = np.linalg.norm(np.dot(np.sin(arg_to_sin) ** 2, B), axis=2)
-
-        with np.errstate(divide="ignore"):
-            phi = np.reciprocal(phi)
+        # Initialize output array in dense format.
+        out_des = np.zeros((self.get_number_of_features()), dtype=np.float64)
+
+        # Calculate with C++ extension
+        pos, Z, cell, pbc = self.get_system_arrays(system)
+        self.wrapper.create(out_des, pos, Z, cell, pbc)
+
+        return out_des
+
+    def derivatives_numerical(
+        self,
+        d,
+        c,
+        system,
+        indices,
+        return_descriptor=True,
+        stencil_order=2,
+    ):
+        """Return the numerical derivatives for the given system.
+        Args:
+            system (:class:`ase.Atoms`): Atomic structure.
+            indices (list): Indices of atoms for which the derivatives will be
+                computed for.
+            return_descriptor (bool): Whether to also calculate the descriptor
+                in the same function call. This is true by default as it
+                typically is faster to calculate both in one go.
+            stencil_order (int): Order of the finite difference stencil,
+                either 2 or 4.
+        Returns:
+            If return_descriptor is True, returns a tuple, where the first item
+            is the derivative array and the second is the descriptor array.
+            Otherwise only returns the derivatives array. The derivatives array
+            is a 3D numpy array. The dimensions are: [n_atoms, 3, n_features].
+            The first dimension goes over the included atoms. The order is same
+            as the order of atoms in the given system. The second dimension
+            goes over the cartesian components, x, y and z. The last dimension
+            goes over the features in the default order.
+        """
+        pos, Z, cell, pbc = self.get_system_arrays(system)
+        self.wrapper.derivatives_numerical(
+            d,
+            c,
+            pos,
+            Z,
+            cell,
+            pbc,
+            indices,
+            return_descriptor,
+            stencil_order,
+        )
 
-        # Calculate Z_i*Z_j
-        q = system.get_atomic_numbers()
-        qiqj = q[None, :] * q[:, None]
-        np.fill_diagonal(phi, 0)
+    def get_system_arrays(self, system):
+        """Returns the arrays that are passed to the C++ extension. The
+        system is always treated as periodic.
 
-        # Multiply by charges
-        smat = qiqj * phi
+        Args:
+            system (:class:`ase.Atoms`): Input system.
 
-        # Set diagonal
-        np.fill_diagonal(smat, 0.5 * q**2.4)
+        Returns:
+            tuple: The positions, atomic numbers, cell and periodic boundary
+            conditions.
+        """
+        cell = np.array(system.get_cell(), dtype=np.float64)
+        if np.linalg.matrix_rank(cell) < 3:
+            raise ValueError(
+                "The given system has a non-invertible cell matrix: {}.".format(cell)
+            )
+        pos = system.get_positions()
+        Z = system.get_atomic_numbers()
+        pbc = np.ones(3, dtype=bool)
 
-        return smat
+        return pos, Z, cell, pbc
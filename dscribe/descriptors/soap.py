@@ -14,6 +14,7 @@ See the License for the specific language governing permissions and
 limitations under the License.
 """
 import numpy as np
+import sparse as sp
 
 from scipy.special import gamma
 from scipy.linalg import sqrtm, inv
@@ -262,10 +263,10 @@ class SOAP(DescriptorLocal):
         # Test l_max
         if l_max < 0:
             raise ValueError("l_max cannot be negative. l_max={}".format(l_max))
-        elif l_max > 20:
+        elif l_max > 20 and rbf == "polynomial":
             raise ValueError(
-                "The maximum available l_max for SOAP is currently 20, you have"
-                " requested l_max={}".format(l_max)
+                "The maximum available l_max for the polynomial basis is "
+                "currently 20, you have requested l_max={}".format(l_max)
             )
 
         self._r_cut = float(r_cut)
@@ -327,6 +328,66 @@ class SOAP(DescriptorLocal):
         cutoff_padding = self._sigma * np.sqrt(-2 * np.log(threshold))
         return cutoff_padding
 
+    def get_extension(self):
+        """Returns the C++ extension object for the current settings. The
+        object is reused between calls while the settings stay the same, as
+        the polynomial basis tabulates its radial integrals when the object is
+        created.
+        """
+        key = (
+            self._rbf,
+            self.crossover,
+            self.average,
+            self.periodic,
+            tuple(self._atomic_numbers),
+        )
+        cached = getattr(self, "_extension", None)
+        if cached is not None and cached[0] == key:
+            return cached[1]
+
+        cutoff_padding = self.get_cutoff_padding()
+        if self._rbf == "gto":
+            extension = dscribe.ext.SOAPGTO(
+                self._r_cut,
+                self._n_max,
+                self._l_max,
+                self._eta,
+                self._weighting,
+                self.crossover,
+                self.average,
+                cutoff_padding,
+                self._alphas.flatten(),
+                self._betas.flatten(),
+                self._atomic_numbers,
+                self.periodic,
+            )
+        elif self._rbf == "polynomial":
+            rx, gss = self.get_basis_poly(self._r_cut, self._n_max)
+            extension = dscribe.ext.SOAPPolynomial(
+                self._r_cut,
+                self._n_max,
+                self._l_max,
+                self._eta,
+                self._weighting,
+                self.crossover,
+                self.average,
+                cutoff_padding,
+                rx,
+                gss.flatten(),
+                self._atomic_numbers,
+                self.periodic,
+            )
+        self._extension = (key, extension)
+        return extension
+
+    def __getstate__(self):
+        """The C++ extension object cannot be pickled, so it is created again
+        after unpickling.
+        """
+        state = self.__dict__.copy()
+        state.pop("_extension", None)
+        return state
+
     def _infer_r_cut(self, weighting):
         """Used to determine an appropriate r_cut based on where the given
         weighting function setup.
@@ -353,8 +414,13 @@ class SOAP(DescriptorLocal):
             return None
 
     def init_internal_dev_array(self, n_centers, n_atoms, n_types, n, l_max):
+        # The polynomial basis stores the real and imaginary parts of the
+        # coefficients with m >= 0.
+        n_coeffs = (l_max + 1) * (l_max + 1)
+        if self._rbf == "polynomial":
+            n_coeffs *= 2
         d = np.zeros(
-            (n_atoms, n_centers, n_types, n, (l_max + 1) * (l_max + 1)),
+            (n_atoms, n_centers, n_types, n, n_coeffs),
             dtype=np.float64,
         )
         return d
@@ -366,7 +432,13 @@ class SOAP(DescriptorLocal):
         return d
 
     def create(
-        self, system, centers=None, n_jobs=1, only_physical_cores=False, verbose=False
+        self,
+        system,
+        centers=None,
+        n_jobs=1,
+        only_physical_cores=False,
+        verbose=False,
+        out=None,
     ):
         """Return the SOAP output for the given systems and given centers.
 
@@ -390,6 +462,12 @@ class SOAP(DescriptorLocal):
                 are counted.  If set to True, only physical CPUs are counted.
             verbose(bool): Controls whether to print the progress of each job
                 into to the console.
+            out (array-like): Preallocated array, e.g. a np.memmap, into
+                which the output of multiple systems is written by the jobs
+                as it is created. It must have the shape of the returned
+                array and requires dense output with the same shape for every
+                system. With process parallelization only memory mapped
+                arrays are shared with the processes.
 
         Returns:
             np.ndarray | sparse.COO: The SOAP output for the given systems and
@@ -448,6 +526,13 @@ class SOAP(DescriptorLocal):
             if is_static():
                 static_size = [n_centers, n_features]
 
+        # Without process parallelization all systems are handled by a single
+        # call to the extension, which avoids the per-system overhead. The
+        # extension can also write directly into a preallocated numpy array.
+        is_native = out is None or self.is_native_output(out, (np.float32, np.float64))
+        if n_jobs == 1 and n_samples > 1 and not verbose and is_native:
+            return self.create_batch(system, centers, out=out)
+
         # Create in parallel
         output = self.create_parallel(
             inp,
@@ -456,10 +541,103 @@ class SOAP(DescriptorLocal):
             static_size,
             only_physical_cores,
             verbose=verbose,
+            out=out,
         )
 
         return output
 
+    def create_batch(self, systems, centers=None, out=None):
+        """Return the SOAP output for multiple systems with a single call to
+        the C++ extension. The extension can divide the systems between
+        native threads, see :func:`dscribe.ext.set_num_threads`.
+
+        Args:
+            systems (list of :class:`ase.Atoms`): The atomic structures.
+            centers (list): Centers for each system, see :func:`create`.
+            out (array-like): Preallocated array for the output, see
+                :func:`create`. The extension writes directly into
+                C-contiguous numpy arrays of the requested dtype.
+
+        Returns:
+            np.ndarray | sparse.COO | list: The SOAP output in the same format
+            as returned by :func:`create` for multiple systems.
+        """
+        n_samples = len(systems)
+        if centers is None:
+            centers = [None] * n_samples
+        if len(centers) != n_samples:
+            raise ValueError(
+                "The given number of centers does not match the given "
+                "number of systems."
+            )
+
+        # Concatenate the systems and store where each of them starts
+        positions = []
+        atomic_numbers = []
+        cells = np.empty((n_samples, 3, 3), dtype=np.float64)
+        pbc = np.empty((n_samples, 3), dtype=bool)
+        all_centers = []
+        atom_offsets = np.zeros(n_samples + 1, dtype=np.int32)
+        center_offsets = np.zeros(n_samples + 1, dtype=np.int32)
+        for i, (i_sys, i_centers) in enumerate(zip(systems, centers)):
+            i_centers, _ = self.prepare_centers(i_sys, i_centers)
+            positions.append(i_sys.get_positions())
+            atomic_numbers.append(i_sys.get_atomic_numbers())
+            cells[i] = ase.geometry.cell.complete_cell(i_sys.get_cell())
+            pbc[i] = i_sys.get_pbc()
+            all_centers.append(np.reshape(i_centers, (-1, 3)))
+            atom_offsets[i + 1] = atom_offsets[i] + len(i_sys)
+            center_offsets[i + 1] = center_offsets[i] + len(i_centers)
+
+        n_features = self.get_number_of_features()
+        n_rows = n_samples if self.average != "off" else center_offsets[-1]
+        n_centers = np.diff(center_offsets)
+        if out is not None:
+            if self.average != "off":
+                shape = (n_samples, n_features)
+            elif np.all(n_centers == n_centers[0]):
+                shape = (n_samples, n_centers[0], n_features)
+            else:
+                shape = None
+            (out,) = self.check_output(out, [shape])
+        is_native = out is not None and self.is_native_output(
+            out, (np.float32, np.float64)
+        )
+        if is_native:
+            soap_mat = out.reshape(n_rows, n_features)
+            soap_mat[...] = 0
+        else:
+            soap_mat = np.zeros((n_rows, n_features), dtype=self.get_native_dtype())
+        soap_ext = self.get_extension()
+        soap_ext.create_batch(
+            soap_mat,
+            np.concatenate(positions),
+            np.concatenate(atomic_numbers),
+            atom_offsets,
+            cells,
+            pbc,
+            np.concatenate(all_centers),
+            center_offsets,
+        )
+
+        if out is not None:
+            if not is_native:
+                out[...] = self.format_array(soap_mat.reshape(out.shape))
+            self.flush_output((out,))
+            return out
+
+        # Averaged outputs and outputs with the same number of centers for
+        # each system are returned as a single array, otherwise as a list.
+        if self.average != "off":
+            return self.format_array(soap_mat)
+        if np.all(n_centers == n_centers[0]):
+            soap_mat = soap_mat.reshape(n_samples, n_centers[0], n_features)
+            return self.format_array(soap_mat)
+        return [
+            self.format_array(soap_mat[start:end])
+            for start, end in zip(center_offsets[:-1], center_offsets[1:])
+        ]
+
     def create_single(self, system, centers=None):
         """Return the SOAP output for the given system and given centers.
 
@@ -477,73 +655,21 @@ class SOAP(DescriptorLocal):
             centers and the second dimension is determined by the
             get_number_of_features()-function.
         """
-        cutoff_padding = self.get_cutoff_padding()
         centers, _ = self.prepare_centers(system, centers)
         n_centers = centers.shape[0]
         pos = system.get_positions()
         Z = system.get_atomic_numbers()
-        soap_mat = self.init_descriptor_array(n_centers)
-
-        # Determine the function to call based on rbf
-        if self._rbf == "gto":
-            # Orthonormalized RBF coefficients
-            alphas = self._alphas.flatten()
-            betas = self._betas.flatten()
-
-            # Calculate with extension
-            soap_gto = dscribe.ext.SOAPGTO(
-                self._r_cut,
-                self._n_max,
-                self._l_max,
-                self._eta,
-                self._weighting,
-                self.crossover,
-                self.average,
-                cutoff_padding,
-                alphas,
-                betas,
-                self._atomic_numbers,
-                self.periodic,
-            )
-
-            # Calculate analytically with extension
-            soap_gto.create(
-                soap_mat,
-                pos,
-                Z,
-                ase.geometry.cell.complete_cell(system.get_cell()),
-                np.asarray(system.get_pbc(), dtype=bool),
-                centers,
-            )
-        elif self._rbf == "polynomial":
-            # Get the discretized and orthogonalized polynomial radial basis
-            # function values
-            rx, gss = self.get_basis_poly(self._r_cut, self._n_max)
-            gss = gss.flatten()
+        soap_mat = self.init_descriptor_array(n_centers, self.get_native_dtype())
 
-            # Calculate with extension
-            soap_poly = dscribe.ext.SOAPPolynomial(
-                self._r_cut,
-                self._n_max,
-                self._l_max,
-                self._eta,
-                self._weighting,
-                self.crossover,
-                self.average,
-                cutoff_padding,
-                rx,
-                gss,
-                self._atomic_numbers,
-                self.periodic,
-            )
-            soap_poly.create(
-                soap_mat,
-                pos,
-                Z,
-                ase.geometry.cell.complete_cell(system.get_cell()),
-                np.asarray(system.get_pbc(), dtype=bool),
-                centers,
-            )
+        # Calculate with extension
+        self.get_extension().create(
+            soap_mat,
+            pos,
+            Z,
+            ase.geometry.cell.complete_cell(system.get_cell()),
+            np.asarray(system.get_pbc(), dtype=bool),
+            centers,
+        )
 
         # Averaged output is a global descriptor, and thus the first dimension
         # is squeezed out to keep the output size consistent with the size of
@@ -553,6 +679,85 @@ class SOAP(DescriptorLocal):
 
         return soap_mat
 
+    def create_trajectory(
+        self, frames, centers=None, skin=0.5, tolerance=0, return_stats=False
+    ):
+        """Return the SOAP output for consecutive frames of a trajectory.
+
+        The neighbours are searched from a Verlet list that is only rebuilt
+        when an atom or a center has moved more than half of the skin since
+        the previous rebuild, or when the atoms, the cell or the periodicity
+        change. Atoms that are wrapped back into the cell are followed with
+        the minimum image convention, so the atoms should move less than half
+        of the cell between consecutive frames.
+
+        Args:
+            frames (iterable of :class:`ase.Atoms`): The frames in the order
+                of the trajectory. Can also be a generator that reads the
+                frames one by one.
+            centers (list): Centers where to calculate SOAP in every frame,
+                given as atomic indices or cartesian positions, see
+                :func:`create`. If no centers are defined, the SOAP output
+                will be created for all atoms.
+            skin (float): Distance by which the Verlet list extends the
+                cutoff.
+            tolerance (float): If positive, the output of a center is reused
+                from the frame in which it was last calculated as long as it
+                has the same neighbours and none of their displacements from
+                the center has changed by more than the tolerance. Only
+                supported without averaging.
+            return_stats (bool): Whether to also return how often the Verlet
+                list was rebuilt and how many centers were calculated.
+
+        Returns:
+            np.ndarray | sparse.COO | list: The SOAP output for each frame in
+            the same format as returned by :func:`create` for multiple
+            systems. If return_stats is True, a dictionary with the number of
+            frames ("n_frames"), the number of rebuilds of the Verlet list
+            ("n_rebuilds") and the number of centers whose output was
+            calculated instead of reused ("n_computed_centers") is also
+            returned.
+        """
+        if skin < 0:
+            raise ValueError("The skin cannot be negative.")
+        if tolerance > 0 and self.average != "off":
+            raise ValueError(
+                "The output of the centers can only be reused without averaging."
+            )
+        trajectory = dscribe.ext.Trajectory(self.get_extension(), skin, tolerance)
+        outputs = []
+        for frame in frames:
+            i_centers, _ = self.prepare_centers(frame, centers)
+            soap_mat = self.init_descriptor_array(i_centers.shape[0])
+            trajectory.create(
+                soap_mat,
+                frame.get_positions(),
+                frame.get_atomic_numbers(),
+                ase.geometry.cell.complete_cell(frame.get_cell()),
+                np.asarray(frame.get_pbc(), dtype=bool),
+                np.reshape(i_centers, (-1, 3)),
+            )
+            outputs.append(soap_mat)
+
+        n_centers = [len(output) for output in outputs]
+        if self.average != "off":
+            output = self.format_array(np.concatenate(outputs))
+        elif len(set(n_centers)) <= 1:
+            n_features = self.get_number_of_features()
+            soap_mat = np.reshape(outputs, (len(outputs), -1, n_features))
+            output = self.format_array(soap_mat)
+        else:
+            output = [self.format_array(output) for output in outputs]
+
+        if return_stats:
+            stats = {
+                "n_frames": trajectory.n_frames,
+                "n_rebuilds": trajectory.n_rebuilds,
+                "n_computed_centers": trajectory.n_computed_centers,
+            }
+            return output, stats
+        return output
+
     def validate_derivatives_method(self, method, attach):
         """Used to validate and determine the final method for calculating the
         derivatives.
@@ -567,18 +772,10 @@ class SOAP(DescriptorLocal):
 
         # Check if analytical derivatives can be used
         try:
-            if self._rbf == "polynomial":
+            if self.average != "off" and self._rbf == "polynomial":
                 raise ValueError(
-                    "Analytical derivatives not currently available for polynomial "
-                    "radial basis set."
-                )
-            if self.average != "off":
-                raise ValueError(
-                    "Analytical derivatives not currently available for averaged output."
-                )
-            if self.periodic:
-                raise ValueError(
-                    "Analytical derivatives are currently not available for periodic systems."
+                    "Analytical derivatives not currently available for averaged "
+                    "output with the polynomial basis."
                 )
         except Exception as e:
             if method == "analytical":
@@ -591,6 +788,23 @@ class SOAP(DescriptorLocal):
 
         return method
 
+    def has_native_sparse_derivatives(self, method):
+        """The analytical derivatives of the GTO basis are created directly in
+        the sparse format when no averaging is used: only the atoms within the
+        cutoff of a center contribute to its derivatives.
+        """
+        return method == "analytical" and self._rbf == "gto" and self.average == "off"
+
+    def get_native_dtype(self, method=None):
+        """The GTO basis writes the output and the analytical derivatives
+        directly in single precision when float32 output is requested. The
+        internal calculation is done in double precision.
+        """
+        gto = self._rbf == "gto"
+        if self.dtype == "float32" and gto and method in {None, "analytical"}:
+            return np.float32
+        return np.float64
+
     def derivatives_numerical(
         self,
         d,
@@ -600,6 +814,7 @@ class SOAP(DescriptorLocal):
         indices,
         attach,
         return_descriptor=True,
+        stencil_order=2,
     ):
         """Return the numerical derivatives for the given system.
         Args:
@@ -609,6 +824,8 @@ class SOAP(DescriptorLocal):
             return_descriptor (bool): Whether to also calculate the descriptor
                 in the same function call. This is true by default as it
                 typically is faster to calculate both in one go.
+            stencil_order (int): Order of the finite difference stencil,
+                either 2 or 4.
         Returns:
             If return_descriptor is True, returns a tuple, where the first item
             is the derivative array and the second is the descriptor array.
@@ -623,73 +840,23 @@ class SOAP(DescriptorLocal):
         Z = system.get_atomic_numbers()
         cell = ase.geometry.cell.complete_cell(system.get_cell())
         pbc = np.asarray(system.get_pbc(), dtype=bool)
-        cutoff_padding = self.get_cutoff_padding()
         centers, center_indices = self.prepare_centers(system, centers)
 
-        if self._rbf == "gto":
-            alphas = self._alphas.flatten()
-            betas = self._betas.flatten()
-            soap_gto = dscribe.ext.SOAPGTO(
-                self._r_cut,
-                self._n_max,
-                self._l_max,
-                self._eta,
-                self._weighting,
-                self.crossover,
-                self.average,
-                cutoff_padding,
-                alphas,
-                betas,
-                self._atomic_numbers,
-                self.periodic,
-            )
-
-            # Calculate numerically with extension
-            soap_gto.derivatives_numerical(
-                d,
-                c,
-                pos,
-                Z,
-                cell,
-                pbc,
-                centers,
-                center_indices,
-                indices,
-                attach,
-                return_descriptor,
-            )
-        elif self._rbf == "polynomial":
-            rx, gss = self.get_basis_poly(self._r_cut, self._n_max)
-            gss = gss.flatten()
-
-            # Calculate numerically with extension
-            soap_poly = dscribe.ext.SOAPPolynomial(
-                self._r_cut,
-                self._n_max,
-                self._l_max,
-                self._eta,
-                self._weighting,
-                self.crossover,
-                self.average,
-                cutoff_padding,
-                rx,
-                gss,
-                self._atomic_numbers,
-                self.periodic,
-            )
-            soap_poly.derivatives_numerical(
-                d,
-                c,
-                pos,
-                Z,
-                ase.geometry.cell.complete_cell(system.get_cell()),
-                np.asarray(system.get_pbc(), dtype=bool),
-                centers,
-                center_indices,
-                indices,
-                attach,
-                return_descriptor,
-            )
+        # Calculate numerically with extension
+        self.get_extension().derivatives_numerical(
+            d,
+            c,
+            pos,
+            Z,
+            cell,
+            pbc,
+            centers,
+            center_indices,
+            indices,
+            attach,
+            return_descriptor,
+            stencil_order,
+        )
 
     def derivatives_analytical(
         self,
@@ -703,6 +870,8 @@ class SOAP(DescriptorLocal):
     ):
         """Return the analytical derivatives for the given system.
         Args:
+            d (np.ndarray | None): Array for the derivatives. If None, the
+                derivatives are created in the sparse format and returned.
             system (:class:`ase.Atoms`): Atomic structure.
             indices (list): Indices of atoms for which the derivatives will be
                 computed for.
@@ -723,47 +892,52 @@ class SOAP(DescriptorLocal):
         Z = system.get_atomic_numbers()
         cell = ase.geometry.cell.complete_cell(system.get_cell())
         pbc = np.asarray(system.get_pbc(), dtype=bool)
-        cutoff_padding = self.get_cutoff_padding()
         centers, center_indices = self.prepare_centers(system, centers)
         sorted_species = self._atomic_numbers
         n_species = len(sorted_species)
         n_centers = centers.shape[0]
         n_atoms = len(system)
 
-        alphas = self._alphas.flatten()
-        betas = self._betas.flatten()
-        soap_gto = dscribe.ext.SOAPGTO(
-            self._r_cut,
-            self._n_max,
-            self._l_max,
-            self._eta,
-            self._weighting,
-            self.crossover,
-            self.average,
-            cutoff_padding,
-            alphas,
-            betas,
-            self._atomic_numbers,
-            self.periodic,
-        )
+        soap_ext = self.get_extension()
+
+        # Sparse derivatives only store the non-zero (center, atom) blocks and
+        # need no dense intermediate arrays.
+        if d is None:
+            coords, data = soap_ext.derivatives_analytical_sparse(
+                c,
+                pos,
+                Z,
+                cell,
+                pbc,
+                centers,
+                center_indices,
+                indices,
+                attach,
+                return_descriptor,
+            )
+            shape = (n_centers, len(indices), 3, self.get_number_of_features())
+            return sp.COO(coords, data, shape=shape, has_duplicates=False, sorted=True)
 
         # These arrays are only used internally by the C++ code.
         # Allocating them here with python is much faster than
         # allocating similarly sized arrays within C++. It seems
         # that numpy does some kind of lazy allocation that is
         # highly efficient for zero-initialized arrays. Similar
-        # performace could not be achieved even with calloc.
+        # performace could not be achieved even with calloc. For averaged
+        # output the derivatives are accumulated over the centers, so a
+        # single center is enough.
+        n_dev_centers = 1 if self.average != "off" else n_centers
         xd = self.init_internal_dev_array(
-            n_centers, n_atoms, n_species, self._n_max, self._l_max
+            n_dev_centers, n_atoms, n_species, self._n_max, self._l_max
         )
         yd = self.init_internal_dev_array(
-            n_centers, n_atoms, n_species, self._n_max, self._l_max
+            n_dev_centers, n_atoms, n_species, self._n_max, self._l_max
         )
         zd = self.init_internal_dev_array(
-            n_centers, n_atoms, n_species, self._n_max, self._l_max
+            n_dev_centers, n_atoms, n_species, self._n_max, self._l_max
         )
 
-        soap_gto.derivatives_analytical(
+        soap_ext.derivatives_analytical(
             d,
             c,
             xd,
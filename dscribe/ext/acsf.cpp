@@ -1,4 +1,7 @@
 #include "acsf.h"
+#include "celllist.h"
+#include "threadpool.h"
+#include "profiling.h"
 #include <tuple>
 #include <map>
 #include <math.h>
@@ -36,6 +39,12 @@ void ACSF::setG2Params(vector<vector<double> > g2Params)
 {
     this->g2Params = g2Params;
     nG2 = g2Params.size();
+    g2Eta.clear();
+    g2Rs.clear();
+    for (const vector<double> &params : g2Params) {
+        g2Eta.push_back(params[0]);
+        g2Rs.push_back(params[1]);
+    }
 }
 
 vector<vector<double> > ACSF::getG2Params()
@@ -59,6 +68,14 @@ void ACSF::setG4Params(vector<vector<double> > g4Params)
 {
     this->g4Params = g4Params;
     nG4 = g4Params.size();
+    g4Eta.clear();
+    g4Zeta.clear();
+    g4Lambda.clear();
+    for (const vector<double> &params : g4Params) {
+        g4Eta.push_back(params[0]);
+        g4Zeta.push_back(params[1]);
+        g4Lambda.push_back(params[2]);
+    }
 }
 vector<vector<double> > ACSF::getG4Params()
 {
@@ -70,6 +87,14 @@ void ACSF::setG5Params(vector<vector<double> > g5Params)
 {
     this->g5Params = g5Params;
     nG5 = g5Params.size();
+    g5Eta.clear();
+    g5Zeta.clear();
+    g5Lambda.clear();
+    for (const vector<double> &params : g5Params) {
+        g5Eta.push_back(params[0]);
+        g5Zeta.push_back(params[1]);
+        g5Lambda.push_back(params[2]);
+    }
 }
 vector<vector<double> > ACSF::getG5Params()
 {
@@ -96,148 +121,376 @@ return this->atomicNumbers;
 }
 
 
-vector<vector<double> > ACSF::create(vector<vector<double> > &positions, vector<int> &atomicNumbers, const vector<vector<double> > &distances, const vector<vector<int> > &neighbours, vector<int> &indices)
+void ACSFNeighbours::clear()
 {
+    this->types.clear();
+    this->x.clear();
+    this->y.clear();
+    this->z.clear();
+    this->r.clear();
+    this->rSquared.clear();
+    this->fc.clear();
+    this->g5Exp.clear();
+    this->dfc.clear();
+    this->blocks.clear();
+    for (const int &atom : this->atoms) {
+        this->atomBlock[atom] = -1;
+    }
+    this->atoms.clear();
+}
 
-    // Allocate memory
-    int nIndices = indices.size();
-    vector<vector<double> > output(nIndices, vector<double>((1+nG2+nG3)*nTypes+(nG4+nG5)*nTypePairs, 0));
+void ACSF::create(py::array_t<double> &out, py::array_t<double> &positions, py::array_t<int> &atomicNumbers, py::array_t<double> &cell, py::array_t<bool> &pbc, py::array_t<int> &indices)
+{
+    py::array_t<int> noIndices(0);
+    this->compute(out.mutable_data(), nullptr, nullptr, positions, atomicNumbers, cell, pbc, indices, noIndices);
+}
 
-    // Calculate the symmetry function values for every specified atom
-    int index = 0;
-    for (int &i : indices) {
+void ACSF::derivatives_analytical(py::array_t<double> &derivatives, py::array_t<double> &descriptor, py::array_t<double> &positions, py::array_t<int> &atomicNumbers, py::array_t<double> &cell, py::array_t<bool> &pbc, py::array_t<int> &centers, py::array_t<int> &indices, bool return_descriptor)
+{
+    this->compute(return_descriptor ? descriptor.mutable_data() : nullptr, derivatives.mutable_data(), nullptr, positions, atomicNumbers, cell, pbc, centers, indices);
+}
 
-        // Compute pairwise terms only for neighbors within cutoff
-        const vector<int> &i_neighbours = neighbours[i];
-        vector<double> &row = output[index];
-        for (const int &j : i_neighbours) {
-            if (i == j) {
-                continue;
-            }
+py::tuple ACSF::derivatives_analytical_sparse(py::array_t<double> &descriptor, py::array_t<double> &positions, py::array_t<int> &atomicNumbers, py::array_t<double> &cell, py::array_t<bool> &pbc, py::array_t<int> &centers, py::array_t<int> &indices, bool return_descriptor)
+{
+    SparseDerivatives sparse;
+    this->compute(return_descriptor ? descriptor.mutable_data() : nullptr, nullptr, &sparse, positions, atomicNumbers, cell, pbc, centers, indices);
+    return sparse_derivatives_to_coo(sparse);
+}
 
-            // Precompute some values
-            double r_ij = distances[i][j];
-            double fc_ij = computeCutoff(r_ij);
-            int index_j = atomicNumberToIndexMap[atomicNumbers[j]];
-            int offset = index_j * (1+nG2+nG3);  // Skip G1, G2, G3 types that are not the ones of atom bi
+void ACSF::compute(double* descriptor, double* derivatives, SparseDerivatives* sparse, py::array_t<double> &positions, py::array_t<int> &atomicNumbers, py::array_t<double> &cell, py::array_t<bool> &pbc, py::array_t<int> &centers, py::array_t<int> &indices)
+{
+    auto positions_u = positions.unchecked<2>();
+    auto atomic_numbers_u = atomicNumbers.unchecked<1>();
+    auto centers_u = centers.unchecked<1>();
+    auto indices_u = indices.unchecked<1>();
+    const int nAtoms = atomic_numbers_u.shape(0);
+    const int nCenters = centers_u.shape(0);
+    const int nIndices = indices_u.shape(0);
+    for (int i_center = 0; i_center < nCenters; ++i_center) {
+        if (centers_u(i_center) < 0 || centers_u(i_center) >= nAtoms) {
+            throw invalid_argument("Invalid atom index.");
+        }
+    }
+    for (int i_idx = 0; i_idx < nIndices; ++i_idx) {
+        if (indices_u(i_idx) < 0 || indices_u(i_idx) >= nAtoms) {
+            throw invalid_argument("Invalid atom index.");
+        }
+    }
 
-            // Compute G1
-            computeG1(row, offset, fc_ij);
+    // The cell list is created while holding the GIL, since it uses numpy
+    // arrays.
+    CellList cellList(positions, this->rCut, cell, pbc);
+    GILRelease release;
+    ScopedTimer timer("ACSF", "symmetry_functions");
+    Profiler::add_count("ACSF", "centers", nCenters);
+
+    const int nFeatures = (1+nG2+nG3)*nTypes+(nG4+nG5)*nTypePairs;
+    const bool return_derivatives = derivatives != nullptr || sparse != nullptr;
+    vector<int> elementIndex(nAtoms);
+    for (int i = 0; i < nAtoms; ++i) {
+        elementIndex[i] = atomicNumberToIndexMap.at(atomic_numbers_u(i));
+    }
 
-            // Compute G2
-            computeG2(row, offset, r_ij, fc_ij);
+    // The same atom may be included several times, so the slots of each atom
+    // in the derivatives are stored as linked lists.
+    vector<int> firstSlot(nAtoms, -1);
+    vector<int> nextSlot(nIndices, -1);
+    for (int i_idx = nIndices - 1; i_idx >= 0; --i_idx) {
+        const int atom = indices_u(i_idx);
+        nextSlot[i_idx] = firstSlot[atom];
+        firstSlot[atom] = i_idx;
+    }
 
-            // Compute G3
-            computeG3(row, offset, r_ij, fc_ij);
+    // Calculate the symmetry functions for every center. The centers are
+    // independent and each one writes only to its own rows, so they are
+    // distributed over the native threads. Sparse output is collected per
+    // chunk and concatenated in the chunk order, which keeps it sorted.
+    const int nChunks = get_num_chunks(nCenters);
+    vector<SparseDerivatives> sparseParts(sparse != nullptr ? nChunks : 0);
+    parallel_for(nCenters, [&](int begin, int end, int i_chunk) {
+        PhaseCounter neighboursCounter("ACSF", "neighbours");
+        ACSFNeighbours nbrs;
+        vector<double> scratchRow(descriptor == nullptr ? nFeatures : 0);
+        vector<int> slots;
+        if (return_derivatives) {
+            nbrs.atomBlock.assign(nAtoms, -1);
+            nbrs.radialDerivatives.resize(1+nG2+nG3);
+        }
+        for (int i_center = begin; i_center < end; ++i_center) {
+            const int i = centers_u(i_center);
+            double* row;
+            if (descriptor != nullptr) {
+                row = descriptor + (size_t)i_center*nFeatures;
+            } else {
+                fill(scratchRow.begin(), scratchRow.end(), 0.0);
+                row = scratchRow.data();
+            }
+            this->computeCenter(i, positions_u.data(i, 0), cellList, elementIndex, nbrs, row, return_derivatives);
+            neighboursCounter.add(nbrs.found.indices.size());
+            if (!return_derivatives) {
+                continue;
+            }
 
-            // Compute angle terms only when both neighbors are within cutoff
-            if (g4Params.size() != 0 || g5Params.size() != 0) {
-                for (const int &k : i_neighbours) {
-                    if (k == i || k >= j) {
-                        continue;
+            // Copy the derivatives of the included atoms to the output
+            const size_t blockSize = 3*nFeatures;
+            if (sparse == nullptr) {
+                double* out = derivatives + (size_t)i_center*nIndices*blockSize;
+                for (int b = 0; b < (int)nbrs.atoms.size(); ++b) {
+                    const double* block = &nbrs.derivatives[b*blockSize];
+                    for (int i_idx = firstSlot[nbrs.atoms[b]]; i_idx >= 0; i_idx = nextSlot[i_idx]) {
+                        copy(block, block + blockSize, out + i_idx*blockSize);
+                    }
+                }
+                continue;
+            }
+            slots.clear();
+            for (const int &atom : nbrs.atoms) {
+                for (int i_idx = firstSlot[atom]; i_idx >= 0; i_idx = nextSlot[i_idx]) {
+                    slots.push_back(i_idx);
+                }
+            }
+            sort(slots.begin(), slots.end());
+            SparseDerivatives &part = sparseParts[i_chunk];
+            for (const int &i_idx : slots) {
+                const double* block = &nbrs.derivatives[nbrs.atomBlock[indices_u(i_idx)]*blockSize];
+                for (size_t q = 0; q < blockSize; ++q) {
+                    if (block[q] != 0.0) {
+                        part.centers.push_back(i_center);
+                        part.indices.push_back(i_idx);
+                        part.components.push_back(q / nFeatures);
+                        part.features.push_back(q % nFeatures);
+                        part.data.push_back(block[q]);
                     }
+                }
+            }
+        }
+    });
+    for (SparseDerivatives &part : sparseParts) {
+        sparse->append(part);
+    }
+}
+
+void ACSF::computeCenter(int i, const double* position, const CellList &cellList, const vector<int> &elementIndex, ACSFNeighbours &nbrs, double* row, bool return_derivatives) const
+{
+    const int nFeatures = (1+nG2+nG3)*nTypes+(nG4+nG5)*nTypePairs;
+    const int nRadial = 1+nG2+nG3;
+
+    // Store the neighbours other than the atom itself. Its periodic images
+    // are neighbours. The derivatives of each atom are stored in a separate
+    // block, and the central atom has the first one.
+    CellListNeighbours &found = nbrs.found;
+    cellList.getNeighboursForPosition(position[0], position[1], position[2], found);
+    nbrs.clear();
+    if (return_derivatives) {
+        nbrs.atomBlock[i] = 0;
+        nbrs.atoms.push_back(i);
+    }
+    for (size_t q = 0; q < found.indices.size(); ++q) {
+        const int atom = found.indices[q];
+        if (atom == i && found.images[q] == 0) {
+            continue;
+        }
+        const double r_ij = sqrt(found.distancesSquared[q]);
+        nbrs.types.push_back(elementIndex[atom]);
+        nbrs.x.push_back(found.dx[q]);
+        nbrs.y.push_back(found.dy[q]);
+        nbrs.z.push_back(found.dz[q]);
+        nbrs.r.push_back(r_ij);
+        nbrs.rSquared.push_back(found.distancesSquared[q]);
+        nbrs.fc.push_back(computeCutoff(r_ij));
+        for (int p = 0; p < nG5; ++p) {
+            nbrs.g5Exp.push_back(exp(-g5Eta[p]*found.distancesSquared[q]));
+        }
+        if (return_derivatives) {
+            nbrs.dfc.push_back(computeCutoffDerivative(r_ij));
+            if (nbrs.atomBlock[atom] < 0) {
+                nbrs.atomBlock[atom] = nbrs.atoms.size();
+                nbrs.atoms.push_back(atom);
+            }
+            nbrs.blocks.push_back(nbrs.atomBlock[atom]);
+        }
+    }
+    const int nNeighbours = nbrs.r.size();
+    const size_t blockSize = 3*nFeatures;
+    if (return_derivatives) {
+        nbrs.derivatives.assign(nbrs.atoms.size()*blockSize, 0.0);
+    }
+
+    // Compute the pairwise terms G1, G2 and G3. The derivatives are first
+    // calculated with respect to the distance, and then projected along the
+    // direction of the neighbour.
+    double* dg = nbrs.radialDerivatives.data();
+    for (int j = 0; j < nNeighbours; ++j) {
+        const double r_ij = nbrs.r[j];
+        const double fc_ij = nbrs.fc[j];
+        const int offset = nbrs.types[j]*nRadial;  // Skip G1, G2, G3 types that are not the ones of atom j
+        double* g = row + offset;
+        g[0] += fc_ij;
+        for (int p = 0; p < nG2; ++p) {
+            const double dr = r_ij - g2Rs[p];
+            g[1+p] += exp(-g2Eta[p]*dr*dr)*fc_ij;
+        }
+        for (int p = 0; p < nG3; ++p) {
+            g[1+nG2+p] += cos(r_ij*g3Params[p])*fc_ij;
+        }
+        if (!return_derivatives) {
+            continue;
+        }
+        const double dfc_ij = nbrs.dfc[j];
+        dg[0] = dfc_ij;
+        for (int p = 0; p < nG2; ++p) {
+            const double dr = r_ij - g2Rs[p];
+            dg[1+p] = exp(-g2Eta[p]*dr*dr)*(dfc_ij - 2*g2Eta[p]*dr*fc_ij);
+        }
+        for (int p = 0; p < nG3; ++p) {
+            const double kappa = g3Params[p];
+            dg[1+nG2+p] = cos(r_ij*kappa)*dfc_ij - kappa*sin(r_ij*kappa)*fc_ij;
+        }
+        const double u[3] = {nbrs.x[j]/r_ij, nbrs.y[j]/r_ij, nbrs.z[j]/r_ij};
+        double* d = &nbrs.derivatives[nbrs.blocks[j]*blockSize] + offset;
+        for (int c = 0; c < 3; ++c) {
+            for (int p = 0; p < nRadial; ++p) {
+                d[c*nFeatures+p] += u[c]*dg[p];
+            }
+        }
+    }
 
-                    // Precompute some values that are used by both G4 and G5
-                    double r_ik = distances[i][k];
-                    double r_jk = distances[j][k];
-                    double fc_ik = computeCutoff(r_ik);
-                    double r_ij_square = r_ij*r_ij;
-                    double r_ik_square = r_ik*r_ik;
-                    double r_jk_square = r_jk*r_jk;
-                    int index_k = atomicNumberToIndexMap[atomicNumbers[k]];
-                    double costheta = 0.5/(r_ij*r_ik) * (r_ij_square+r_ik_square-r_jk_square);
-
-                    // Determine the location for this triplet of species
-                    int its;
-                    if (index_j >= index_k) {
-                        its = (index_j*(index_j+1))/2 + index_k;
-                    } else  {
-                        its = (index_k*(index_k+1))/2 + index_j;
+    // Compute the angle terms G4 and G5 for each pair of neighbours. For the
+    // derivatives the angular part is differentiated with respect to the
+    // cosine, and the radial part with respect to the distances.
+    if (nG4 != 0 || nG5 != 0) {
+        for (int j = 0; j < nNeighbours; ++j) {
+            const int index_j = nbrs.types[j];
+            for (int k = 0; k < j; ++k) {
+                const int index_k = nbrs.types[k];
+                const double dx = nbrs.x[k] - nbrs.x[j];
+                const double dy = nbrs.y[k] - nbrs.y[j];
+                const double dz = nbrs.z[k] - nbrs.z[j];
+                const double r_jk_square = dx*dx + dy*dy + dz*dz;
+                const double r_ij = nbrs.r[j];
+                const double r_ik = nbrs.r[k];
+                const double costheta = (nbrs.x[j]*nbrs.x[k] + nbrs.y[j]*nbrs.y[k] + nbrs.z[j]*nbrs.z[k])/(r_ij*r_ik);
+                const double fc_ij = nbrs.fc[j];
+                const double fc_ik = nbrs.fc[k];
+
+                // Determine the location for this triplet of species
+                int its;
+                if (index_j >= index_k) {
+                    its = (index_j*(index_j+1))/2 + index_k;
+                } else  {
+                    its = (index_k*(index_k+1))/2 + index_j;
+                }
+                const int offset = nTypes*nRadial + its*(nG4+nG5);
+                double* g = row + offset;
+
+                // The unit vectors from i to j, from i to k and from j to k
+                // and the gradients of the cosine with respect to the
+                // positions of j and k.
+                const double r_jk = sqrt(r_jk_square);
+                double u_ij[3], u_ik[3], u_jk[3], dc_j[3], dc_k[3];
+                double* d_j = nullptr;
+                double* d_k = nullptr;
+                if (return_derivatives) {
+                    const double a[3] = {nbrs.x[j], nbrs.y[j], nbrs.z[j]};
+                    const double b[3] = {nbrs.x[k], nbrs.y[k], nbrs.z[k]};
+                    const double ab = r_ij*r_ik;
+                    for (int c = 0; c < 3; ++c) {
+                        u_ij[c] = a[c]/r_ij;
+                        u_ik[c] = b[c]/r_ik;
+                        u_jk[c] = (b[c] - a[c])/r_jk;
+                        dc_j[c] = b[c]/ab - costheta*a[c]/(r_ij*r_ij);
+                        dc_k[c] = a[c]/ab - costheta*b[c]/(r_ik*r_ik);
                     }
-                    offset = nTypes * (1+nG2+nG3);         // Skip this atoms G1 G2 and G3
-                    offset += its * (nG4+nG5);              // skip G4 and G5 types that are not the ones of atom bi
+                    d_j = &nbrs.derivatives[nbrs.blocks[j]*blockSize] + offset;
+                    d_k = &nbrs.derivatives[nbrs.blocks[k]*blockSize] + offset;
+                }
 
-                    // Compute G4
-                    computeG4(row, offset, costheta, r_jk, r_ij_square, r_ik_square, r_jk_square, fc_ij, fc_ik);
+                // G4 also requires the neighbours to be within the cutoff
+                // from each other
+                if (nG4 != 0 && r_jk <= rCut) {
+                    const double fc_jk = computeCutoff(r_jk);
+                    const double fc4 = fc_ij*fc_ik*fc_jk;
+                    const double rSum = nbrs.rSquared[j] + nbrs.rSquared[k] + r_jk_square;
+                    for (int p = 0; p < nG4; ++p) {
+                        g[p] += 2*pow(0.5*(1 + g4Lambda[p]*costheta), g4Zeta[p])*exp(-g4Eta[p]*rSum)*fc4;
+                    }
+                    if (return_derivatives) {
+                        const double dfc_ij = nbrs.dfc[j];
+                        const double dfc_ik = nbrs.dfc[k];
+                        const double dfc_jk = computeCutoffDerivative(r_jk);
+                        for (int p = 0; p < nG4; ++p) {
+                            const double eta = g4Eta[p];
+                            const double zeta = g4Zeta[p];
+                            const double base = 0.5*(1 + g4Lambda[p]*costheta);
+                            const double angular = 2*pow(base, zeta);
+                            const double radial = exp(-eta*rSum);
+                            const double dG_dc = zeta*g4Lambda[p]*pow(base, zeta-1)*radial*fc4;
+                            const double dG_dr_ij = angular*radial*(dfc_ij*fc_ik*fc_jk - 2*eta*r_ij*fc4);
+                            const double dG_dr_ik = angular*radial*(fc_ij*dfc_ik*fc_jk - 2*eta*r_ik*fc4);
+                            const double dG_dr_jk = angular*radial*(fc_ij*fc_ik*dfc_jk - 2*eta*r_jk*fc4);
+                            for (int c = 0; c < 3; ++c) {
+                                d_j[c*nFeatures+p] += dG_dc*dc_j[c] + dG_dr_ij*u_ij[c] - dG_dr_jk*u_jk[c];
+                                d_k[c*nFeatures+p] += dG_dc*dc_k[c] + dG_dr_ik*u_ik[c] + dG_dr_jk*u_jk[c];
+                            }
+                        }
+                    }
+                }
+                g += nG4;
 
-                    // Compute G5
-                    computeG5(row, offset, costheta, r_ij_square, r_ik_square, fc_ij, fc_ik);
+                const double fc5 = fc_ij*fc_ik;
+                const double* exp_j = nbrs.g5Exp.data() + j*nG5;
+                const double* exp_k = nbrs.g5Exp.data() + k*nG5;
+                for (int p = 0; p < nG5; ++p) {
+                    g[p] += 2*pow(0.5*(1 + g5Lambda[p]*costheta), g5Zeta[p])*exp_j[p]*exp_k[p]*fc5;
+                }
+                if (return_derivatives && nG5 != 0) {
+                    const double dfc_ij = nbrs.dfc[j];
+                    const double dfc_ik = nbrs.dfc[k];
+                    for (int p = 0; p < nG5; ++p) {
+                        const double eta = g5Eta[p];
+                        const double zeta = g5Zeta[p];
+                        const double base = 0.5*(1 + g5Lambda[p]*costheta);
+                        const double angular = 2*pow(base, zeta);
+                        const double radial = exp_j[p]*exp_k[p];
+                        const double dG_dc = zeta*g5Lambda[p]*pow(base, zeta-1)*radial*fc5;
+                        const double dG_dr_ij = angular*radial*(dfc_ij*fc_ik - 2*eta*r_ij*fc5);
+                        const double dG_dr_ik = angular*radial*(fc_ij*dfc_ik - 2*eta*r_ik*fc5);
+                        for (int c = 0; c < 3; ++c) {
+                            d_j[c*nFeatures+nG4+p] += dG_dc*dc_j[c] + dG_dr_ij*u_ij[c];
+                            d_k[c*nFeatures+nG4+p] += dG_dc*dc_k[c] + dG_dr_ik*u_ik[c];
+                        }
+                    }
                 }
             }
         }
-        ++index;
     }
-    return output;
+
+    // The symmetry functions only depend on the positions of the neighbours
+    // relative to the central atom, so its derivatives are the negative sum
+    // of the contributions of the neighbours. The contributions of its own
+    // periodic images cancel out.
+    if (return_derivatives) {
+        double* d_i = nbrs.derivatives.data();
+        fill(d_i, d_i + blockSize, 0.0);
+        for (size_t b = 1; b < nbrs.atoms.size(); ++b) {
+            const double* d_b = &nbrs.derivatives[b*blockSize];
+            for (size_t q = 0; q < blockSize; ++q) {
+                d_i[q] -= d_b[q];
+            }
+        }
+    }
 }
 
 
 /*! \brief Computes the value of the cutoff fuction at a specific distance.
  * */
-inline double ACSF::computeCutoff(double r_ij) {
+inline double ACSF::computeCutoff(double r_ij) const {
 	return 0.5*(cos(r_ij*PI/rCut)+1);
 }
 
-inline void ACSF::computeG1(vector<double> &output, int &offset, double &fc_ij) {
-    output[offset] += fc_ij;
-    offset += 1;
-}
-
-inline void ACSF::computeG2(vector<double> &output, int &offset, double &r_ij, double &fc_ij) {
-
-	// Compute G2 - gaussian types
-    double eta;
-    double Rs;
-	for (auto params : g2Params) {
-        eta = params[0];
-        Rs = params[1];
-        output[offset] += exp(-eta * (r_ij - Rs)*(r_ij - Rs)) * fc_ij;
-        offset++;
-	}
-}
-
-inline void ACSF::computeG3(vector<double> &output, int &offset, double &r_ij, double &fc_ij) {
-	// Compute G3 - cosine type
-	for (auto param : g3Params) {
-        output[offset] += cos(r_ij*param)*fc_ij;
-        offset++;
-    }
-}
-
-inline void ACSF::computeG4(vector<double> &output, int &offset, double &costheta, double &r_jk, double &r_ij_square, double &r_ik_square, double &r_jk_square, double &fc_ij, double &fc_ik) {
-	// Compute G4
-    if (r_jk > rCut) {
-        offset += g4Params.size();
-        return;
-    }
-    double cutoff_jk = computeCutoff(r_jk);
-	double fc4 = fc_ij*fc_ik*cutoff_jk;
-	double eta;
-	double zeta;
-	double lambda;
-	double gauss;
-	for (auto params : g4Params) {
-		eta = params[0];
-		zeta = params[1];
-		lambda = params[2];
-		gauss = exp(-eta*(r_ij_square+r_ik_square+r_jk_square)) * fc4;
-		output[offset] += 2*pow(0.5*(1 + lambda*costheta), zeta) * gauss;
-		offset++;
-	}
-}
-
-inline void ACSF::computeG5(vector<double> &output, int &offset, double &costheta, double &r_ij_square, double &r_ik_square, double &fc_ij, double &fc_ik) {
-	// Compute G5
-	double eta;
-	double zeta;
-	double lambda;
-	double gauss;
-	double fc5 = fc_ij*fc_ik;
-	for (auto params : g5Params) {
-		eta = params[0];
-		zeta = params[1];
-		lambda = params[2];
-		gauss = exp(-eta*(r_ij_square+r_ik_square)) * fc5;
-		output[offset] += 2*pow(0.5*(1 + lambda*costheta), zeta) * gauss;
-		offset++;
-	}
+/*! \brief Computes the derivative of the cutoff fuction with respect to the
+ * distance.
+ * */
+inline double ACSF::computeCutoffDerivative(double r_ij) const {
+	return -0.5*PI/rCut*sin(r_ij*PI/rCut);
 }
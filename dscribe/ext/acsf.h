@@ -3,12 +3,57 @@
 
 #include <unordered_map>
 #include <vector>
+#include <pybind11/numpy.h>
+#include "celllist.h"
+#include "descriptor.h"
 
 #define PI 3.1415926535897932384626433832795028841971693993751058209749445923078164062
 
+namespace py = pybind11;
 using namespace std;
 
 
+/**
+ * The neighbours of an atom within the cutoff, with the values that are
+ * shared by all the symmetry functions precomputed once per neighbour. The
+ * vectors point from the central atom to the neighbours. One instance is
+ * needed per thread.
+ */
+struct ACSFNeighbours {
+    void clear();
+
+    CellListNeighbours found;
+    vector<int> types;
+    vector<double> x;
+    vector<double> y;
+    vector<double> z;
+    vector<double> r;
+    vector<double> rSquared;
+    vector<double> fc;
+    /**
+     * The radial part exp(-eta*r^2) of each G5 function, nG5 values for
+     * each neighbour.
+     */
+    vector<double> g5Exp;
+
+    // Only used for the derivatives: the derivative of the cutoff function,
+    // the derivative block of each neighbour, the atoms that have a block
+    // with the central atom as the first one, the block of each atom in the
+    // system or -1 and the derivatives with respect to the distance for the
+    // pairwise terms of a single neighbour.
+    vector<double> dfc;
+    vector<int> blocks;
+    vector<int> atoms;
+    vector<int> atomBlock;
+    vector<double> radialDerivatives;
+
+    /**
+     * The derivatives of a single center with respect to the atoms, with the
+     * shape (n_atoms, 3, n_features).
+     */
+    vector<double> derivatives;
+};
+
 /**
  * Implementation for the performance-critical parts of ACSF.
  */
@@ -25,7 +70,44 @@ class ACSF {
             vector<int> atomicNumbers
         );
 
-        vector<vector<double> > create(vector<vector<double> > &positions, vector<int> &atomicNumbers, const vector<vector<double> > &distances, const vector<vector<int> > &neighbours, vector<int> &indices);
+        /**
+         * Calculates the symmetry functions for the given atoms. The
+         * neighbours are searched with a cell list, and the output is
+         * written into the given zero-initialized array of shape
+         * (n_indices, n_features).
+         *
+         * @param out Output array.
+         * @param positions Atomic positions.
+         * @param atomicNumbers Atomic numbers.
+         * @param cell Unit cell.
+         * @param pbc Periodic boundary conditions (array of three booleans).
+         * @param indices Indices of the atoms for which the symmetry
+         * functions are calculated.
+         */
+        void create(py::array_t<double> &out, py::array_t<double> &positions, py::array_t<int> &atomicNumbers, py::array_t<double> &cell, py::array_t<bool> &pbc, py::array_t<int> &indices);
+        /**
+         * Calculates the analytical derivatives of the symmetry functions
+         * with respect to the atomic positions, and optionally the symmetry
+         * functions themselves, in the same neighbour and triplet pass. The
+         * centers move together with the atoms they are attached to.
+         *
+         * @param derivatives Zero-initialized output array of shape
+         * (n_centers, n_indices, 3, n_features).
+         * @param descriptor Zero-initialized output array of shape
+         * (n_centers, n_features). Only used if return_descriptor is true.
+         * @param centers Indices of the atoms for which the symmetry
+         * functions are calculated.
+         * @param indices Indices of the atoms with respect to which the
+         * derivatives are calculated.
+         */
+        void derivatives_analytical(py::array_t<double> &derivatives, py::array_t<double> &descriptor, py::array_t<double> &positions, py::array_t<int> &atomicNumbers, py::array_t<double> &cell, py::array_t<bool> &pbc, py::array_t<int> &centers, py::array_t<int> &indices, bool return_descriptor);
+        /**
+         * Same as derivatives_analytical, but the derivatives are returned
+         * in the coordinate format as a tuple of coordinates and values.
+         * Only the atoms within the cutoff of a center have non-zero
+         * derivatives for it.
+         */
+        py::tuple derivatives_analytical_sparse(py::array_t<double> &descriptor, py::array_t<double> &positions, py::array_t<int> &atomicNumbers, py::array_t<double> &cell, py::array_t<bool> &pbc, py::array_t<int> &centers, py::array_t<int> &indices, bool return_descriptor);
         void setRCut(double rCut);
         void setG2Params(vector<vector<double> > g2Params);
         void setG3Params(vector<double> g3Params);
@@ -53,12 +135,33 @@ class ACSF {
         vector<int> atomicNumbers;
 
     private:
-        double computeCutoff(double r_ij);
-        void computeG1(vector<double> &output, int &offset, double &fc_ij);
-        void computeG2(vector<double> &output, int &offset, double &r_ij, double &fc_ij);
-        void computeG3(vector<double> &output, int &offset, double &r_ij, double &fc_ij);
-        void computeG4(vector<double> &output, int &offset, double &costheta, double &r_jk, double &r_ij_square, double &r_ik_square, double &r_jk_square, double &fc_ij, double &fc_ik);
-        void computeG5(vector<double> &output, int &offset, double &costheta, double &r_ij_square, double &r_ik_square, double &fc_ij, double &fc_ik);
+        /**
+         * Calculates the symmetry functions, and the derivatives if
+         * derivatives or sparse is given, for the given centers. The dense
+         * derivatives are written with the layout of derivatives_analytical.
+         */
+        void compute(double* descriptor, double* derivatives, SparseDerivatives* sparse, py::array_t<double> &positions, py::array_t<int> &atomicNumbers, py::array_t<double> &cell, py::array_t<bool> &pbc, py::array_t<int> &centers, py::array_t<int> &indices);
+        /**
+         * Calculates the symmetry functions of atom i into the given row,
+         * and their derivatives into nbrs.derivatives if return_derivatives
+         * is true.
+         */
+        void computeCenter(int i, const double* position, const CellList &cellList, const vector<int> &elementIndex, ACSFNeighbours &nbrs, double* row, bool return_derivatives) const;
+        double computeCutoff(double r_ij) const;
+        double computeCutoffDerivative(double r_ij) const;
+        /**
+         * The parameters of each symmetry function type stored as separate
+         * contiguous arrays, so that the loops over the parameters can be
+         * vectorized.
+         */
+        vector<double> g2Eta;
+        vector<double> g2Rs;
+        vector<double> g4Eta;
+        vector<double> g4Zeta;
+        vector<double> g4Lambda;
+        vector<double> g5Eta;
+        vector<double> g5Zeta;
+        vector<double> g5Lambda;
         unordered_map<int, int> atomicNumberToIndexMap;
 };
 
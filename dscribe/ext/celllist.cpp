@@ -13,33 +13,125 @@ See the License for the specific language governing permissions and
 limitations under the License.
 */
 #include "celllist.h"
+#include "geometry.h"
+#include "profiling.h"
 #include <algorithm>
 #include <utility>
 #include <map>
 #include <utility>
 #include <math.h>
+#include <stdexcept>
 
 using namespace std;
 
+void CellListNeighbours::clear() {
+    this->indices.clear();
+    this->images.clear();
+    this->dx.clear();
+    this->dy.clear();
+    this->dz.clear();
+    this->distancesSquared.clear();
+}
+
+namespace {
+template <typename T>
+void gather(vector<T> &values, vector<T> &buffer, const vector<int> &order)
+{
+    buffer.resize(order.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        buffer[i] = values[order[i]];
+    }
+    values.swap(buffer);
+}
+}
+
+void CellListNeighbours::sortByGroup(const vector<int> &atomGroups, int nGroups) {
+    // Count the neighbours in each group
+    this->groupOffsets.assign(nGroups + 1, 0);
+    for (const int &idx : this->indices) {
+        const int group = atomGroups[idx];
+        if (group >= 0) {
+            ++this->groupOffsets[group + 1];
+        }
+    }
+    for (int group = 0; group < nGroups; ++group) {
+        this->groupOffsets[group + 1] += this->groupOffsets[group];
+    }
+
+    // The offsets are used as the insertion points of the groups, after
+    // which each one points to the start of the next group.
+    this->order.resize(this->groupOffsets[nGroups]);
+    const int nFound = this->indices.size();
+    for (int k = 0; k < nFound; ++k) {
+        const int group = atomGroups[this->indices[k]];
+        if (group >= 0) {
+            this->order[this->groupOffsets[group]++] = k;
+        }
+    }
+    for (int group = nGroups; group > 0; --group) {
+        this->groupOffsets[group] = this->groupOffsets[group - 1];
+    }
+    this->groupOffsets[0] = 0;
+
+    gather(this->indices, this->intBuffer, this->order);
+    gather(this->images, this->intBuffer, this->order);
+    gather(this->dx, this->doubleBuffer, this->order);
+    gather(this->dy, this->doubleBuffer, this->order);
+    gather(this->dz, this->doubleBuffer, this->order);
+    gather(this->distancesSquared, this->doubleBuffer, this->order);
+}
+
 CellList::CellList(py::array_t<double> positions, double cutoff)
-    : positions(positions.unchecked<2>())
-    , cutoff(cutoff)
+    : CellList(positions, cutoff, 0.0)
+{
+}
+
+CellList::CellList(py::array_t<double> positions, double cutoff, py::array_t<double> cell, py::array_t<bool> pbc)
+    : CellList(positions, cutoff, 0.0, cell, pbc)
+{
+}
+
+CellList::CellList(py::array_t<double> positions, double cutoff, double skin)
+    : cutoff(cutoff)
+    , cutoffSquared(cutoff*cutoff)
+    , binSize(cutoff + skin)
+    , shifts(3, 0.0)
+{
+    if (skin < 0) {
+        throw invalid_argument("The skin cannot be negative.");
+    }
+    if (cutoff > 0) {
+        this->init(positions.unchecked<2>());
+    }
+}
+
+CellList::CellList(py::array_t<double> positions, double cutoff, double skin, py::array_t<double> cell, py::array_t<bool> pbc)
+    : cutoff(cutoff)
     , cutoffSquared(cutoff*cutoff)
+    , binSize(cutoff + skin)
+    , shifts(get_image_shifts(cell, pbc, cutoff + skin))
 {
+    if (skin < 0) {
+        throw invalid_argument("The skin cannot be negative.");
+    }
     if (cutoff > 0) {
-        this->init();
+        this->init(positions.unchecked<2>());
     }
 }
 
-void CellList::init() {
+void CellList::init(const py::detail::unchecked_reference<double, 2> &positions) {
+    ScopedTimer timer("CellList", "build");
+    const int nAtoms = positions.shape(0);
+    Profiler::add_count("CellList", "atoms", nAtoms);
+
     // Find cell limits
-    this->xmin = this->xmax = this->positions(0, 0);
-    this->ymin = this->ymax = this->positions(0, 1);
-    this->zmin = this->zmax = this->positions(0, 2);
-    for (ssize_t i = 0; i < this->positions.shape(0); i++) {
-        double x = this->positions(i, 0);
-        double y = this->positions(i, 1);
-        double z = this->positions(i, 2);
+    this->xmin = this->xmax = nAtoms ? positions(0, 0) : 0;
+    this->ymin = this->ymax = nAtoms ? positions(0, 1) : 0;
+    this->zmin = this->zmax = nAtoms ? positions(0, 2) : 0;
+    for (int i = 0; i < nAtoms; i++) {
+        double x = positions(i, 0);
+        double y = positions(i, 1);
+        double z = positions(i, 2);
         if (x < this->xmin) {
             this->xmin = x;
         };
@@ -71,94 +163,150 @@ void CellList::init() {
     this->zmax += padding;
 
     // Determine amount and size of bins. The bins are made to be always of equal size.
-    this->nx = max(1, int((this->xmax - this->xmin)/this->cutoff));
-    this->ny = max(1, int((this->ymax - this->ymin)/this->cutoff));
-    this->nz = max(1, int((this->zmax - this->zmin)/this->cutoff));
-    this->dx = max(this->cutoff, (this->xmax - this->xmin)/this->nx);
-    this->dy = max(this->cutoff, (this->ymax - this->ymin)/this->ny);
-    this->dz = max(this->cutoff, (this->zmax - this->zmin)/this->nz);
-
-    // Initialize the bin data structure. It is a 4D vector.
-    this->bins = vector<vector<vector<vector<int>>>>(this->nx, vector<vector<vector<int>>>(this->ny, vector<vector<int>>(this->nz, vector<int>())));
-
-    // Fill the bins with atom indices
-    for (ssize_t idx = 0; idx < this->positions.shape(0); idx++) {
-        double x = this->positions(idx, 0);
-        double y = this->positions(idx, 1);
-        double z = this->positions(idx, 2);
-
-        // Get bin index
-        int i = (x - this->xmin)/this->dx;
-        int j = (y - this->ymin)/this->dy;
-        int k = (z - this->zmin)/this->dz;
-
-        // Add atom index to the bin
-        this->bins[i][j][k].push_back(idx);
+    this->nx = max(1, int((this->xmax - this->xmin)/this->binSize));
+    this->ny = max(1, int((this->ymax - this->ymin)/this->binSize));
+    this->nz = max(1, int((this->zmax - this->zmin)/this->binSize));
+    this->dx = max(this->binSize, (this->xmax - this->xmin)/this->nx);
+    this->dy = max(this->binSize, (this->ymax - this->ymin)/this->ny);
+    this->dz = max(this->binSize, (this->zmax - this->zmin)/this->nz);
+
+    // Count the atoms in each bin. The bins are numbered in row-major order.
+    vector<int> atomBins(nAtoms);
+    this->binOffsets.assign(this->nx*this->ny*this->nz + 1, 0);
+    for (int idx = 0; idx < nAtoms; idx++) {
+        int i = (positions(idx, 0) - this->xmin)/this->dx;
+        int j = (positions(idx, 1) - this->ymin)/this->dy;
+        int k = (positions(idx, 2) - this->zmin)/this->dz;
+        int bin = (i*this->ny + j)*this->nz + k;
+        atomBins[idx] = bin;
+        ++this->binOffsets[bin + 1];
+    };
+    for (size_t bin = 1; bin < this->binOffsets.size(); bin++) {
+        this->binOffsets[bin] += this->binOffsets[bin - 1];
+    }
+
+    // Store the atoms in bin order. Within a bin the atoms are in order of
+    // increasing index.
+    vector<int> next(this->binOffsets.begin(), this->binOffsets.end() - 1);
+    this->binIndices.resize(nAtoms);
+    this->binPositions.resize(3*nAtoms);
+    this->binLocations.resize(nAtoms);
+    for (int idx = 0; idx < nAtoms; idx++) {
+        int location = next[atomBins[idx]]++;
+        this->binIndices[location] = idx;
+        this->binLocations[idx] = location;
+        for (int i = 0; i < 3; i++) {
+            this->binPositions[3*location + i] = positions(idx, i);
+        }
     };
+    Profiler::add_count("CellList", "bytes_allocated", this->binOffsets.size()*sizeof(int) + 2*nAtoms*sizeof(int) + 3*nAtoms*sizeof(double));
 }
 
-CellListResult CellList::getNeighboursForPosition(const double x, const double y, const double z) const
+void CellList::getNeighboursForPosition(const double x, const double y, const double z, CellListNeighbours &neighbours) const
 {
-    // The indices of the neighbouring atoms
-    vector<int> neighbours;
-    vector<double> distances;
-    vector<double> distancesSquared;
-
-    // Find bin for the given position
-    int i0 = (x - this->xmin)/this->dx;
-    int j0 = (y - this->ymin)/this->dy;
-    int k0 = (z - this->zmin)/this->dz;
-
-    // Get the bin ranges to check for each dimension.
-    int istart = max(i0-1, 0);
-    int iend = min(i0+1, this->nx-1);
-    int jstart = max(j0-1, 0);
-    int jend = min(j0+1, this->ny-1);
-    int kstart = max(k0-1, 0);
-    int kend = min(k0+1, this->nz-1);
-
-    // Loop over neighbouring bins
-    for (int i = istart; i <= iend; i++){
-        for (int j = jstart; j <= jend; j++){
-            for (int k = kstart; k <= kend; k++){
-
-                // For each atom in the current bin, calculate the actual distance
-                vector<int> binIndices = this->bins[i][j][k];
-                for (auto &idx : binIndices) {
-                    double ix = this->positions(idx, 0);
-                    double iy = this->positions(idx, 1);
-                    double iz = this->positions(idx, 2);
-                    double deltax = x - ix;
-                    double deltay = y - iy;
-                    double deltaz = z - iz;
+    neighbours.clear();
+
+    // Searching the periodic image translated by the shift is the same as
+    // searching the original atoms around the position translated by the
+    // opposite shift.
+    const int nImages = this->shifts.size()/3;
+    for (int image = 0; image < nImages; image++) {
+        const double* shift = &this->shifts[3*image];
+        const double xs = x - shift[0];
+        const double ys = y - shift[1];
+        const double zs = z - shift[2];
+
+        // Find bin for the given position
+        int i0 = (xs - this->xmin)/this->dx;
+        int j0 = (ys - this->ymin)/this->dy;
+        int k0 = (zs - this->zmin)/this->dz;
+
+        // Get the bin ranges to check for each dimension.
+        int istart = max(i0-1, 0);
+        int iend = min(i0+1, this->nx-1);
+        int jstart = max(j0-1, 0);
+        int jend = min(j0+1, this->ny-1);
+        int kstart = max(k0-1, 0);
+        int kend = min(k0+1, this->nz-1);
+
+        // Loop over neighbouring bins
+        for (int i = istart; i <= iend; i++){
+            for (int j = jstart; j <= jend; j++){
+
+                // The bins along z are consecutive in memory
+                int begin = this->binOffsets[(i*this->ny + j)*this->nz + kstart];
+                int end = this->binOffsets[(i*this->ny + j)*this->nz + kend + 1];
+
+                // For each atom in the current bins, calculate the actual distance
+                for (int location = begin; location < end; location++) {
+                    const double* position = &this->binPositions[3*location];
+                    double deltax = position[0] - xs;
+                    double deltay = position[1] - ys;
+                    double deltaz = position[2] - zs;
                     double distanceSquared = deltax*deltax + deltay*deltay + deltaz*deltaz;
                     if (distanceSquared <= this->cutoffSquared) {
-                        neighbours.push_back(idx);
-                        distancesSquared.push_back(distanceSquared);
-                        distances.push_back(sqrt(distanceSquared));
+                        neighbours.indices.push_back(this->binIndices[location]);
+                        neighbours.images.push_back(image);
+                        neighbours.dx.push_back(deltax);
+                        neighbours.dy.push_back(deltay);
+                        neighbours.dz.push_back(deltaz);
+                        neighbours.distancesSquared.push_back(distanceSquared);
                     }
                 }
             }
         }
     }
-    return CellListResult{neighbours, distances, distancesSquared};
+}
+
+CellListResult CellList::getNeighboursForPosition(const double x, const double y, const double z) const
+{
+    CellListNeighbours neighbours;
+    this->getNeighboursForPosition(x, y, z, neighbours);
+    vector<double> distances(neighbours.distancesSquared.size());
+    for (size_t i = 0; i < distances.size(); ++i) {
+        distances[i] = sqrt(neighbours.distancesSquared[i]);
+    }
+    return CellListResult{neighbours.indices, distances, neighbours.distancesSquared};
 }
 
 CellListResult CellList::getNeighboursForIndex(const int idx) const
 {
-    double x = this->positions(idx, 0);
-    double y = this->positions(idx, 1);
-    double z = this->positions(idx, 2);
-    CellListResult result = this->getNeighboursForPosition(x, y, z);
-
-    // Remove self from neighbours
-    for (size_t i=0; i < result.indices.size(); ++i) {
-        if (result.indices[i] == idx) {
-            result.indices.erase(result.indices.begin() + i);
-            result.distances.erase(result.distances.begin() + i);
-            result.distancesSquared.erase(result.distancesSquared.begin() + i);
-            break;
+    const double* position = &this->binPositions[3*this->binLocations[idx]];
+    CellListNeighbours neighbours;
+    this->getNeighboursForPosition(position[0], position[1], position[2], neighbours);
+
+    // Remove self from neighbours. Periodic images of the atom itself are
+    // kept.
+    CellListResult result;
+    for (size_t i=0; i < neighbours.indices.size(); ++i) {
+        if (neighbours.indices[i] == idx && neighbours.images[i] == 0) {
+            continue;
         }
+        result.indices.push_back(neighbours.indices[i]);
+        result.distances.push_back(sqrt(neighbours.distancesSquared[i]));
+        result.distancesSquared.push_back(neighbours.distancesSquared[i]);
     }
     return result;
 }
+
+void CellList::setPosition(const int idx, const double x, const double y, const double z)
+{
+    // Nothing is stored when the cell list is not initialized
+    if (this->binLocations.empty()) {
+        return;
+    }
+    double* position = &this->binPositions[3*this->binLocations[idx]];
+    position[0] = x;
+    position[1] = y;
+    position[2] = z;
+}
+
+const double* CellList::getShift(const int image) const
+{
+    return &this->shifts[3*image];
+}
+
+int CellList::getNumberOfImages() const
+{
+    return this->shifts.size()/3;
+}
@@ -29,7 +29,46 @@ struct CellListResult {
 };
 
 /**
- * For calculating pairwise distances using a cell list.
+ * Caller-owned buffers for the results of a neighbour query. Each query
+ * clears the buffers but keeps their capacity, so reusing the same instance
+ * avoids allocating memory for every query. The displacements point from the
+ * query position to the neighbour. For periodic systems the same atom may be
+ * found several times, once for each periodic image within the cutoff.
+ */
+struct CellListNeighbours {
+    void clear();
+    /**
+     * Reorders the neighbours so that the neighbours in the same group are
+     * stored contiguously. The order of the neighbours within a group is
+     * kept, and the neighbours of group g are then found in the range
+     * [groupOffsets[g], groupOffsets[g + 1]). Neighbours with a negative
+     * group are removed.
+     *
+     * @param atomGroups The group of each atom, indexed by atom index.
+     * @param nGroups Number of groups.
+     */
+    void sortByGroup(const vector<int> &atomGroups, int nGroups);
+
+    vector<int> indices;
+    vector<int> images;
+    vector<double> dx;
+    vector<double> dy;
+    vector<double> dz;
+    vector<double> distancesSquared;
+    vector<int> groupOffsets;
+
+    private:
+        vector<int> order;
+        vector<int> intBuffer;
+        vector<double> doubleBuffer;
+};
+
+/**
+ * For calculating pairwise distances using a cell list. The atoms are stored
+ * in a compressed format: one array of atom indices and positions sorted by
+ * bin, and the offsets at which each bin starts. Periodic systems are not
+ * replicated: the bins only contain the original atoms and a query is
+ * repeated for every periodic image shift that can reach the cutoff.
  */
 class CellList {
     public:
@@ -40,6 +79,26 @@ class CellList {
          * @param atomicNumbers Atomic numbers.
          */
         CellList(py::array_t<double> positions, double cutoff);
+        /**
+         * Constructor for periodic systems.
+         *
+         * @param positions Atomic positions in cartesian coordinates.
+         * @param cutoff Radial cutoff.
+         * @param cell Unit cell.
+         * @param pbc Periodic boundary conditions (array of three booleans).
+         */
+        CellList(py::array_t<double> positions, double cutoff, py::array_t<double> cell, py::array_t<bool> pbc);
+        /**
+         * Constructors for a Verlet list. The bins and the periodic image
+         * shifts are made for the cutoff extended by the skin, but the
+         * queries only return the neighbours within the cutoff. The queries
+         * stay exact as long as no atom has been moved with setPosition by
+         * more than half of the skin.
+         *
+         * @param skin Distance by which the cutoff is extended.
+         */
+        CellList(py::array_t<double> positions, double cutoff, double skin);
+        CellList(py::array_t<double> positions, double cutoff, double skin, py::array_t<double> cell, py::array_t<bool> pbc);
         /**
          * Get the indices of atoms within the radial cutoff distance from the
          * given position.
@@ -49,6 +108,11 @@ class CellList {
          * @param z Cartesian z-coordinate.
          */
         CellListResult getNeighboursForPosition(const double x, const double y, const double z) const;
+        /**
+         * Same as above, but the neighbour indices, displacements and squared
+         * distances are written into the given buffers.
+         */
+        void getNeighboursForPosition(const double x, const double y, const double z, CellListNeighbours &neighbours) const;
         /**
          * Get the indices of atoms within the radial cutoff distance from the
          * given atomic index. The given index is not included in the returned
@@ -57,17 +121,39 @@ class CellList {
          * @param i Index of the atom for which neighbours are queried for.
          */
         CellListResult getNeighboursForIndex(const int i) const;
+        /**
+         * Changes the position of an atom without moving it to another bin.
+         * Meant for the small displacements used in finite differences and
+         * for moving the atoms of a Verlet list.
+         *
+         * @param i Index of the atom to move.
+         * @param x Cartesian x-coordinate.
+         * @param y Cartesian y-coordinate.
+         * @param z Cartesian z-coordinate.
+         */
+        void setPosition(const int i, const double x, const double y, const double z);
+        /**
+         * Returns the cartesian translation of the given periodic image. The
+         * image zero is the original system.
+         *
+         * @param image Index of the periodic image.
+         */
+        const double* getShift(const int image) const;
+        /**
+         * Returns the number of periodic images that are searched.
+         */
+        int getNumberOfImages() const;
 
     private:
         /**
          * Used to initialize the cell list. Querying for distances is only
          * possible after this initialization.
          */
-        void init();
+        void init(const py::detail::unchecked_reference<double, 2> &positions);
 
-        const py::detail::unchecked_reference<double, 2> positions;
         const double cutoff;
         const double cutoffSquared;
+        const double binSize;
         double xmin;
         double xmax;
         double ymin;
@@ -80,7 +166,11 @@ class CellList {
         int nx;
         int ny;
         int nz;
-        vector<vector<vector<vector<int>>>> bins;
+        vector<int> binOffsets;
+        vector<int> binIndices;
+        vector<double> binPositions;
+        vector<int> binLocations;
+        vector<double> shifts;
 };
 
 #endif
@@ -13,27 +13,69 @@ See the License for the specific language governing permissions and
 limitations under the License.
 */
 #include "cm.h"
-#include "celllist.h"
-#include "geometry.h"
+#include "threadpool.h"
+#include "profiling.h"
 #include <math.h>
-#include <numeric>
-#include <iostream>
+#include <stdexcept>
 
 using namespace std;
 using namespace Eigen;
 
+namespace {
+
+/**
+ * The diagonal elements 0.5*Z^2.4 for the atomic numbers up to Z_TABLE_MAX.
+ */
+const int Z_TABLE_MAX = 118;
+const vector<double> &diagonal_table()
+{
+    static const vector<double> table = []() {
+        vector<double> values(Z_TABLE_MAX + 1);
+        for (int z = 0; z <= Z_TABLE_MAX; ++z) {
+            values[z] = 0.5 * pow(z, 2.4);
+        }
+        return values;
+    }();
+    return table;
+}
+
+/**
+ * Fills the given n_atoms x n_atoms matrix. The positions and atomic
+ * numbers are accessed with positions(i, k) and atomic_numbers(i).
+ */
+template <typename Positions, typename AtomicNumbers>
+void fill_coulomb_matrix(
+    const Positions &positions,
+    const AtomicNumbers &atomic_numbers,
+    int n_atoms,
+    Ref<MatrixXd> matrix
+)
+{
+    const vector<double> &diagonal = diagonal_table();
+    for (int i = 0; i < n_atoms; ++i) {
+        int z_i = atomic_numbers(i);
+        matrix(i, i) = z_i <= Z_TABLE_MAX ? diagonal[z_i] : 0.5 * pow(z_i, 2.4);
+        for (int j = i + 1; j < n_atoms; ++j) {
+            double dx = positions(i, 0) - positions(j, 0);
+            double dy = positions(i, 1) - positions(j, 1);
+            double dz = positions(i, 2) - positions(j, 2);
+            double value = z_i * atomic_numbers(j) / sqrt(dx*dx + dy*dy + dz*dz);
+            matrix(i, j) = value;
+            matrix(j, i) = value;
+        }
+    }
+}
+
+}
+
 CoulombMatrix::CoulombMatrix(
     unsigned int n_atoms_max,
     string permutation,
     double sigma,
-    int seed
+    int seed,
+    bool triangular
 )
-    : DescriptorGlobal(false)
-    , n_atoms_max(n_atoms_max)
-    , permutation(permutation)
-    , sigma(sigma)
-    , seed(seed)
-    , generator(seed)
+    : DescriptorMatrix(n_atoms_max, permutation, sigma, seed, triangular)
 {
 }
 
@@ -41,104 +83,77 @@ void CoulombMatrix::create_raw(
     py::detail::unchecked_mutable_reference<double, 1> &out_mu, 
     py::detail::unchecked_reference<double, 2> &positions_u, 
     py::detail::unchecked_reference<int, 1> &atomic_numbers_u,
+    py::detail::unchecked_reference<double, 2> &cell_u,
     CellList &cell_list
 )
 {
-    // Calculate all pairwise distances.
     int n_atoms = atomic_numbers_u.shape(0);
-    MatrixXd matrix = distancesEigen(positions_u);
-
-    // Construct matrix
-    for (int i = 0; i < n_atoms; ++i) {
-        for (int j = i; j < n_atoms; ++j) {
-            if (j == i) {
-                matrix(i, j) = 0.5 * pow(atomic_numbers_u(i), 2.4);
-            } else {
-                double value = atomic_numbers_u(i) * atomic_numbers_u(j) / matrix(i, j);
-                matrix(i, j) = value;
-                matrix(j, i) = value;
-            }
-        }
-    }
-
-    // Handle the permutation option
-    if (this->permutation == "eigenspectrum") {
-        this->get_eigenspectrum(matrix, out_mu);
-    } else {
-        if (this->permutation == "sorted_l2") {
-            this->sort(matrix, false);
-        } else if (this->permutation == "random") {
-            this->sort(matrix, true);
-        }
-        // Flatten. Notice that we have to flatten in a way that takes into
-        // account the size of the entire matrix.
-        int k = 0;
-        int diff = this->n_atoms_max - n_atoms;
-        for (int i = 0; i < n_atoms; ++i) {
-            for (int j = 0; j < n_atoms; ++j) {
-                out_mu(k) = matrix(i, j);
-                ++k;
-            }
-            k += diff;
-        }
-    }
+    MatrixXd matrix(n_atoms, n_atoms);
+    fill_coulomb_matrix(positions_u, atomic_numbers_u, n_atoms, matrix);
+    this->set_output(matrix, out_mu);
 }
 
-void CoulombMatrix::get_eigenspectrum(
-    const Ref<const MatrixXd> &matrix,
-    py::detail::unchecked_mutable_reference<double, 1> &out_mu
+void CoulombMatrix::create_batch(
+    py::array_t<double> out,
+    py::array_t<double, py::array::c_style | py::array::forcecast> positions,
+    py::array_t<int, py::array::c_style | py::array::forcecast> atomic_numbers,
+    py::array_t<int> atom_offsets
 )
 {
-    // Calculate eigenvalues with Eigen
-    SelfAdjointEigenSolver<MatrixXd> eigensolver(matrix, EigenvaluesOnly);
-    Eigen::VectorXd eigenvalues = eigensolver.eigenvalues();
-
-    // Sort the values in descending order by absolute value
-    std::sort(
-        eigenvalues.data(),
-        eigenvalues.data()+eigenvalues.size(),
-        [ ]( const double& lhs, const double& rhs ) {
-            return abs(lhs) > abs(rhs);
-        }
-    );
-
-    // Copy to output
-    for (int i = 0; i < matrix.cols(); ++i) {
-        out_mu[i] = eigenvalues(i);
+    int n_systems = atom_offsets.size() - 1;
+    int n_features = this->get_number_of_features();
+    if (n_systems < 0) {
+        throw invalid_argument("The atom offsets must have one entry more than there are systems.");
     }
-}
-
-void CoulombMatrix::sort(Ref<MatrixXd> matrix, bool noise)
-{
-    // Calculate row norms
-    VectorXd norms = matrix.rowwise().norm();
-    int n_atoms = matrix.rows();
-
-    // Introduce noise with norm as mean and sigma as standard deviation.
-    if (noise) {
-        for (int i = 0; i < norms.size(); ++i) {
-            normal_distribution<double> distribution(norms(i), this->sigma);
-            norms(i) = distribution(this->generator);
+    if (out.ndim() != 2 || out.shape(0) != n_systems || out.shape(1) != n_features || out.strides(1) != sizeof(double) || out.strides(0) != n_features*(ssize_t)sizeof(double)) {
+        throw invalid_argument("The output must be a C-contiguous array with one row per system and one column per feature.");
+    }
+    auto atom_offsets_u = atom_offsets.unchecked<1>();
+    if (atom_offsets_u(0) != 0 || atom_offsets_u(n_systems) != atomic_numbers.size() || 3*atom_offsets_u(n_systems) != positions.size()) {
+        throw invalid_argument("The offsets do not match the size of the given arrays.");
+    }
+    for (int i = 0; i < n_systems; ++i) {
+        int n_atoms = atom_offsets_u(i+1) - atom_offsets_u(i);
+        if (n_atoms < 0 || n_atoms > (int)this->n_atoms_max) {
+            throw invalid_argument("One of the given systems has more atoms than allowed by n_atoms_max.");
         }
     }
-
-    // Sort the pairs by norm.
-    VectorXi indices(n_atoms);
-    iota(indices.begin(), indices.end(), 0);
-    std::stable_sort(indices.begin(), indices.end(), [&norms](int a, int b) { return norms(a) > norms(b); } );
-
-    // Sort matrix in place. Notice that we sort both rows and columns. This way
-    // the interpretation of the matrix as pairwise interaction of atoms is
-    // still valid. NOTE: Getting eigen to correctly sort both columns and rows
-    // with the same order was non-trivial, but the following syntax seems to
-    // work fine.
-    PermutationMatrix<Dynamic> P(indices);
-    matrix = P.transpose() * matrix * P;
-}
-
-int CoulombMatrix::get_number_of_features() const
-{
-    return this->permutation == "eigenspectrum"
-        ? this->n_atoms_max
-        : this->n_atoms_max * this->n_atoms_max;
+    double* out_data = out.mutable_data();
+    const double* positions_data = positions.data();
+    const int* atomic_numbers_data = atomic_numbers.data();
+
+    // Each chunk of systems reuses one matrix that fits the largest system
+    // and one workspace. The noise of the random permutation is drawn from a
+    // generator that is seeded separately for each system, so the output
+    // does not depend on how the systems are divided between the threads.
+    // The base of the seeds is drawn from the generator of the descriptor,
+    // so that every call gives new permutations.
+    const unsigned int base_seed = this->permutation == "random" ? this->generator() : 0;
+    GILRelease release;
+    ScopedTimer timer(this->get_name(), "create_batch");
+    Profiler::add_count(this->get_name(), "systems", n_systems);
+    parallel_for(n_systems, [&](int begin, int end, int) {
+        MatrixXd buffer(this->n_atoms_max, this->n_atoms_max);
+        Profiler::add_count(this->get_name(), "bytes_allocated", buffer.size()*sizeof(double));
+        MatrixWorkspace workspace;
+        mt19937 generator;
+        for (int i = begin; i < end; ++i) {
+            int i_atom = atom_offsets_u(i);
+            int n_atoms = atom_offsets_u(i+1) - i_atom;
+            if (n_atoms == 0) {
+                continue;
+            }
+            const double* pos = positions_data + 3*i_atom;
+            const int* z = atomic_numbers_data + i_atom;
+            auto matrix = buffer.topLeftCorner(n_atoms, n_atoms);
+            fill_coulomb_matrix(
+                [pos](int j, int k) { return pos[3*j + k]; },
+                [z](int j) { return z[j]; },
+                n_atoms,
+                matrix
+            );
+            generator.seed(base_seed + i);
+            this->set_output(matrix, out_data + (ssize_t)i*n_features, workspace, generator);
+        }
+    });
 }
@@ -16,20 +16,16 @@ limitations under the License.
 #ifndef CM_H
 #define CM_H
 
-#include <string>
-#include <random>
 #include <pybind11/numpy.h>
-#include <Eigen/Dense>
-#include "descriptorglobal.h"
+#include "descriptormatrix.h"
 
 namespace py = pybind11;
 using namespace std;
-using namespace Eigen;
 
 /**
  * Coulomb matrix descriptor.
  */
-class CoulombMatrix: public DescriptorGlobal {
+class CoulombMatrix: public DescriptorMatrix {
     public:
         /**
          * Constructor, see the python docs for more details about variables.
@@ -38,7 +34,8 @@ class CoulombMatrix: public DescriptorGlobal {
             unsigned int n_atoms_max,
             string permutation,
             double sigma,
-            int seed
+            int seed,
+            bool triangular=false
         );
 
         /**
@@ -48,34 +45,25 @@ class CoulombMatrix: public DescriptorGlobal {
             py::detail::unchecked_mutable_reference<double, 1> &out_mu, 
             py::detail::unchecked_reference<double, 2> &positions_u, 
             py::detail::unchecked_reference<int, 1> &atomic_numbers_u,
+            py::detail::unchecked_reference<double, 2> &cell_u,
             CellList &cell_list
         );
 
-        /**
-         * Get the number of features.
-         */
-        int get_number_of_features() const;
+        const char* get_name() const {return "CoulombMatrix";};
 
         /**
-         * Calculate sorted eigenvalues.
+         * Creates the output for multiple systems with one call. The atoms of
+         * all systems are concatenated and system i owns the atoms
+         * [atom_offsets[i], atom_offsets[i+1]). The output for system i is
+         * written to row i of the zero initialized, C-contiguous output. The
+         * systems are divided between the native threads, and each thread
+         * reuses the same matrix and eigensolver for all of its systems.
          */
-        void get_eigenspectrum(
-            const Ref<const MatrixXd> &matrix,
-            py::detail::unchecked_mutable_reference<double, 1> &out_mu
+        void create_batch(
+            py::array_t<double> out,
+            py::array_t<double, py::array::c_style | py::array::forcecast> positions,
+            py::array_t<int, py::array::c_style | py::array::forcecast> atomic_numbers,
+            py::array_t<int> atom_offsets
         );
-
-        /**
-         * Sort by row L2 norm, possibly introducing noise.
-         */
-        void sort(Ref<MatrixXd> matrix, bool noise);
-
-
-        unsigned int n_atoms_max;
-        string permutation;
-        double sigma;
-        int seed;
-
-    private:
-        mt19937 generator;
 };
 #endif
@@ -13,14 +13,70 @@ See the License for the specific language governing permissions and
 limitations under the License.
 */
 
+#include <algorithm>
 #include <set>
 #include <unordered_map>
 #include <cmath>
+#include <cstdint>
 #include "descriptor.h"
-#include "geometry.h"
+#include "finitedifference.h"
+#include "threadpool.h"
+#include "profiling.h"
 
 using namespace std;
 
+void SparseDerivatives::append(SparseDerivatives &other)
+{
+    this->centers.insert(this->centers.end(), other.centers.begin(), other.centers.end());
+    this->indices.insert(this->indices.end(), other.indices.begin(), other.indices.end());
+    this->components.insert(this->components.end(), other.components.begin(), other.components.end());
+    this->features.insert(this->features.end(), other.features.begin(), other.features.end());
+    this->data.insert(this->data.end(), other.data.begin(), other.data.end());
+    other = SparseDerivatives();
+}
+
+py::tuple sparse_derivatives_to_coo(const SparseDerivatives &sparse)
+{
+    const ssize_t n = sparse.data.size();
+    py::array_t<int64_t> coords({(ssize_t)4, n});
+    py::array_t<double> data(n);
+    auto coords_mu = coords.mutable_unchecked<2>();
+    copy(sparse.data.begin(), sparse.data.end(), data.mutable_data());
+    for (ssize_t q = 0; q < n; ++q) {
+        coords_mu(0, q) = sparse.centers[q];
+        coords_mu(1, q) = sparse.indices[q];
+        coords_mu(2, q) = sparse.components[q];
+        coords_mu(3, q) = sparse.features[q];
+    }
+    return py::make_tuple(coords, data);
+}
+
+vector<int> get_species_index(py::array_t<int> species)
+{
+    auto species_u = species.unchecked<1>();
+    int max_z = -1;
+    for (ssize_t i = 0; i < species_u.shape(0); ++i) {
+        max_z = max(max_z, species_u(i));
+    }
+    vector<int> species_index(max_z + 1, -1);
+    for (ssize_t i = 0; i < species_u.shape(0); ++i) {
+        species_index[species_u(i)] = i;
+    }
+    return species_index;
+}
+
+void get_atom_species(vector<int> &atom_species, py::array_t<int> atomic_numbers, const vector<int> &species_index)
+{
+    auto atomic_numbers_u = atomic_numbers.unchecked<1>();
+    const int n_atoms = atomic_numbers_u.shape(0);
+    const int n_z = species_index.size();
+    atom_species.resize(n_atoms);
+    for (int i = 0; i < n_atoms; ++i) {
+        const int z = atomic_numbers_u(i);
+        atom_species[i] = (z >= 0 && z < n_z) ? species_index[z] : -1;
+    }
+}
+
 Descriptor::Descriptor(bool periodic, string average, double cutoff)
     : periodic(periodic)
     , average(average)
@@ -28,6 +84,139 @@ Descriptor::Descriptor(bool periodic, string average, double cutoff)
 {
 }
 
+void Descriptor::create(
+    py::array_t<float, py::array::c_style> out,
+    py::array_t<double> positions,
+    py::array_t<int> atomic_numbers,
+    py::array_t<double> cell,
+    py::array_t<bool> pbc,
+    py::array_t<double> centers
+) const
+{
+    py::array_t<double> out_double({out.shape(0), out.shape(1)});
+    Profiler::add_count(this->get_name(), "bytes_allocated", out_double.nbytes());
+    {
+        ScopedTimer timer(this->get_name(), "conversion");
+        copy(out.data(), out.data() + out.size(), out_double.mutable_data());
+    }
+    this->create(out_double, positions, atomic_numbers, cell, pbc, centers);
+    ScopedTimer timer(this->get_name(), "conversion");
+    copy(out_double.data(), out_double.data() + out_double.size(), out.mutable_data());
+}
+
+void Descriptor::create_batch(
+    py::array out,
+    py::array_t<double, py::array::c_style | py::array::forcecast> positions,
+    py::array_t<int, py::array::c_style | py::array::forcecast> atomic_numbers,
+    py::array_t<int> atom_offsets,
+    py::array_t<double, py::array::c_style | py::array::forcecast> cells,
+    py::array_t<bool, py::array::c_style | py::array::forcecast> pbc,
+    py::array_t<double, py::array::c_style | py::array::forcecast> centers,
+    py::array_t<int> center_offsets
+) const
+{
+    int n_features = this->get_number_of_features();
+    bool is_float = py::isinstance<py::array_t<float>>(out);
+    if (!is_float && !py::isinstance<py::array_t<double>>(out)) {
+        throw invalid_argument("The output must be a float32 or float64 array.");
+    }
+    if (out.ndim() != 2 || out.shape(1) != n_features || out.strides(1) != out.itemsize() || out.strides(0) != n_features*out.itemsize()) {
+        throw invalid_argument("The output must be a C-contiguous array with one column per feature.");
+    }
+    if (is_float) {
+        this->create_systems<float>(out, positions, atomic_numbers, atom_offsets, cells, pbc, centers, center_offsets);
+    } else {
+        this->create_systems<double>(out, positions, atomic_numbers, atom_offsets, cells, pbc, centers, center_offsets);
+    }
+}
+
+namespace {
+/**
+ * The type of the output that Descriptor::create takes for the scalar type T.
+ */
+template <typename T>
+struct OutputArray {
+    typedef py::array_t<T> type;
+};
+
+template <>
+struct OutputArray<float> {
+    typedef py::array_t<float, py::array::c_style> type;
+};
+}
+
+template <typename T>
+void Descriptor::create_systems(
+    py::array out,
+    py::array_t<double, py::array::c_style | py::array::forcecast> positions,
+    py::array_t<int, py::array::c_style | py::array::forcecast> atomic_numbers,
+    py::array_t<int> atom_offsets,
+    py::array_t<double, py::array::c_style | py::array::forcecast> cells,
+    py::array_t<bool, py::array::c_style | py::array::forcecast> pbc,
+    py::array_t<double, py::array::c_style | py::array::forcecast> centers,
+    py::array_t<int> center_offsets
+) const
+{
+    int n_systems = atom_offsets.size() - 1;
+    int n_features = this->get_number_of_features();
+    bool averaged = this->average != "off";
+    if (n_systems < 0 || center_offsets.size() != atom_offsets.size()) {
+        throw invalid_argument("The atom and center offsets must have one entry more than there are systems.");
+    }
+    if (cells.ndim() != 3 || cells.shape(0) != n_systems || pbc.ndim() != 2 || pbc.shape(0) != n_systems) {
+        throw invalid_argument("A cell and pbc is needed for each system.");
+    }
+    auto atom_offsets_u = atom_offsets.unchecked<1>();
+    auto center_offsets_u = center_offsets.unchecked<1>();
+    ssize_t n_rows_total = averaged ? n_systems : center_offsets_u(n_systems);
+    if (atom_offsets_u(n_systems) != atomic_numbers.size() || 3*atom_offsets_u(n_systems) != positions.size() || 3*center_offsets_u(n_systems) != centers.size() || out.shape(0) != n_rows_total) {
+        throw invalid_argument("The offsets do not match the size of the given arrays.");
+    }
+
+    // The systems are passed on as views into the concatenated arrays, so no
+    // data is copied.
+    T* out_p = static_cast<T*>(out.mutable_data());
+    auto create_system = [&](int i) {
+        int i_atom = atom_offsets_u(i);
+        int n_atoms = atom_offsets_u(i+1) - i_atom;
+        int i_center = center_offsets_u(i);
+        int n_centers = center_offsets_u(i+1) - i_center;
+        if (n_centers == 0) {
+            return;
+        }
+        int i_row = averaged ? i : i_center;
+        int n_rows = averaged ? 1 : n_centers;
+        this->create(
+            typename OutputArray<T>::type({n_rows, n_features}, out_p + (size_t)i_row*n_features, out),
+            py::array_t<double>({n_atoms, 3}, positions.data() + 3*i_atom, positions),
+            py::array_t<int>({n_atoms}, atomic_numbers.data() + i_atom, atomic_numbers),
+            py::array_t<double>({3, 3}, cells.data(i, 0, 0), cells),
+            py::array_t<bool>({3}, pbc.data(i, 0), pbc),
+            py::array_t<double>({n_centers, 3}, centers.data() + 3*i_center, centers)
+        );
+    };
+
+    // With fewer systems than threads it is better to let each system use
+    // all of the threads.
+    if (n_systems < 2 || n_systems < get_num_threads()) {
+        for (int i = 0; i < n_systems; ++i) {
+            create_system(i);
+        }
+        return;
+    }
+
+    // Each system is its own chunk so that the threads are balanced even
+    // when the system sizes vary. The systems run serially inside the
+    // threads and the GIL is only held while the views are created.
+    GILRelease release;
+    parallel_for(n_systems, n_systems, [&](int begin, int end, int) {
+        py::gil_scoped_acquire acquire;
+        for (int i = begin; i < end; ++i) {
+            create_system(i);
+        }
+    });
+}
+
 /**
  * The general idea: each atom for which a derivative is requested is
  * "wiggled" with central finite difference. The following tricks are used
@@ -37,14 +226,15 @@ Descriptor::Descriptor(bool periodic, string average, double cutoff)
  *    create-method.
  *  - Only centers within the cutoff distance from the wiggled atom are
  *    taken into account by calculating a separate CellList for the
- *    centers. Note that this optimization cannot be naively applied when
- *    averaging centers.
+ *    centers. With outer averaging the average is a mean over the centers,
+ *    so the local centers are used and the result is scaled with their
+ *    share of all centers. Inner averaging still needs all the centers.
  *  - Atoms for which there are no neighouring centers are skipped.
- *
- *  TODO:
- *  - Symmetry of the derivatives should be taken into account (derivatives
- *    of [i, j] is -[j, i] AND species position should be swapped)
- *  - Using only the local centers in the averaged case.
+ *  - The atoms are divided between the native threads. Each thread moves
+ *    the atoms in its own copy of the positions and the CellList and reuses
+ *    the same output buffer for every stencil point.
+ *  - The stencil comes from central_stencil, which the python implementation
+ *    also reads, so both use the same step size and coefficients.
  *
  *  Notice that these optimization are NOT valid:
  *  - Self-derivatives are NOT always zero, only zero for l=0. The shape of
@@ -61,89 +251,96 @@ void Descriptor::derivatives_numerical(
     py::array_t<int> center_indices,
     py::array_t<int> indices,
     bool attach,
-    bool return_descriptor
+    bool return_descriptor,
+    int stencil_order
 ) const
 {
-    int n_copies = 1;
-    int n_atoms = atomic_numbers.size();
+    ScopedTimer timer(this->get_name(), "numerical_derivatives");
+    const Stencil stencil = central_stencil(stencil_order);
     int n_features = this->get_number_of_features();
+    int n_atoms = positions.shape(0);
+    int n_centers = centers.shape(0);
+    int n_indices = indices.size();
     auto derivatives_mu = derivatives.mutable_unchecked<4>();
     auto indices_u = indices.unchecked<1>();
     auto pbc_u = pbc.unchecked<1>();
-    py::array_t<int> center_true_indices;
-    py::array_t<double> centers_extended;
+    auto center_indices_u = center_indices.unchecked<1>();
+    auto centers_u = centers.unchecked<2>();
+    const bool inner = this->average == "inner";
+    const bool outer = this->average == "outer";
 
-    // Extend the system if it is periodic
+    // Pre-calculate cell list for atoms. For periodic systems the cell list
+    // finds the periodic copies, which move together with the original atom.
     bool is_periodic = this->periodic && (pbc_u(0) || pbc_u(1) || pbc_u(2));
-    if (is_periodic) {
-        ExtendedSystem system_extension = extend_system(positions, atomic_numbers, cell, pbc, this->cutoff);
-        n_copies = system_extension.atomic_numbers.size()/atomic_numbers.size();
-        positions = system_extension.positions;
-        atomic_numbers = system_extension.atomic_numbers;
-    }
-    auto positions_mu = positions.mutable_unchecked<2>();
-
-    // Pre-calculate cell list for atoms
-    CellList cell_list_atoms(positions, this->cutoff);
+    CellList cell_list_atoms = is_periodic
+        ? CellList(positions, this->cutoff, cell, pbc)
+        : CellList(positions, this->cutoff);
 
-    // Calculate the desciptor value if requested. This needs to be done with
-    // the non-extended centers, but extended system.
+    // Calculate the desciptor value if requested
     if (return_descriptor) {
         this->create(descriptor, positions, atomic_numbers, centers, cell_list_atoms);
     }
 
-    // Create the extended centers for periodic systems.
-    if (is_periodic) {
-        ExtendedSystem center_extension = extend_system(centers, center_indices, cell, pbc, this->cutoff);
-        centers_extended = center_extension.positions;
-        center_true_indices = center_extension.indices;
-    } else {
-        centers_extended = centers;
-        center_true_indices = center_indices;
+    // Pre-calculate cell list for centers. For periodic systems this also
+    // finds the centers that are within the cutoff through a periodic copy.
+    CellList cell_list_centers = is_periodic
+        ? CellList(centers, this->cutoff, cell, pbc)
+        : CellList(centers, this->cutoff);
+
+    // Every chunk of atoms gets its own copy of the positions and of the
+    // CellList in which the atoms are moved, and its own buffers for the
+    // centers and the output. The first chunk moves the atoms in the
+    // original ones, which are restored after each atom. Allocating these
+    // needs the GIL.
+    const int n_chunks = get_num_chunks(n_indices);
+    vector<py::array_t<double>> positions_chunk = {positions};
+    vector<CellList> cell_list_chunk = {cell_list_atoms};
+    vector<py::array_t<double>> centers_chunk;
+    vector<py::array_t<double>> out_chunk;
+    for (int i_chunk = 0; i_chunk < n_chunks; ++i_chunk) {
+        if (i_chunk > 0) {
+            py::array_t<double> positions_copy({n_atoms, 3});
+            copy(positions.data(), positions.data() + 3*n_atoms, positions_copy.mutable_data());
+            positions_chunk.push_back(positions_copy);
+            cell_list_chunk.push_back(cell_list_atoms);
+        }
+        py::array_t<double> centers_copy({n_centers, 3});
+        copy(centers.data(), centers.data() + 3*n_centers, centers_copy.mutable_data());
+        centers_chunk.push_back(centers_copy);
+        out_chunk.push_back(py::array_t<double>({this->average == "off" ? n_centers : 1, n_features}));
     }
 
-    auto centers_u = centers.unchecked<2>();
-
-    // Pre-calculate cell list for centers.
-    CellList cell_list_centers(centers_extended, this->cutoff);
-
-    // Central finite difference with error O(h^2)
-    double h = 0.0001;
-    vector<double> coefficients = {-1.0/2.0, 1.0/2.0};
-    vector<double> displacement = {-1.0, 1.0};
+    auto process = [&](int begin, int end, int i_chunk) {
+    py::array_t<double> &positions_c = positions_chunk[i_chunk];
+    CellList &cell_list_c = cell_list_chunk[i_chunk];
+    auto positions_mu = positions_c.mutable_unchecked<2>();
+    auto centers_c_mu = centers_chunk[i_chunk].mutable_unchecked<2>();
+    double* out_data = out_chunk[i_chunk].mutable_data();
+    CellListNeighbours neighbours;
+    vector<bool> seen(n_centers, false);
 
     // Loop over all atoms
-    for (int i_pos=0; i_pos < indices_u.size(); ++i_pos) {
+    for (int i_pos = begin; i_pos < end; ++i_pos) {
         int i_atom = indices_u(i_pos);
 
-        // Create a list of all atom indices that should be moved. For periodic
-        // systems all of the periodic copies need to be moved as well.
-        vector<int> i_atom_indices(n_copies);
-        for (int i = 0; i < n_copies; ++i) {
-            i_atom_indices[i] = i_atom + i*n_atoms;
-        }
-
-        // Get all centers within the cutoff range from the current atom.
+        // Get all centers within the cutoff range from the current atom. The
+        // same center may be found through several periodic images, in which
+        // case it is only included once.
         double ix = positions_mu(i_atom, 0);
         double iy = positions_mu(i_atom, 1);
         double iz = positions_mu(i_atom, 2);
-        vector<int> centers_local_idx = cell_list_centers.getNeighboursForPosition(ix, iy, iz).indices;
-
-        // The periodically repeated centers are already correctly found from
-        // the extended center list. They just need to be mapped into the
-        // correct centers in the original list, as the original center
-        // position should be used (the atoms are periodically repeated and all
-        // periodic copies are moved for the finite difference).
-        if (is_periodic) {
-            auto center_true_indices_u = center_true_indices.unchecked<1>();
-            set<int> centers_set;
-            for (size_t i=0; i < centers_local_idx.size(); ++i) {
-                int ext_index = centers_local_idx[i];
-                int true_index = center_true_indices_u(ext_index);
-                centers_set.insert(true_index);
+        cell_list_centers.getNeighboursForPosition(ix, iy, iz, neighbours);
+        vector<int> centers_local_idx;
+        for (const int &i_center : neighbours.indices) {
+            if (!seen[i_center]) {
+                seen[i_center] = true;
+                centers_local_idx.push_back(i_center);
             }
-            centers_local_idx = vector<int>(centers_set.begin(), centers_set.end()); 
         }
+        for (const int &i_center : centers_local_idx) {
+            seen[i_center] = false;
+        }
+        sort(centers_local_idx.begin(), centers_local_idx.end());
 
         // If there are no centers within the cutoff radius from the atom, the
         // calculation is skipped.
@@ -152,130 +349,110 @@ void Descriptor::derivatives_numerical(
             continue;
         }
 
-        // If attach = true, find the center(s) that need to be moved together
-        // with this atom.
-        vector<int> centers_to_move;
-        if (attach) {
-            auto center_true_indices_u = center_true_indices.unchecked<1>();
+        // Create a list of the center coordinates that are used. Without
+        // inner averaging only the local centers are needed, which are
+        // copied to the beginning of the center buffer. With inner
+        // averaging the buffer contains all centers.
+        int n_used = inner ? n_centers : n_locals;
+        if (!inner) {
             for (int i_local = 0; i_local < n_locals; ++i_local) {
-                int i_local_idx = centers_local_idx[i_local];
-                int true_index = center_true_indices_u(i_local_idx);
-                if (true_index == i_atom) {
-                    centers_to_move.push_back(i_local);
+                for (int i_comp = 0; i_comp < 3; ++i_comp) {
+                    centers_c_mu(i_local, i_comp) = centers_u(centers_local_idx[i_local], i_comp);
                 }
             }
         }
+        py::array_t<double> centers_used({n_used, 3}, centers_chunk[i_chunk].mutable_data(), centers_chunk[i_chunk]);
+        auto centers_used_mu = centers_used.mutable_unchecked<2>();
+
+        // The output rows for the used centers. Without averaging every local
+        // center has its own row, otherwise there is just one row.
+        int n_rows = this->average == "off" ? n_locals : 1;
+        py::array_t<double> d({n_rows, n_features}, out_data, out_chunk[i_chunk]);
+        auto d_u = d.unchecked<2>();
+        double scale = outer ? n_locals/(double)n_centers : 1.0;
 
-        // If averaging is not performed, create a list of the local center
-        // coordinates. Only this subset needs to be used. For averaged
-        // calculation it is not as simple, so for now we simply use all
-        // centers.
-        int n_centers;
-        py::array_t<double> centers_local_pos;
-        if (this->average == "off") {
-            centers_local_pos = py::array_t<double>({n_locals, 3});
-            auto centers_local_pos_mu = centers_local_pos.mutable_unchecked<2>();
+        // If attach = true, find the center(s) that need to be moved together
+        // with this atom. The indices refer to the rows of the used centers.
+        vector<int> centers_to_move;
+        if (attach) {
             for (int i_local = 0; i_local < n_locals; ++i_local) {
                 int i_local_idx = centers_local_idx[i_local];
-                for (int i_comp = 0; i_comp < 3; ++i_comp) {
-                    centers_local_pos_mu(i_local, i_comp) = centers_u(i_local_idx, i_comp);
+                if (center_indices_u(i_local_idx) == i_atom) {
+                    centers_to_move.push_back(inner ? i_local_idx : i_local);
                 }
             }
-            n_centers = n_locals;
-        } else {
-            centers_local_pos = centers;
-            centers_local_idx = vector<int>{0};
-            n_centers = 1;
-        }
-        auto centers_local_pos_mu = centers_local_pos.mutable_unchecked<2>();
-
-        // Create a copy of the original atom position(s). These will be used
-        // to reset the positions after each displacement.
-        py::array_t<double> pos({n_copies, 3});
-        auto pos_mu = pos.mutable_unchecked<2>();
-        for (size_t i_copy = 0; i_copy < i_atom_indices.size(); ++i_copy) {
-            int j_copy = i_atom_indices[i_copy];
-            for (int i = 0; i < 3; ++i) {
-                pos_mu(i_copy, i) = positions_mu(j_copy, i);
-            }
         }
 
-        // If attach = true, create a copy of the original center position(s).
-        // These will be used to reset the center positions after each
-        // displacement.
-        py::array_t<double> centers_moved({(int)centers_to_move.size(), 3});
-        auto centers_moved_mu = centers_moved.mutable_unchecked<2>();
-        if (attach) {
-            for (size_t i_copy = 0; i_copy < centers_to_move.size(); ++i_copy) {
-                int j_copy = centers_to_move[i_copy];
-                for (int i = 0; i < 3; ++i) {
-                    centers_moved_mu(i_copy, i) = centers_local_pos_mu(j_copy, i);
-                }
+        // Create a copy of the original atom position and of the moved
+        // center positions. These will be used to reset the positions after
+        // each displacement.
+        double pos[3] = {ix, iy, iz};
+        vector<double> centers_moved;
+        for (const int &j_copy : centers_to_move) {
+            for (int i = 0; i < 3; ++i) {
+                centers_moved.push_back(centers_used_mu(j_copy, i));
             }
         }
 
         for (int i_comp=0; i_comp < 3; ++i_comp) {
-            for (int i_stencil=0; i_stencil < 2; ++i_stencil) {
+            for (size_t i_stencil=0; i_stencil < stencil.coefficients.size(); ++i_stencil) {
+                double delta = stencil.h*stencil.displacements[i_stencil];
 
-                // Introduce the displacement(s). Displacement are done for all
-                // periodic copies as well.
-                for (size_t i_copy = 0; i_copy < i_atom_indices.size(); ++i_copy) {
-                    int j_copy = i_atom_indices[i_copy];
-                    positions_mu(j_copy, i_comp) = pos_mu(i_copy, i_comp) + h*displacement[i_stencil];
-                }
+                // Introduce the displacement. The cell list moves the periodic
+                // copies as well.
+                positions_mu(i_atom, i_comp) = pos[i_comp] + delta;
+                cell_list_c.setPosition(i_atom, positions_mu(i_atom, 0), positions_mu(i_atom, 1), positions_mu(i_atom, 2));
 
                 // If attach = true, we also move the center(s) that are
                 // attached to this atom.
-                if (attach) {
-                    for (size_t i_copy = 0; i_copy < centers_to_move.size(); ++i_copy) {
-                        int j_copy = centers_to_move[i_copy];
-                        centers_local_pos_mu(j_copy, i_comp) = centers_moved_mu(i_copy, i_comp) + h*displacement[i_stencil];
-                    }
+                for (size_t i_copy = 0; i_copy < centers_to_move.size(); ++i_copy) {
+                    centers_used_mu(centers_to_move[i_copy], i_comp) = centers_moved[3*i_copy + i_comp] + delta;
                 }
 
-                // Initialize temporary numpy array for storing the descriptor
-                // for this stencil point
-                double* dTemp = new double[n_centers*n_features]();
-                py::array_t<double> d({n_centers, n_features}, dTemp);
-
-                // Calculate descriptor value
-                this->create(d, positions, atomic_numbers, centers_local_pos, cell_list_atoms);
-                auto d_u = d.unchecked<2>();
+                // Calculate descriptor value into the reused output buffer
+                fill(out_data, out_data + n_rows*n_features, 0.0);
+                this->create(d, positions_c, atomic_numbers, centers_used, cell_list_c);
 
                 // Add value to final derivative array
-                double coeff = coefficients[i_stencil];
-                for (int i_local=0; i_local < n_centers; ++i_local) {
-                    int i_center = centers_local_idx[i_local];
+                double coeff = scale*stencil.coefficients[i_stencil];
+                for (int i_row=0; i_row < n_rows; ++i_row) {
+                    int i_center = this->average == "off" ? centers_local_idx[i_row] : 0;
                     for (int i_feature=0; i_feature < n_features; ++i_feature) {
-                        double value = coeff*d_u(i_local, i_feature);
+                        double value = coeff*d_u(i_row, i_feature);
                         derivatives_mu(i_center, i_pos, i_comp, i_feature) = derivatives_mu(i_center, i_pos, i_comp, i_feature) + value;
                     }
                 }
-
-                delete [] dTemp;
             }
 
-            for (int i_local=0; i_local < n_centers; ++i_local) {
-                int i_center = centers_local_idx[i_local];
+            for (int i_row=0; i_row < n_rows; ++i_row) {
+                int i_center = this->average == "off" ? centers_local_idx[i_row] : 0;
                 for (int i_feature=0; i_feature < n_features; ++i_feature) {
-                    derivatives_mu(i_center, i_pos, i_comp, i_feature) = derivatives_mu(i_center, i_pos, i_comp, i_feature) / h;
+                    derivatives_mu(i_center, i_pos, i_comp, i_feature) = derivatives_mu(i_center, i_pos, i_comp, i_feature) / stencil.h;
                 }
             }
 
-            // Return position(s) back to original value for next component.
-            for (size_t i_copy = 0; i_copy < i_atom_indices.size(); ++i_copy) {
-                int j_copy = i_atom_indices[i_copy];
-                positions_mu(j_copy, i_comp) = pos_mu(i_copy, i_comp);
-            }
+            // Return position back to original value for next component.
+            positions_mu(i_atom, i_comp) = pos[i_comp];
+            cell_list_c.setPosition(i_atom, positions_mu(i_atom, 0), positions_mu(i_atom, 1), positions_mu(i_atom, 2));
 
             // If attach = true, return center(s) back to original value for
             // next component.
-            if (attach) {
-                for (size_t i_copy = 0; i_copy < centers_to_move.size(); ++i_copy) {
-                    int j_copy = centers_to_move[i_copy];
-                    centers_local_pos_mu(j_copy, i_comp) = centers_moved_mu(i_copy, i_comp);
-                }
+            for (size_t i_copy = 0; i_copy < centers_to_move.size(); ++i_copy) {
+                centers_used_mu(centers_to_move[i_copy], i_comp) = centers_moved[3*i_copy + i_comp];
             }
         }
     }
+    };
+
+    // The threads need the GIL for creating the array views and it is
+    // released while the descriptor is calculated.
+    if (n_chunks == 1) {
+        process(0, n_indices, 0);
+    } else {
+        GILRelease release;
+        parallel_for(n_indices, n_chunks, [&](int begin, int end, int i_chunk) {
+            py::gil_scoped_acquire acquire;
+            process(begin, end, i_chunk);
+        });
+    }
 }
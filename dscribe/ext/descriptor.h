@@ -18,11 +18,50 @@ limitations under the License.
 
 #include <pybind11/numpy.h>
 #include <string>
+#include <vector>
 #include "celllist.h"
 
 namespace py = pybind11;
 using namespace std;
 
+/**
+ * Non-zero elements of the derivatives in coordinate format. Element q is
+ * located at (centers[q], indices[q], components[q], features[q]) of the
+ * dense [n_centers, n_indices, 3, n_features] array.
+ */
+struct SparseDerivatives {
+    vector<int> centers;
+    vector<int> indices;
+    vector<int> components;
+    vector<int> features;
+    vector<double> data;
+
+    /**
+     * Appends the elements of the other derivatives and releases its
+     * memory.
+     */
+    void append(SparseDerivatives &other);
+};
+
+/**
+ * Returns the coordinates with the shape (4, n) and the values with the shape
+ * (n,) of the given sparse derivatives, which are used to create a
+ * sparse.COO array.
+ */
+py::tuple sparse_derivatives_to_coo(const SparseDerivatives &sparse);
+
+/**
+ * Creates a dense table that maps an atomic number to its index in the given
+ * list of species. Atomic numbers that are not included map to -1.
+ */
+vector<int> get_species_index(py::array_t<int> species);
+
+/**
+ * Writes the species index of every atom using a table created by
+ * get_species_index.
+ */
+void get_atom_species(vector<int> &atom_species, py::array_t<int> atomic_numbers, const vector<int> &species_index);
+
 /**
  * Descriptor base class.
  */
@@ -38,6 +77,31 @@ class Descriptor {
             py::array_t<double> centers
         ) const = 0; 
 
+        /**
+         * For a system with the given cell and periodic boundary conditions.
+         */
+        virtual void create(
+            py::array_t<double> out, 
+            py::array_t<double> positions,
+            py::array_t<int> atomic_numbers,
+            py::array_t<double> cell,
+            py::array_t<bool> pbc,
+            py::array_t<double> centers
+        ) const = 0; 
+
+        /**
+         * Same as above, but the output is in single precision. By default
+         * the output is calculated in double precision and converted.
+         */
+        virtual void create(
+            py::array_t<float, py::array::c_style> out,
+            py::array_t<double> positions,
+            py::array_t<int> atomic_numbers,
+            py::array_t<double> cell,
+            py::array_t<bool> pbc,
+            py::array_t<double> centers
+        ) const;
+
         /**
          * With precalculated CellList.
          */
@@ -46,7 +110,7 @@ class Descriptor {
             py::array_t<double> positions,
             py::array_t<int> atomic_numbers,
             py::array_t<double> centers,
-            CellList cellList
+            const CellList &cellList
         ) const = 0; 
 
         /**
@@ -55,7 +119,35 @@ class Descriptor {
         virtual int get_number_of_features() const = 0; 
 
         /**
-         * Derivatives for local descriptors.
+         * Name of the descriptor class in the profiling statistics.
+         */
+        virtual const char* get_name() const = 0;
+
+        /**
+         * Creates the output for multiple systems with one call. The atoms
+         * and centers of all systems are concatenated and system i owns the
+         * atoms [atom_offsets[i], atom_offsets[i+1]) and the centers
+         * [center_offsets[i], center_offsets[i+1]). The output for system i
+         * is written to the rows of its centers, or to row i when averaging.
+         * The output must be C-contiguous and either float64 or float32. When
+         * there are at least as many systems as native threads, the systems
+         * are divided between the threads.
+         */
+        void create_batch(
+            py::array out,
+            py::array_t<double, py::array::c_style | py::array::forcecast> positions,
+            py::array_t<int, py::array::c_style | py::array::forcecast> atomic_numbers,
+            py::array_t<int> atom_offsets,
+            py::array_t<double, py::array::c_style | py::array::forcecast> cells,
+            py::array_t<bool, py::array::c_style | py::array::forcecast> pbc,
+            py::array_t<double, py::array::c_style | py::array::forcecast> centers,
+            py::array_t<int> center_offsets
+        ) const;
+
+        /**
+         * Derivatives for local descriptors. Calculated with a central finite
+         * difference stencil with an error of O(h^stencil_order), where the
+         * order is either 2 or 4.
          */
         void derivatives_numerical(
             py::array_t<double> out_d,
@@ -68,14 +160,32 @@ class Descriptor {
             py::array_t<int> center_indices,
             py::array_t<int> indices,
             bool attach,
-            bool return_descriptor
+            bool return_descriptor,
+            int stencil_order
         ) const;
 
     protected:
+        friend class Trajectory;
         Descriptor(bool periodic, string average="", double cutoff=0);
         const bool periodic;
         const string average;
         const double cutoff;
+
+    private:
+        /**
+         * Used by create_batch for an output of the type T.
+         */
+        template <typename T>
+        void create_systems(
+            py::array out,
+            py::array_t<double, py::array::c_style | py::array::forcecast> positions,
+            py::array_t<int, py::array::c_style | py::array::forcecast> atomic_numbers,
+            py::array_t<int> atom_offsets,
+            py::array_t<double, py::array::c_style | py::array::forcecast> cells,
+            py::array_t<bool, py::array::c_style | py::array::forcecast> pbc,
+            py::array_t<double, py::array::c_style | py::array::forcecast> centers,
+            py::array_t<int> center_offsets
+        ) const;
 };
 
 #endif
@@ -13,12 +13,16 @@ See the License for the specific language governing permissions and
 limitations under the License.
 */
 
+#include <algorithm>
 #include <set>
 #include <unordered_map>
 #include <cmath>
 #include <iostream>
 #include "descriptorglobal.h"
+#include "finitedifference.h"
 #include "geometry.h"
+#include "threadpool.h"
+#include "profiling.h"
 
 using namespace std;
 
@@ -41,17 +45,30 @@ void DescriptorGlobal::create(
     auto pbc_u = pbc.unchecked<1>();
     bool is_periodic = this->periodic && (pbc_u(0) || pbc_u(1) || pbc_u(2));
     if (is_periodic) {
+        ScopedTimer timer(this->get_name(), "extend_system");
         ExtendedSystem system_extended = extend_system(positions, atomic_numbers, cell, pbc, this->cutoff);
         positions = system_extended.positions;
         atomic_numbers = system_extended.atomic_numbers;
     }
 
     // Calculate neighbours with a cell list
-    CellList cell_list(positions, this->cutoff);
+    CellList cell_list = this->create_cell_list(positions, cell, pbc);
     auto out_mu = out.mutable_unchecked<1>();
     auto positions_u = positions.unchecked<2>();
     auto atomic_numbers_u = atomic_numbers.unchecked<1>();
-    this->create_raw(out_mu, positions_u, atomic_numbers_u, cell_list);
+    auto cell_u = cell.unchecked<2>();
+    GILRelease release;
+    ScopedTimer timer(this->get_name(), "create");
+    this->create_raw(out_mu, positions_u, atomic_numbers_u, cell_u, cell_list);
+}
+
+CellList DescriptorGlobal::create_cell_list(
+    py::array_t<double> positions,
+    py::array_t<double> cell,
+    py::array_t<bool> pbc
+) const
+{
+    return CellList(positions, this->cutoff);
 }
 
 void DescriptorGlobal::derivatives_numerical(
@@ -62,9 +79,12 @@ void DescriptorGlobal::derivatives_numerical(
     py::array_t<double> cell,
     py::array_t<bool> pbc,
     py::array_t<int> indices,
-    bool return_descriptor
+    bool return_descriptor,
+    int stencil_order
 )
 {
+    ScopedTimer timer(this->get_name(), "numerical_derivatives");
+    const Stencil stencil = central_stencil(stencil_order);
     int n_copies = 1;
     int n_atoms = atomic_numbers.size();
     int n_features = this->get_number_of_features();
@@ -76,6 +96,7 @@ void DescriptorGlobal::derivatives_numerical(
     // Extend the system if it is periodic
     bool is_periodic = this->periodic && (pbc_u(0) || pbc_u(1) || pbc_u(2));
     if (is_periodic) {
+        ScopedTimer timer(this->get_name(), "extend_system");
         ExtendedSystem system_extension = extend_system(positions, atomic_numbers, cell, pbc, this->cutoff);
         n_copies = system_extension.atomic_numbers.size()/atomic_numbers.size();
         positions = system_extension.positions;
@@ -84,19 +105,20 @@ void DescriptorGlobal::derivatives_numerical(
     auto positions_mu = positions.mutable_unchecked<2>();
     auto positions_u = positions.unchecked<2>();
     auto atomic_numbers_u = atomic_numbers.unchecked<1>();
+    auto cell_u = cell.unchecked<2>();
 
     // Pre-calculate cell list for atoms
-    CellList cell_list_atoms(positions, this->cutoff);
+    CellList cell_list_atoms = this->create_cell_list(positions, cell, pbc);
 
     // Calculate the desciptor value if requested
     if (return_descriptor) {
-        this->create_raw(descriptor_mu, positions_u, atomic_numbers_u, cell_list_atoms);
+        GILRelease release;
+        this->create_raw(descriptor_mu, positions_u, atomic_numbers_u, cell_u, cell_list_atoms);
     }
 
-    // Central finite difference with error O(h^2)
-    double h = 0.0001;
-    vector<double> coefficients = {-1.0/2.0, 1.0/2.0};
-    vector<double> displacement = {-1.0, 1.0};
+    // The same output buffer is reused for every stencil point
+    py::array_t<double> d({n_features});
+    auto d_mu = d.mutable_unchecked<1>();
 
     // Loop over all atoms
     for (int i_pos=0; i_pos < indices_u.size(); ++i_pos) {
@@ -121,42 +143,39 @@ void DescriptorGlobal::derivatives_numerical(
         }
 
         for (int i_comp=0; i_comp < 3; ++i_comp) {
-            for (int i_stencil=0; i_stencil < 2; ++i_stencil) {
+            for (size_t i_stencil=0; i_stencil < stencil.coefficients.size(); ++i_stencil) {
 
                 // Introduce the displacement(s). Displacement are done for all
                 // periodic copies as well.
                 for (size_t i_copy = 0; i_copy < i_atom_indices.size(); ++i_copy) {
                     int j_copy = i_atom_indices[i_copy];
-                    positions_mu(j_copy, i_comp) = pos_mu(i_copy, i_comp) + h*displacement[i_stencil];
+                    positions_mu(j_copy, i_comp) = pos_mu(i_copy, i_comp) + stencil.h*stencil.displacements[i_stencil];
+                    cell_list_atoms.setPosition(j_copy, positions_mu(j_copy, 0), positions_mu(j_copy, 1), positions_mu(j_copy, 2));
                 }
 
-                // Initialize temporary numpy array for storing the descriptor
-                // for this stencil point
-                double* dTemp = new double[n_features]();
-                py::array_t<double> d({n_features}, dTemp);
-                auto d_mu = d.mutable_unchecked<1>();
-
-                // Calculate descriptor value
-                this->create_raw(d_mu, positions_u, atomic_numbers_u, cell_list_atoms);
-
-                // Add value to final derivative array
-                double coeff = coefficients[i_stencil];
-                for (int i_feature=0; i_feature < n_features; ++i_feature) {
-                    double value = coeff*d_mu(i_feature);
-                    derivatives_mu(i_pos, i_comp, i_feature) = derivatives_mu(i_pos, i_comp, i_feature) + value;
+                // Calculate descriptor value and add it to the final
+                // derivative array
+                {
+                    GILRelease release;
+                    fill(d.mutable_data(), d.mutable_data() + n_features, 0.0);
+                    this->create_raw(d_mu, positions_u, atomic_numbers_u, cell_u, cell_list_atoms);
+                    double coeff = stencil.coefficients[i_stencil];
+                    for (int i_feature=0; i_feature < n_features; ++i_feature) {
+                        double value = coeff*d_mu(i_feature);
+                        derivatives_mu(i_pos, i_comp, i_feature) = derivatives_mu(i_pos, i_comp, i_feature) + value;
+                    }
                 }
-
-                delete [] dTemp;
             }
 
             for (int i_feature=0; i_feature < n_features; ++i_feature) {
-                derivatives_mu(i_pos, i_comp, i_feature) = derivatives_mu(i_pos, i_comp, i_feature) / h;
+                derivatives_mu(i_pos, i_comp, i_feature) = derivatives_mu(i_pos, i_comp, i_feature) / stencil.h;
             }
 
             // Return position(s) back to original value for next component.
             for (size_t i_copy = 0; i_copy < i_atom_indices.size(); ++i_copy) {
                 int j_copy = i_atom_indices[i_copy];
                 positions_mu(j_copy, i_comp) = pos_mu(i_copy, i_comp);
+                cell_list_atoms.setPosition(j_copy, positions_mu(j_copy, 0), positions_mu(j_copy, 1), positions_mu(j_copy, 2));
             }
         }
     }
@@ -53,6 +53,7 @@ class DescriptorGlobal {
             py::detail::unchecked_mutable_reference<double, 1> &out_mu, 
             py::detail::unchecked_reference<double, 2> &positions_u,
             py::detail::unchecked_reference<int, 1> &atomic_numbers_u,
+            py::detail::unchecked_reference<double, 2> &cell_u,
             CellList &cell_list
         ) = 0; 
 
@@ -61,6 +62,11 @@ class DescriptorGlobal {
          */
         virtual int get_number_of_features() const = 0; 
 
+        /**
+         * Name of the descriptor class in the profiling statistics.
+         */
+        virtual const char* get_name() const = 0;
+
         /**
         * Calculates the numerical derivates with central finite difference.
         *
@@ -72,6 +78,7 @@ class DescriptorGlobal {
         * @param pbc Simulation cell periodicity as [3] numpy array.
         * @param indices Indices of the atoms for which derivatives are calculated for.
         * @param return_descriptor Determines whether descriptors are calculated or not.
+        * @param stencil_order Order of the error of the finite difference stencil, 2 or 4.
         */
         void derivatives_numerical(
             py::array_t<double> out_d,
@@ -81,11 +88,24 @@ class DescriptorGlobal {
             py::array_t<double> cell,
             py::array_t<bool> pbc,
             py::array_t<int> indices,
-            bool return_descriptor
+            bool return_descriptor,
+            int stencil_order
         );
 
     protected:
         DescriptorGlobal(bool periodic, string average="", double cutoff=0);
+
+        /**
+         * Creates the cell list that is passed to create_raw. By default the
+         * periodic images are not included, since periodic systems are
+         * extended before calling this.
+         */
+        virtual CellList create_cell_list(
+            py::array_t<double> positions,
+            py::array_t<double> cell,
+            py::array_t<bool> pbc
+        ) const;
+
         const bool periodic;
         const string average;
         const double cutoff;
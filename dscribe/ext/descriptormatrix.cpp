@@ -0,0 +1,147 @@
+/*Copyright 2019 DScribe developers
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include "descriptormatrix.h"
+#include <math.h>
+#include <numeric>
+
+using namespace std;
+using namespace Eigen;
+
+DescriptorMatrix::DescriptorMatrix(
+    unsigned int n_atoms_max,
+    string permutation,
+    double sigma,
+    int seed,
+    bool triangular,
+    double cutoff
+)
+    : DescriptorGlobal(false, "", cutoff)
+    , n_atoms_max(n_atoms_max)
+    , permutation(permutation)
+    , sigma(sigma)
+    , seed(seed)
+    , triangular(triangular)
+    , generator(seed)
+{
+}
+
+void DescriptorMatrix::set_output(
+    const Ref<const MatrixXd> &matrix,
+    py::detail::unchecked_mutable_reference<double, 1> &out_mu
+)
+{
+    MatrixWorkspace workspace;
+    this->set_output(matrix, out_mu.mutable_data(0), workspace, this->generator);
+}
+
+void DescriptorMatrix::set_output(
+    const Ref<const MatrixXd> &matrix,
+    double* out,
+    MatrixWorkspace &workspace,
+    mt19937 &generator
+)
+{
+    // Handle the permutation option
+    if (this->permutation == "eigenspectrum") {
+        this->get_eigenspectrum(matrix, out, workspace);
+        return;
+    }
+    int n_atoms = matrix.rows();
+    vector<int> &order = workspace.order;
+    if (this->permutation == "sorted_l2") {
+        this->sort(matrix, nullptr, workspace);
+    } else if (this->permutation == "random") {
+        this->sort(matrix, &generator, workspace);
+    } else {
+        order.resize(n_atoms);
+        iota(order.begin(), order.end(), 0);
+    }
+
+    // Flatten. Notice that we have to flatten in a way that takes into
+    // account the size of the entire matrix. The rows and columns are read in
+    // the sorted order, so the matrix itself is never reordered. Both rows
+    // and columns are sorted, so the interpretation of the matrix as pairwise
+    // interaction of atoms is still valid.
+    int n_atoms_max = this->n_atoms_max;
+    for (int i = 0; i < n_atoms; ++i) {
+        int i_atom = order[i];
+        if (this->triangular) {
+            double* row = out + i*n_atoms_max - i*(i-1)/2 - i;
+            for (int j = i; j < n_atoms; ++j) {
+                row[j] = matrix(i_atom, order[j]);
+            }
+        } else {
+            double* row = out + i*n_atoms_max;
+            for (int j = 0; j < n_atoms; ++j) {
+                row[j] = matrix(i_atom, order[j]);
+            }
+        }
+    }
+}
+
+void DescriptorMatrix::get_eigenspectrum(
+    const Ref<const MatrixXd> &matrix,
+    double* out,
+    MatrixWorkspace &workspace
+)
+{
+    // Calculate eigenvalues with Eigen. The solver keeps its buffers between
+    // calls as long as the matrix size does not change.
+    workspace.solver.compute(matrix, EigenvaluesOnly);
+    const VectorXd &eigenvalues = workspace.solver.eigenvalues();
+    int n_atoms = matrix.cols();
+    copy(eigenvalues.data(), eigenvalues.data() + n_atoms, out);
+
+    // Sort the values in descending order by absolute value
+    std::sort(
+        out,
+        out + n_atoms,
+        [ ]( const double& lhs, const double& rhs ) {
+            return abs(lhs) > abs(rhs);
+        }
+    );
+}
+
+void DescriptorMatrix::sort(const Ref<const MatrixXd> &matrix, mt19937* generator, MatrixWorkspace &workspace)
+{
+    // Calculate row norms
+    VectorXd &norms = workspace.norms;
+    norms = matrix.rowwise().norm();
+    int n_atoms = matrix.rows();
+
+    // Introduce noise with norm as mean and sigma as standard deviation.
+    if (generator != nullptr) {
+        for (int i = 0; i < norms.size(); ++i) {
+            normal_distribution<double> distribution(norms(i), this->sigma);
+            norms(i) = distribution(*generator);
+        }
+    }
+
+    // Sort the pairs by norm.
+    vector<int> &order = workspace.order;
+    order.resize(n_atoms);
+    iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&norms](int a, int b) { return norms(a) > norms(b); } );
+}
+
+int DescriptorMatrix::get_number_of_features() const
+{
+    if (this->permutation == "eigenspectrum") {
+        return this->n_atoms_max;
+    }
+    return this->triangular
+        ? this->n_atoms_max * (this->n_atoms_max + 1) / 2
+        : this->n_atoms_max * this->n_atoms_max;
+}
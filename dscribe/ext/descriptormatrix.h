@@ -0,0 +1,113 @@
+/*Copyright 2019 DScribe developers
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef DESCRIPTORMATRIX_H
+#define DESCRIPTORMATRIX_H
+
+#include <string>
+#include <vector>
+#include <random>
+#include <pybind11/numpy.h>
+#include <Eigen/Dense>
+#include "descriptorglobal.h"
+
+namespace py = pybind11;
+using namespace std;
+using namespace Eigen;
+#define PI 3.1415926535897932384626433832795028841971693993751058209749445923078164062
+
+/**
+ * Buffers that are reused when the output is created for several matrices
+ * in a row. Each thread needs its own workspace.
+ */
+struct MatrixWorkspace {
+    SelfAdjointEigenSolver<MatrixXd> solver;
+    VectorXd norms;
+    vector<int> order;
+};
+
+class DescriptorMatrix: public DescriptorGlobal {
+    public:
+        /**
+         * Get the number of features.
+         */
+        int get_number_of_features() const;
+
+        /**
+         * Calculate sorted eigenvalues.
+         */
+        void get_eigenspectrum(
+            const Ref<const MatrixXd> &matrix,
+            double* out,
+            MatrixWorkspace &workspace
+        );
+
+        /**
+         * Stores the order of the rows sorted by their L2 norm to
+         * workspace.order. If a generator is given, noise drawn from it is
+         * added to the norms.
+         */
+        void sort(const Ref<const MatrixXd> &matrix, mt19937* generator, MatrixWorkspace &workspace);
+
+        /**
+         * Applies the permutation option to the given matrix and writes the
+         * result to the zero padded output.
+         */
+        void set_output(
+            const Ref<const MatrixXd> &matrix,
+            py::detail::unchecked_mutable_reference<double, 1> &out_mu
+        );
+
+        /**
+         * Same as above, but writes to the given buffer, reuses the given
+         * workspace and draws the noise of the random permutation from the
+         * given generator.
+         */
+        void set_output(
+            const Ref<const MatrixXd> &matrix,
+            double* out,
+            MatrixWorkspace &workspace,
+            mt19937 &generator
+        );
+
+        unsigned int n_atoms_max;
+        string permutation;
+        double sigma;
+        int seed;
+        bool triangular;
+
+    protected:
+        /**
+         * Constructor, see the python docs for more details about variables.
+         *
+         * @param triangular Whether only the upper triangular part of the
+         * symmetric matrix is written to the output.
+         */
+        DescriptorMatrix(
+            unsigned int n_atoms_max,
+            string permutation,
+            double sigma,
+            int seed,
+            bool triangular,
+            double cutoff=0
+        );
+
+        /**
+         * Generator of the noise for the random permutation. It is advanced
+         * by every call, so repeated calls give different permutations.
+         */
+        mt19937 generator;
+};
+#endif
@@ -0,0 +1,156 @@
+/*Copyright 2019 DScribe developers
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include "ewaldsummatrix.h"
+#include "threadpool.h"
+#include <math.h>
+#include <algorithm>
+
+using namespace std;
+using namespace Eigen;
+
+EwaldSumMatrix::EwaldSumMatrix(
+    unsigned int n_atoms_max,
+    string permutation,
+    double sigma,
+    int seed,
+    double a,
+    double r_cut,
+    double g_cut
+)
+    : DescriptorMatrix(n_atoms_max, permutation, sigma, seed, false, r_cut)
+    , a(a)
+    , r_cut(r_cut)
+    , g_cut(g_cut)
+{
+}
+
+CellList EwaldSumMatrix::create_cell_list(
+    py::array_t<double> positions,
+    py::array_t<double> cell,
+    py::array_t<bool>
+) const
+{
+    py::array_t<bool> pbc_all({3});
+    fill(pbc_all.mutable_data(), pbc_all.mutable_data() + 3, true);
+    return CellList(positions, this->r_cut, cell, pbc_all);
+}
+
+void EwaldSumMatrix::create_raw(
+    py::detail::unchecked_mutable_reference<double, 1> &out_mu, 
+    py::detail::unchecked_reference<double, 2> &positions_u, 
+    py::detail::unchecked_reference<int, 1> &atomic_numbers_u,
+    py::detail::unchecked_reference<double, 2> &cell_u,
+    CellList &cell_list
+)
+{
+    const int n_atoms = atomic_numbers_u.shape(0);
+    Matrix3d cell;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            cell(i, j) = cell_u(i, j);
+        }
+    }
+    const double volume = abs(cell.determinant());
+    MatrixXd positions(n_atoms, 3);
+    VectorXd q(n_atoms);
+    for (int i = 0; i < n_atoms; ++i) {
+        positions.row(i) << positions_u(i, 0), positions_u(i, 1), positions_u(i, 2);
+        q(i) = atomic_numbers_u(i);
+    }
+
+    // Real space sum, equation (5) in
+    // https://doi.org/10.1016/0010-4655(96)00016-1. The neighbours within
+    // the real space cutoff include the periodic images. A charge does not
+    // interact with itself, but does interact with its own copies. Each atom
+    // only writes to its own column.
+    MatrixXd matrix = MatrixXd::Zero(n_atoms, n_atoms);
+    parallel_for(n_atoms, [&](int begin, int end, int) {
+        CellListNeighbours neighbours;
+        for (int i = begin; i < end; ++i) {
+            cell_list.getNeighboursForPosition(positions_u(i, 0), positions_u(i, 1), positions_u(i, 2), neighbours);
+            for (size_t k = 0; k < neighbours.indices.size(); ++k) {
+                const double r = sqrt(neighbours.distancesSquared[k]);
+                if (r <= 1e-8) {
+                    continue;
+                }
+                matrix(neighbours.indices[k], i) += erfc(this->a*r)/r;
+            }
+        }
+    });
+
+    // Reciprocal space sum, equation (16) in
+    // https://doi.org/10.1016/0010-4655(96)00016-1. The term G=0 is
+    // neglected, which corresponds to adding a neutralizing background
+    // charge. Only one of G and -G is enumerated, and because the sine terms
+    // of the pair cancel, the sum is over exp(-G^2/(4a^2))/G^2*cos(G*(rj-ri)).
+    // The cosine is split into products of terms that only depend on one
+    // atom, so that the sum becomes a matrix product. The wave vectors are
+    // processed in blocks to limit the memory usage.
+    const Matrix3d reciprocal = 2*PI*cell.inverse().transpose();
+    int n_max[3];
+    for (int k = 0; k < 3; ++k) {
+        n_max[k] = (int)floor(this->g_cut*cell.row(k).norm()/(2*PI));
+    }
+    const double g_cut_squared = this->g_cut*this->g_cut;
+    const double a_squared = this->a*this->a;
+    const int block_size = 256;
+    MatrixXd g_vectors(block_size, 3);
+    VectorXd weights(block_size);
+    MatrixXd recip = MatrixXd::Zero(n_atoms, n_atoms);
+    int n_block = 0;
+    auto add_block = [&]() {
+        const MatrixXd phases = g_vectors.topRows(n_block)*positions.transpose();
+        const ArrayXd w = weights.head(n_block).array().sqrt();
+        const MatrixXd c = phases.array().cos().colwise()*w;
+        const MatrixXd s = phases.array().sin().colwise()*w;
+        recip.noalias() += c.transpose()*c;
+        recip.noalias() += s.transpose()*s;
+        n_block = 0;
+    };
+    for (int n1 = 0; n1 <= n_max[0]; ++n1) {
+        for (int n2 = (n1 == 0 ? 0 : -n_max[1]); n2 <= n_max[1]; ++n2) {
+            for (int n3 = (n1 == 0 && n2 == 0 ? 1 : -n_max[2]); n3 <= n_max[2]; ++n3) {
+                const RowVector3d g = n1*reciprocal.row(0) + n2*reciprocal.row(1) + n3*reciprocal.row(2);
+                const double g_squared = g.squaredNorm();
+                if (g_squared > g_cut_squared) {
+                    continue;
+                }
+                g_vectors.row(n_block) = g;
+                weights(n_block) = 2*exp(-g_squared/(4*a_squared))/g_squared;
+                if (++n_block == block_size) {
+                    add_block();
+                }
+            }
+        }
+    }
+    if (n_block > 0) {
+        add_block();
+    }
+    matrix += 4*PI/volume*recip;
+
+    // Interaction with the neutralizing background charge. All the pair
+    // terms are multiplied by the charges, and the diagonal terms are divided
+    // by two so that the total energy is the sum of the upper triangular part
+    // including the diagonal.
+    matrix.array() -= PI/(volume*a_squared);
+    matrix = matrix.cwiseProduct(q*q.transpose());
+    matrix.diagonal() /= 2;
+
+    // Correction for the self-interaction with the Gaussian charge
+    // distribution, which is only applied to the diagonal.
+    matrix.diagonal() -= this->a/sqrt(PI)*q.cwiseProduct(q);
+
+    this->set_output(matrix, out_mu);
+}
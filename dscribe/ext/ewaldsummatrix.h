@@ -0,0 +1,77 @@
+/*Copyright 2019 DScribe developers
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef EWALDSUMMATRIX_H
+#define EWALDSUMMATRIX_H
+
+#include <pybind11/numpy.h>
+#include "descriptormatrix.h"
+
+namespace py = pybind11;
+using namespace std;
+
+/**
+ * Ewald sum matrix descriptor. The system is always treated as periodic in
+ * all directions, and the cell must be invertible, which is checked in
+ * python.
+ */
+class EwaldSumMatrix: public DescriptorMatrix {
+    public:
+        /**
+         * Constructor, see the python docs for more details about variables.
+         *
+         * @param a The screening parameter.
+         * @param r_cut Real space cutoff radius.
+         * @param g_cut Reciprocal space cutoff radius.
+         */
+        EwaldSumMatrix(
+            unsigned int n_atoms_max,
+            string permutation,
+            double sigma,
+            int seed,
+            double a,
+            double r_cut,
+            double g_cut
+        );
+
+        /**
+         * For creating feature vectors.
+         */
+        void create_raw(
+            py::detail::unchecked_mutable_reference<double, 1> &out_mu, 
+            py::detail::unchecked_reference<double, 2> &positions_u, 
+            py::detail::unchecked_reference<int, 1> &atomic_numbers_u,
+            py::detail::unchecked_reference<double, 2> &cell_u,
+            CellList &cell_list
+        );
+
+        const char* get_name() const {return "EwaldSumMatrix";};
+
+        double a;
+        double r_cut;
+        double g_cut;
+
+    protected:
+        /**
+         * The real space sum goes over the periodic images within r_cut in
+         * every direction, regardless of the periodic boundary conditions.
+         */
+        CellList create_cell_list(
+            py::array_t<double> positions,
+            py::array_t<double> cell,
+            py::array_t<bool> pbc
+        ) const;
+};
+#endif
@@ -18,10 +18,17 @@ limitations under the License.
 #include <pybind11/stl.h>    // Enables automatic type conversion from C++ containers to python
 #include "celllist.h"
 #include "cm.h"
+#include "sinematrix.h"
+#include "ewaldsummatrix.h"
 #include "soap.h"
 #include "acsf.h"
 #include "mbtr.h"
+#include "kernels.h"
+#include "trajectory.h"
 #include "geometry.h"
+#include "threadpool.h"
+#include "profiling.h"
+#include "finitedifference.h"
 
 namespace py = pybind11;
 using namespace std;
@@ -34,17 +41,41 @@ using overload_cast_ = pybind11::detail::overload_cast_impl<Args...>;
 PYBIND11_MODULE(ext, m) {
     // CoulombMatrix
     py::class_<CoulombMatrix>(m, "CoulombMatrix")
-        .def(py::init<unsigned int, string, double, int>())
+        .def(py::init<unsigned int, string, double, int, bool>())
         .def("create", &CoulombMatrix::create)
+        .def("create_batch", &CoulombMatrix::create_batch)
         .def("derivatives_numerical", &CoulombMatrix::derivatives_numerical)
         .def(py::pickle(
             [](const CoulombMatrix &p) {
+                return py::make_tuple(p.n_atoms_max, p.permutation, p.sigma, p.seed, p.triangular);
+            },
+            [](py::tuple t) {
+                if (t.size() != 5)
+                    throw std::runtime_error("Invalid state!");
+                CoulombMatrix p(
+                    t[0].cast<unsigned int>(),
+                    t[1].cast<string>(),
+                    t[2].cast<double>(),
+                    t[3].cast<int>(),
+                    t[4].cast<bool>()
+                );
+                return p;
+            }
+        ));
+
+    // SineMatrix
+    py::class_<SineMatrix>(m, "SineMatrix")
+        .def(py::init<unsigned int, string, double, int>())
+        .def("create", &SineMatrix::create)
+        .def("derivatives_numerical", &SineMatrix::derivatives_numerical)
+        .def(py::pickle(
+            [](const SineMatrix &p) {
                 return py::make_tuple(p.n_atoms_max, p.permutation, p.sigma, p.seed);
             },
             [](py::tuple t) {
                 if (t.size() != 4)
                     throw std::runtime_error("Invalid state!");
-                CoulombMatrix p(
+                SineMatrix p(
                     t[0].cast<unsigned int>(),
                     t[1].cast<string>(),
                     t[2].cast<double>(),
@@ -54,26 +85,72 @@ PYBIND11_MODULE(ext, m) {
             }
         ));
 
+    // EwaldSumMatrix
+    py::class_<EwaldSumMatrix>(m, "EwaldSumMatrix")
+        .def(py::init<unsigned int, string, double, int, double, double, double>())
+        .def("create", &EwaldSumMatrix::create)
+        .def("derivatives_numerical", &EwaldSumMatrix::derivatives_numerical)
+        .def(py::pickle(
+            [](const EwaldSumMatrix &p) {
+                return py::make_tuple(p.n_atoms_max, p.permutation, p.sigma, p.seed, p.a, p.r_cut, p.g_cut);
+            },
+            [](py::tuple t) {
+                if (t.size() != 7)
+                    throw std::runtime_error("Invalid state!");
+                EwaldSumMatrix p(
+                    t[0].cast<unsigned int>(),
+                    t[1].cast<string>(),
+                    t[2].cast<double>(),
+                    t[3].cast<int>(),
+                    t[4].cast<double>(),
+                    t[5].cast<double>(),
+                    t[6].cast<double>()
+                );
+                return p;
+            }
+        ));
+
     // SOAP
     py::class_<SOAPGTO>(m, "SOAPGTO")
         .def(py::init<double, int, int, double, py::dict, bool, string, double, py::array_t<double>, py::array_t<double>, py::array_t<int>, bool>())
         .def("create", overload_cast_<py::array_t<double>, py::array_t<double>, py::array_t<int>, py::array_t<double> >()(&SOAPGTO::create, py::const_))
+        // The single precision output is registered first: it only accepts
+        // float32 arrays, so double precision output is never converted.
+        .def("create", overload_cast_<py::array_t<float, py::array::c_style>, py::array_t<double>, py::array_t<int>, py::array_t<double>, py::array_t<bool>, py::array_t<double> >()(&SOAPGTO::create, py::const_))
         .def("create", overload_cast_<py::array_t<double>, py::array_t<double>, py::array_t<int>, py::array_t<double>, py::array_t<bool>, py::array_t<double> >()(&SOAPGTO::create, py::const_))
-        .def("create", overload_cast_<py::array_t<double>, py::array_t<double>, py::array_t<int>, py::array_t<double>, CellList>()(&SOAPGTO::create, py::const_))
+        .def("create", overload_cast_<py::array_t<double>, py::array_t<double>, py::array_t<int>, py::array_t<double>, const CellList&>()(&SOAPGTO::create, py::const_))
+        .def("create_batch", &SOAPGTO::create_batch)
         .def("derivatives_numerical", &SOAPGTO::derivatives_numerical)
-        .def("derivatives_analytical", &SOAPGTO::derivatives_analytical);
+        .def("derivatives_analytical", &SOAPGTO::derivatives_analytical)
+        .def("derivatives_analytical_sparse", &SOAPGTO::derivatives_analytical_sparse);
     py::class_<SOAPPolynomial>(m, "SOAPPolynomial")
         .def(py::init<double, int, int, double, py::dict, bool, string, double, py::array_t<double>, py::array_t<double>, py::array_t<int>, bool >())
         .def("create", overload_cast_<py::array_t<double>, py::array_t<double>, py::array_t<int>, py::array_t<double> >()(&SOAPPolynomial::create, py::const_))
         .def("create", overload_cast_<py::array_t<double>, py::array_t<double>, py::array_t<int>, py::array_t<double>, py::array_t<bool>, py::array_t<double> >()(&SOAPPolynomial::create, py::const_))
-        .def("create", overload_cast_<py::array_t<double>, py::array_t<double>, py::array_t<int>, py::array_t<double>, CellList>()(&SOAPPolynomial::create, py::const_))
-        .def("derivatives_numerical", &SOAPPolynomial::derivatives_numerical);
+        .def("create", overload_cast_<py::array_t<double>, py::array_t<double>, py::array_t<int>, py::array_t<double>, const CellList&>()(&SOAPPolynomial::create, py::const_))
+        .def("create_batch", &SOAPPolynomial::create_batch)
+        .def("derivatives_numerical", &SOAPPolynomial::derivatives_numerical)
+        .def("derivatives_analytical", &SOAPPolynomial::derivatives_analytical);
+
+    // Trajectory
+    py::class_<Trajectory>(m, "Trajectory")
+        .def(py::init<const SOAPGTO&, double, double>(), py::keep_alive<1, 2>())
+        .def(py::init<const SOAPPolynomial&, double, double>(), py::keep_alive<1, 2>())
+        .def("create", &Trajectory::create)
+        .def("reset", &Trajectory::reset)
+        .def_readonly("skin", &Trajectory::skin)
+        .def_readonly("tolerance", &Trajectory::tolerance)
+        .def_readonly("n_frames", &Trajectory::n_frames)
+        .def_readonly("n_rebuilds", &Trajectory::n_rebuilds)
+        .def_readonly("n_computed_centers", &Trajectory::n_computed_centers);
 
     // ACSF
     py::class_<ACSF>(m, "ACSFWrapper")
         .def(py::init<double , vector<vector<double> > , vector<double> , vector<vector<double> > , vector<vector<double> > , vector<int> >())
         .def(py::init<>())
         .def("create", &ACSF::create)
+        .def("derivatives_analytical", &ACSF::derivatives_analytical)
+        .def("derivatives_analytical_sparse", &ACSF::derivatives_analytical_sparse)
         .def("set_g2_params", &ACSF::setG2Params)
         .def("get_g2_params", &ACSF::getG2Params)
         .def_readwrite("n_types", &ACSF::nTypes)
@@ -109,24 +186,54 @@ PYBIND11_MODULE(ext, m) {
  
     // MBTR
     py::class_<MBTR>(m, "MBTRWrapper")
-        .def(py::init< map<int,int>, int , vector<vector<int>>  >())
-        .def("get_k1", &MBTR::getK1)
+        .def(py::init< map<int,int>, int >())
+        .def("get_k1", &MBTR::getK1, py::call_guard<py::gil_scoped_release>())
         .def("get_k2", &MBTR::getK2)
         .def("get_k3", &MBTR::getK3)
         .def("get_k2_local", &MBTR::getK2Local)
         .def("get_k3_local", &MBTR::getK3Local);
 
+    // Kernels
+    py::class_<AverageKernel>(m, "AverageKernel")
+        .def(py::init<string, double, double, double>())
+        .def("create", &AverageKernel::create)
+        .def("get_self_similarity", &AverageKernel::get_self_similarity);
+    py::class_<REMatchKernel>(m, "REMatchKernel")
+        .def(py::init<string, double, double, double, double, double>())
+        .def("create", &REMatchKernel::create)
+        .def("get_self_similarity", &REMatchKernel::get_self_similarity);
+
     // CellList
     py::class_<CellList>(m, "CellList")
         .def(py::init<py::array_t<double>, double>())
+        .def(py::init<py::array_t<double>, double, py::array_t<double>, py::array_t<bool>>())
+        .def(py::init<py::array_t<double>, double, double>())
+        .def(py::init<py::array_t<double>, double, double, py::array_t<double>, py::array_t<bool>>())
         .def("get_neighbours_for_index", &CellList::getNeighboursForIndex)
-        .def("get_neighbours_for_position", &CellList::getNeighboursForPosition);
+        .def("get_neighbours_for_position", overload_cast_<const double, const double, const double>()(&CellList::getNeighboursForPosition, py::const_));
     py::class_<CellListResult>(m, "CellListResult")
         .def(py::init<>())
         .def_readonly("indices", &CellListResult::indices)
         .def_readonly("distances", &CellListResult::distances)
         .def_readonly("distances_squared", &CellListResult::distancesSquared);
 
+    // Threading
+    m.def("get_num_threads", &get_num_threads, "Get the number of threads used by the C++ extension.");
+    m.def("set_num_threads", &set_num_threads, "Set the number of threads used by the C++ extension. Values below one select the number of hardware threads.");
+
+    // Profiling
+    m.def("set_profiling", &Profiler::set_enabled, "Enable or disable collecting the profiling statistics of the C++ extension.");
+    m.def("get_profiling", &Profiler::enabled, "Get whether the profiling statistics of the C++ extension are collected.");
+    m.def("get_profiling_stats", &Profiler::get_stats, "Get the time per phase and the counters collected for each descriptor class.");
+    m.def("reset_profiling_stats", &Profiler::reset, "Clear the collected profiling statistics.");
+
+    // Finite differences
+    m.def("central_stencil", &central_stencil, "Get the central finite difference stencil for the first derivative with an error of the given order.");
+    py::class_<Stencil>(m, "Stencil")
+        .def_readonly("h", &Stencil::h)
+        .def_readonly("displacements", &Stencil::displacements)
+        .def_readonly("coefficients", &Stencil::coefficients);
+
     // Geometry
     m.def("extend_system", &extend_system, "Create a periodically extended system.");
     py::class_<ExtendedSystem>(m, "ExtendedSystem")
@@ -0,0 +1,53 @@
+/*Copyright 2019 DScribe developers
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef FINITEDIFFERENCE_H
+#define FINITEDIFFERENCE_H
+
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Central finite difference stencil for the first derivative. The derivative
+ * is sum_i coefficients[i]*f(x + h*displacements[i]) / h.
+ */
+struct Stencil {
+    double h;
+    vector<double> displacements;
+    vector<double> coefficients;
+};
+
+/**
+ * Returns the central finite difference stencil with an error of O(h^order).
+ * The step sizes balance the truncation and rounding errors. The fourth order
+ * stencil needs twice as many evaluations, but reaches a much smaller error
+ * than the second order stencil can reach with any step size.
+ *
+ * @param order Order of the error term, either 2 or 4.
+ */
+inline Stencil central_stencil(int order)
+{
+    if (order == 2) {
+        return Stencil{0.0001, {-1.0, 1.0}, {-1.0/2.0, 1.0/2.0}};
+    }
+    if (order == 4) {
+        return Stencil{0.001, {-2.0, -1.0, 1.0, 2.0}, {1.0/12.0, -2.0/3.0, 2.0/3.0, -1.0/12.0}};
+    }
+    throw invalid_argument("The finite difference stencil order must be either 2 or 4.");
+}
+
+#endif
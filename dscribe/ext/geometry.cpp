@@ -34,9 +34,7 @@ inline double norm(const vector<double>& a) {
     return sqrt(accum);
 };
 
-ExtendedSystem extend_system(
-    py::array_t<double> positions,
-    py::array_t<int> atomic_numbers,
+vector<double> get_image_shifts(
     py::array_t<double> cell,
     py::array_t<bool> pbc,
     double cutoff)
@@ -49,8 +47,6 @@ ExtendedSystem extend_system(
     // Notice that we need to use vectors that are perpendicular to the cell
     // vectors to ensure that the correct atoms are included for non-cubic
     // cells.
-    auto positions_u = positions.unchecked<2>();
-    auto atomic_numbers_u = atomic_numbers.unchecked<1>();
     auto cell_u = cell.unchecked<2>();
     auto pbc_u = pbc.unchecked<1>();
     vector<double> a = {cell_u(0, 0), cell_u(0, 1), cell_u(0, 2)};
@@ -72,14 +68,12 @@ ExtendedSystem extend_system(
 
     // Figure out how many copies to take per basis vector. Determined by how
     // many perpendicular projections fit into the cutoff distance.
-    vector<int> n_copies_axis(3);
     vector<vector<int>> multipliers;
     for (int i=0; i < 3; ++i) {
         if (pbc_u(i)) {
             double length = norm(vectors[i]);
             double factor = cutoff/length;
             int multiplier = (int)ceil(factor);
-            n_copies_axis[i] = multiplier;
 
             // Store multipliers explicitly into a list in an order that keeps the
             // original system in the same place both in space and in index.
@@ -92,13 +86,37 @@ ExtendedSystem extend_system(
             }
             multipliers.push_back(multiples);
         } else {
-            n_copies_axis[i] = 0;
             multipliers.push_back(vector<int>{0});
         }
     }
 
+    // Calculate the translation for each periodic copy.
+    vector<double> shifts;
+    for (int a_multiplier : multipliers[0]) {
+        for (int b_multiplier : multipliers[1]) {
+            for (int c_multiplier : multipliers[2]) {
+                for (int m=0; m < 3; ++m) {
+                    shifts.push_back(a_multiplier*a[m] + b_multiplier*b[m] + c_multiplier*c[m]);
+                };
+            }
+        }
+    }
+    return shifts;
+}
+
+ExtendedSystem extend_system(
+    py::array_t<double> positions,
+    py::array_t<int> atomic_numbers,
+    py::array_t<double> cell,
+    py::array_t<bool> pbc,
+    double cutoff)
+{
+    auto positions_u = positions.unchecked<2>();
+    auto atomic_numbers_u = atomic_numbers.unchecked<1>();
+    vector<double> shifts = get_image_shifts(cell, pbc, cutoff);
+
     // Calculate the extended system positions.
-    int n_rep = (2*n_copies_axis[0]+1)*(2*n_copies_axis[1]+1)*(2*n_copies_axis[2]+1);
+    int n_rep = shifts.size()/3;
     int n_atoms = atomic_numbers.size();
     py::array_t<double> ext_pos({n_atoms*n_rep, 3});
     py::array_t<int> ext_atomic_numbers({n_atoms*n_rep});
@@ -106,33 +124,16 @@ ExtendedSystem extend_system(
     auto ext_pos_mu = ext_pos.mutable_unchecked<2>();
     auto ext_atomic_numbers_mu = ext_atomic_numbers.mutable_unchecked<1>();
     auto ext_indices_mu = ext_indices.mutable_unchecked<1>();
-    int i_copy = 0;
-    int a_limit = multipliers[0].size();
-    int b_limit = multipliers[1].size();
-    int c_limit = multipliers[2].size();
-    for (int i=0; i < a_limit; ++i) {
-        int a_multiplier = multipliers[0][i];
-        for (int j=0; j < b_limit; ++j) {
-            int b_multiplier = multipliers[1][j];
-            for (int k=0; k < c_limit; ++k) {
-                int c_multiplier = multipliers[2][k];
-
-                // Precalculate the added vector. It will be used many times.
-                vector<double> addition(3, 0);
-                for (int m=0; m < 3; ++m) {
-                    addition[m] += a_multiplier*a[m] + b_multiplier*b[m] + c_multiplier*c[m];
-                };
-
-                // Store the positions, atomic numbers and indices
-                for (int l=0; l < n_atoms; ++l) {
-                    int index = i_copy*n_atoms + l;
-                    ext_atomic_numbers_mu(index) = atomic_numbers_u(l);
-                    ext_indices_mu(index) = l;
-                    for (int m=0; m < 3; ++m) {
-                        ext_pos_mu(index, m) = positions_u(l, m) + addition[m];
-                    }
-                }
-                ++i_copy;
+    for (int i_copy=0; i_copy < n_rep; ++i_copy) {
+        const double* addition = &shifts[3*i_copy];
+
+        // Store the positions, atomic numbers and indices
+        for (int l=0; l < n_atoms; ++l) {
+            int index = i_copy*n_atoms + l;
+            ext_atomic_numbers_mu(index) = atomic_numbers_u(l);
+            ext_indices_mu(index) = l;
+            for (int m=0; m < 3; ++m) {
+                ext_pos_mu(index, m) = positions_u(l, m) + addition[m];
             }
         }
     }
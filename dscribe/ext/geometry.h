@@ -35,6 +35,22 @@ inline vector<double> cross(const vector<double>& a, const vector<double>& b);
 inline double dot(const vector<double>& a, const vector<double>& b);
 inline double norm(const vector<double>& a);
 
+/**
+ * Used to determine the translations to all periodic copies of a system that
+ * are needed to find every neighbour within the cutoff. The translation of
+ * the original system, i.e. zero, comes first.
+ *
+ * @param cell Unit cell of the original system.
+ * @param pbc Periodic boundary conditions (array of three booleans) of the original system.
+ * @param cutoff Radial cutoff value for determining extension size.
+ *
+ * @return Cartesian translations as a flattened list of vectors.
+ */
+vector<double> get_image_shifts(
+    py::array_t<double> cell,
+    py::array_t<bool> pbc,
+    double cutoff);
+
 /**
  * Used to periodically extend an atomic system in order to take into account
  * periodic copies beyond the given unit cell.
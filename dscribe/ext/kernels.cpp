@@ -0,0 +1,266 @@
+/*Copyright 2019 DScribe developers
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include "kernels.h"
+#include "threadpool.h"
+#include <math.h>
+#include <vector>
+#include <stdexcept>
+
+using namespace std;
+using namespace Eigen;
+
+namespace {
+
+/**
+ * Structures are added to the same block until it has this many local
+ * environments. Larger structures form a block of their own.
+ */
+const int BLOCK_SIZE = 256;
+
+/**
+ * Groups the consecutive structures into blocks. Block i contains the
+ * structures [blocks[i], blocks[i+1]).
+ */
+vector<int> get_blocks(py::detail::unchecked_reference<int, 1> &offsets)
+{
+    int n_structures = offsets.shape(0) - 1;
+    vector<int> blocks(1, 0);
+    for (int i = 0; i < n_structures; ++i) {
+        int start = offsets(blocks.back());
+        if (i > blocks.back() && offsets(i+1) - start > BLOCK_SIZE) {
+            blocks.push_back(i);
+        }
+    }
+    if (n_structures > 0) {
+        blocks.push_back(n_structures);
+    }
+    return blocks;
+}
+
+void check_features(
+    py::array_t<double, py::array::c_style | py::array::forcecast> &features,
+    py::array_t<int> &offsets
+)
+{
+    if (features.ndim() != 2) {
+        throw invalid_argument("The features must be a 2D array with one row per local environment.");
+    }
+    auto offsets_u = offsets.unchecked<1>();
+    int n_structures = offsets.size() - 1;
+    if (n_structures < 0 || offsets_u(n_structures) != features.shape(0)) {
+        throw invalid_argument("The offsets do not match the size of the given features.");
+    }
+}
+
+}
+
+LocalSimilarityKernel::LocalSimilarityKernel(string metric, double gamma, double degree, double coef0)
+    : metric(metric)
+    , gamma(gamma)
+    , degree(degree)
+    , coef0(coef0)
+{
+    if (metric != "linear" && metric != "polynomial" && metric != "rbf" && metric != "laplacian") {
+        throw invalid_argument("Unsupported metric: " + metric);
+    }
+}
+
+void LocalSimilarityKernel::get_pairwise_matrix(
+    const Ref<const RowMatrixXd> &X,
+    const Ref<const RowMatrixXd> &Y,
+    MatrixXd &out
+) const
+{
+    // The laplacian kernel is based on the L1 distance, which cannot be
+    // expressed with dot products.
+    if (this->metric == "laplacian") {
+        out.resize(X.rows(), Y.rows());
+        for (int j = 0; j < Y.rows(); ++j) {
+            for (int i = 0; i < X.rows(); ++i) {
+                out(i, j) = exp(-this->gamma*(X.row(i) - Y.row(j)).cwiseAbs().sum());
+            }
+        }
+        return;
+    }
+    out.noalias() = X*Y.transpose();
+    if (this->metric == "polynomial") {
+        out = (this->gamma*out.array() + this->coef0).pow(this->degree);
+    } else if (this->metric == "rbf") {
+        // Negative squared distances caused by rounding are clipped to zero.
+        VectorXd x_norms = X.rowwise().squaredNorm();
+        RowVectorXd y_norms = Y.rowwise().squaredNorm().transpose();
+        out = ((-2*out).colwise() + x_norms).rowwise() + y_norms;
+        out = (-this->gamma*out.array().max(0)).exp();
+    }
+}
+
+void LocalSimilarityKernel::create(
+    py::array_t<double> out,
+    py::array_t<double, py::array::c_style | py::array::forcecast> x,
+    py::array_t<int> x_offsets,
+    py::array_t<double, py::array::c_style | py::array::forcecast> y,
+    py::array_t<int> y_offsets,
+    bool symmetric
+) const
+{
+    check_features(x, x_offsets);
+    check_features(y, y_offsets);
+    int n_x = x_offsets.size() - 1;
+    int n_y = y_offsets.size() - 1;
+    if (x.shape(1) != y.shape(1)) {
+        throw invalid_argument("The features of x and y must have the same size.");
+    }
+    if (symmetric && n_x != n_y) {
+        throw invalid_argument("A symmetric kernel needs the same structures in x and y.");
+    }
+    if (out.ndim() != 2 || out.shape(0) != n_x || out.shape(1) != n_y || out.strides(1) != sizeof(double) || out.strides(0) != n_y*(ssize_t)sizeof(double)) {
+        throw invalid_argument("The output must be a C-contiguous array with shape (n_x, n_y).");
+    }
+    auto x_offsets_u = x_offsets.unchecked<1>();
+    auto y_offsets_u = y_offsets.unchecked<1>();
+    vector<int> x_blocks = get_blocks(x_offsets_u);
+    vector<int> y_blocks = get_blocks(y_offsets_u);
+    int n_x_blocks = x_blocks.size() - 1;
+    int n_y_blocks = y_blocks.size() - 1;
+    int n_features = x.shape(1);
+    Map<const RowMatrixXd> x_features(x.data(), x.shape(0), n_features);
+    Map<const RowMatrixXd> y_features(y.data(), y.shape(0), n_features);
+    double* out_data = out.mutable_data();
+
+    // The pairs of blocks that are calculated. For symmetric kernels only the
+    // blocks on or above the diagonal are needed.
+    vector<pair<int, int>> tiles;
+    for (int i = 0; i < n_x_blocks; ++i) {
+        for (int j = symmetric ? i : 0; j < n_y_blocks; ++j) {
+            tiles.push_back(make_pair(i, j));
+        }
+    }
+
+    // Each pair of blocks is its own chunk, and the threads write to
+    // separate elements of the output.
+    GILRelease release;
+    parallel_for(tiles.size(), tiles.size(), [&](int begin, int end, int) {
+        MatrixXd localkernels;
+        KernelWorkspace workspace;
+        for (int i_tile = begin; i_tile < end; ++i_tile) {
+            int i_block = tiles[i_tile].first;
+            int j_block = tiles[i_tile].second;
+            int i_start = x_offsets_u(x_blocks[i_block]);
+            int j_start = y_offsets_u(y_blocks[j_block]);
+            this->get_pairwise_matrix(
+                x_features.middleRows(i_start, x_offsets_u(x_blocks[i_block+1]) - i_start),
+                y_features.middleRows(j_start, y_offsets_u(y_blocks[j_block+1]) - j_start),
+                localkernels
+            );
+            for (int i = x_blocks[i_block]; i < x_blocks[i_block+1]; ++i) {
+                for (int j = y_blocks[j_block]; j < y_blocks[j_block+1]; ++j) {
+                    if (symmetric && j < i) {
+                        continue;
+                    }
+                    double k_ij = this->get_global_similarity(
+                        localkernels.block(
+                            x_offsets_u(i) - i_start,
+                            y_offsets_u(j) - j_start,
+                            x_offsets_u(i+1) - x_offsets_u(i),
+                            y_offsets_u(j+1) - y_offsets_u(j)
+                        ),
+                        workspace
+                    );
+                    out_data[(ssize_t)i*n_y + j] = k_ij;
+                    if (symmetric) {
+                        out_data[(ssize_t)j*n_y + i] = k_ij;
+                    }
+                }
+            }
+        }
+    });
+}
+
+void LocalSimilarityKernel::get_self_similarity(
+    py::array_t<double> out,
+    py::array_t<double, py::array::c_style | py::array::forcecast> x,
+    py::array_t<int> x_offsets
+) const
+{
+    check_features(x, x_offsets);
+    int n_x = x_offsets.size() - 1;
+    if (out.ndim() != 1 || out.shape(0) != n_x) {
+        throw invalid_argument("The output must have one entry per structure.");
+    }
+    auto x_offsets_u = x_offsets.unchecked<1>();
+    auto out_mu = out.mutable_unchecked<1>();
+    Map<const RowMatrixXd> x_features(x.data(), x.shape(0), x.shape(1));
+
+    GILRelease release;
+    parallel_for(n_x, [&](int begin, int end, int) {
+        MatrixXd localkernel;
+        KernelWorkspace workspace;
+        for (int i = begin; i < end; ++i) {
+            auto x_i = x_features.middleRows(x_offsets_u(i), x_offsets_u(i+1) - x_offsets_u(i));
+            this->get_pairwise_matrix(x_i, x_i, localkernel);
+            out_mu(i) = this->get_global_similarity(localkernel, workspace);
+        }
+    });
+}
+
+AverageKernel::AverageKernel(string metric, double gamma, double degree, double coef0)
+    : LocalSimilarityKernel(metric, gamma, degree, coef0)
+{
+}
+
+double AverageKernel::get_global_similarity(const Ref<const MatrixXd> &localkernel, KernelWorkspace &) const
+{
+    return localkernel.mean();
+}
+
+REMatchKernel::REMatchKernel(string metric, double gamma, double degree, double coef0, double alpha, double threshold)
+    : LocalSimilarityKernel(metric, gamma, degree, coef0)
+    , alpha(alpha)
+    , threshold(threshold)
+{
+}
+
+double REMatchKernel::get_global_similarity(const Ref<const MatrixXd> &localkernel, KernelWorkspace &workspace) const
+{
+    int n = localkernel.rows();
+    int m = localkernel.cols();
+    MatrixXd &K = workspace.K;
+    VectorXd &u = workspace.u;
+    VectorXd &v = workspace.v;
+    K = (-(1 - localkernel.array())/this->alpha).exp();
+
+    // Converge the balancing vectors u and v. The error is checked on the
+    // same iterations as in the python implementation so that both stop at
+    // the same point.
+    u.setConstant(n, 1.0/n);
+    v.setConstant(m, 1.0/m);
+    double error = 1;
+    for (int iteration = 0; error > this->threshold; ++iteration) {
+        workspace.u_prev = u;
+        workspace.v_prev = v;
+        v.noalias() = K.transpose()*u;
+        v = v.cwiseInverse()/m;
+        u.noalias() = K*v;
+        u = u.cwiseInverse()/n;
+        if (iteration % 5) {
+            error = (u - workspace.u_prev).squaredNorm()/u.squaredNorm()
+                  + (v - workspace.v_prev).squaredNorm()/v.squaredNorm();
+        }
+    }
+
+    // The similarity is Tr(P^T C) = sum_ij P_ij*C_ij, where
+    // P_ij = u_i*v_j*K_ij.
+    return u.dot((K.cwiseProduct(localkernel))*v);
+}
@@ -0,0 +1,139 @@
+/*Copyright 2019 DScribe developers
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef KERNELS_H
+#define KERNELS_H
+
+#include <string>
+#include <pybind11/numpy.h>
+#include <Eigen/Dense>
+
+namespace py = pybind11;
+using namespace std;
+using namespace Eigen;
+
+typedef Matrix<double, Dynamic, Dynamic, RowMajor> RowMatrixXd;
+
+/**
+ * Buffers that are reused when the global similarity is calculated for
+ * several pairs of structures in a row. Each thread needs its own
+ * workspace.
+ */
+struct KernelWorkspace {
+    MatrixXd K;
+    VectorXd u;
+    VectorXd v;
+    VectorXd u_prev;
+    VectorXd v_prev;
+};
+
+/**
+ * Base class for the kernels that calculate a global similarity of
+ * structures from the pairwise similarity of their local environments.
+ *
+ * The local features of all structures are given as one concatenated array
+ * with one row per local environment, and structure i owns the rows
+ * [offsets[i], offsets[i+1]). The structures are grouped into blocks, and
+ * the local similarities between two blocks are calculated at once and
+ * shared by all of the structure pairs in them. The pairs of blocks are
+ * divided between the native threads.
+ */
+class LocalSimilarityKernel {
+    public:
+        /**
+         * Calculates the unnormalized global similarity of every pair of
+         * structures in x and y.
+         *
+         * @param out C-contiguous output with shape (n_x, n_y).
+         * @param symmetric Whether y is the same as x, in which case only the
+         * upper triangular part is calculated and then mirrored.
+         */
+        void create(
+            py::array_t<double> out,
+            py::array_t<double, py::array::c_style | py::array::forcecast> x,
+            py::array_t<int> x_offsets,
+            py::array_t<double, py::array::c_style | py::array::forcecast> y,
+            py::array_t<int> y_offsets,
+            bool symmetric
+        ) const;
+
+        /**
+         * Calculates the unnormalized global similarity of each structure in
+         * x with itself, which is used for normalizing the kernel.
+         */
+        void get_self_similarity(
+            py::array_t<double> out,
+            py::array_t<double, py::array::c_style | py::array::forcecast> x,
+            py::array_t<int> x_offsets
+        ) const;
+
+        string metric;
+        double gamma;
+        double degree;
+        double coef0;
+
+    protected:
+        /**
+         * Constructor, see the python docs for more details about variables.
+         * The default value of gamma is resolved in python. The supported
+         * metrics are linear, polynomial, rbf and laplacian.
+         */
+        LocalSimilarityKernel(string metric, double gamma, double degree, double coef0);
+
+        /**
+         * Computes the global similarity from the given matrix of local
+         * similarities.
+         */
+        virtual double get_global_similarity(const Ref<const MatrixXd> &localkernel, KernelWorkspace &workspace) const = 0;
+
+    private:
+        /**
+         * Calculates the local similarities between the rows of X and Y.
+         */
+        void get_pairwise_matrix(
+            const Ref<const RowMatrixXd> &X,
+            const Ref<const RowMatrixXd> &Y,
+            MatrixXd &out
+        ) const;
+};
+
+/**
+ * Average of the local similarities.
+ */
+class AverageKernel: public LocalSimilarityKernel {
+    public:
+        AverageKernel(string metric, double gamma, double degree, double coef0);
+
+    protected:
+        double get_global_similarity(const Ref<const MatrixXd> &localkernel, KernelWorkspace &workspace) const;
+};
+
+/**
+ * Regularized-entropy match of the local similarities. The optimal
+ * permutation is found with the Sinkhorn algorithm, which stops as soon
+ * as the balancing vectors have converged.
+ */
+class REMatchKernel: public LocalSimilarityKernel {
+    public:
+        REMatchKernel(string metric, double gamma, double degree, double coef0, double alpha, double threshold);
+
+        double alpha;
+        double threshold;
+
+    protected:
+        double get_global_similarity(const Ref<const MatrixXd> &localkernel, KernelWorkspace &workspace) const;
+};
+
+#endif
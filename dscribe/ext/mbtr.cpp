@@ -1,23 +1,576 @@
 #include "mbtr.h"
+#include "celllist.h"
+#include "threadpool.h"
+#include "profiling.h"
+#include <limits>
+#include <memory>
 using namespace std;
 
 
-MBTR::MBTR(map<int,int> atomicNumberToIndexMap, int interactionLimit, vector<vector<int>> cellIndices)
+namespace {
+/**
+ * The geometry and weighting functions, resolved from their names once
+ * before looping over the atoms.
+ */
+enum class K2Geometry { InverseDistance, Distance };
+enum class K2Weighting { Exponential, Unity, InverseSquare };
+enum class K3Geometry { Cosine, Angle };
+enum class K3Weighting { Exponential, Unity, SmoothCutoff };
+
+/**
+ * The k=2 functions together with their parameters.
+ */
+struct K2Functions {
+    K2Geometry geometry;
+    K2Weighting weighting;
+    double scale = 0;
+    double threshold = 0;
+};
+
+/**
+ * The k=3 functions together with their parameters. Triplets with a
+ * perimeter above maxPerimeter or an edge at the middle atom longer than
+ * the cutoff have a negligible weight.
+ */
+struct K3Functions {
+    K3Geometry geometry;
+    K3Weighting weighting;
+    double scale = 0;
+    double maxPerimeter = numeric_limits<double>::infinity();
+    double sharpness = 0;
+    double cutoff = numeric_limits<double>::infinity();
+};
+
+K2Functions parseK2Functions(const string &geomFunc, const string &weightFunc, const map<string, double> &parameters)
+{
+    K2Functions functions;
+    if (geomFunc == "inverse_distance") {
+        functions.geometry = K2Geometry::InverseDistance;
+    } else if (geomFunc == "distance") {
+        functions.geometry = K2Geometry::Distance;
+    } else {
+        throw invalid_argument("Invalid geometry function.");
+    }
+    if (weightFunc == "exp") {
+        functions.weighting = K2Weighting::Exponential;
+        functions.scale = parameters.at("scale");
+        functions.threshold = parameters.at("threshold");
+    } else if (weightFunc == "unity") {
+        functions.weighting = K2Weighting::Unity;
+    } else if (weightFunc == "inverse_square") {
+        functions.weighting = K2Weighting::InverseSquare;
+    } else {
+        throw invalid_argument("Invalid weighting function.");
+    }
+    return functions;
+}
+
+K3Functions parseK3Functions(const string &geomFunc, const string &weightFunc, const map<string, double> &parameters)
+{
+    K3Functions functions;
+    if (geomFunc == "cosine") {
+        functions.geometry = K3Geometry::Cosine;
+    } else if (geomFunc == "angle") {
+        functions.geometry = K3Geometry::Angle;
+    } else {
+        throw invalid_argument("Invalid geometry function.");
+    }
+    if (weightFunc == "exp") {
+        // The weight drops below the threshold when the perimeter of the
+        // triangle exceeds this value.
+        functions.weighting = K3Weighting::Exponential;
+        functions.scale = parameters.at("scale");
+        functions.maxPerimeter = -log(parameters.at("threshold"))/functions.scale;
+    } else if (weightFunc == "unity") {
+        functions.weighting = K3Weighting::Unity;
+    } else if (weightFunc == "smooth_cutoff") {
+        functions.weighting = K3Weighting::SmoothCutoff;
+        functions.sharpness = parameters.at("sharpness");
+        functions.cutoff = parameters.at("cutoff");
+    } else {
+        throw invalid_argument("Invalid weighting function.");
+    }
+    return functions;
+}
+
+/**
+ * Calculates the geometry and weight values for a pair of atoms at the given
+ * distance. The derivatives of both values with respect to the position of
+ * one atom are parallel to the distance vector pointing to that atom from
+ * the other one, so only their magnitudes relative to that vector are
+ * returned. The weight derivative is divided by the weight.
+ *
+ * @return False if the weight is below the threshold and the pair should be
+ * skipped.
+ */
+inline bool getK2Values(const K2Functions &functions, double dist, double &geom, double &geom_d, double &weight, double &weight_d)
+{
+    switch (functions.weighting) {
+        case K2Weighting::Exponential:
+            weight = exp(-functions.scale*dist);
+            if (weight < functions.threshold) {
+                return false;
+            }
+            weight_d = -functions.scale/dist;
+            break;
+        case K2Weighting::Unity:
+            weight = 1;
+            weight_d = 0;
+            break;
+        case K2Weighting::InverseSquare:
+        default:
+            weight = 1/(dist*dist);
+            weight_d = -2.0/(dist*dist);
+            break;
+    }
+    switch (functions.geometry) {
+        case K2Geometry::InverseDistance:
+            geom = 1/dist;
+            geom_d = -1/(dist*dist*dist);
+            break;
+        case K2Geometry::Distance:
+        default:
+            geom = dist;
+            geom_d = 1/dist;
+            break;
+    }
+    return true;
+}
+
+/**
+ * Checks whether the triplet i-j-k with the middle atom j has a
+ * non-negligible weight.
+ */
+inline bool isK3Included(const K3Functions &functions, double d_ji, double d_ik, double d_jk)
+{
+    return d_ji <= functions.cutoff && d_jk <= functions.cutoff && d_ji + d_jk + d_ik <= functions.maxPerimeter;
+}
+
+/**
+ * Calculates the geometry and weight values for the triplet i-j-k, where j
+ * is the middle atom, and if requested their derivatives with respect to the
+ * positions of i, j and k. The weight derivatives are divided by the weight.
+ * "angle" has no derivatives because it is not differentiable.
+ */
+inline void getK3Values(const K3Functions &functions, const double* r_ji, const double* r_ik, const double* r_jk, double d_ji, double d_ik, double d_jk, bool return_derivatives, double &geom, double geom_d[3][3], double &weight, double weight_d[3][3])
+{
+    switch (functions.weighting) {
+        case K3Weighting::Exponential: {
+            const double scale = functions.scale;
+            weight = exp(-scale*(d_ji + d_jk + d_ik));
+            if (return_derivatives) {
+                for (int dim = 0; dim < 3; ++dim) {
+                    weight_d[0][dim] = scale*( r_ji[dim]/d_ji - r_ik[dim]/d_ik);
+                    weight_d[1][dim] = scale*(-r_ji[dim]/d_ji - r_jk[dim]/d_jk);
+                    weight_d[2][dim] = scale*( r_jk[dim]/d_jk + r_ik[dim]/d_ik);
+                }
+            }
+            break;
+        }
+        case K3Weighting::Unity:
+            weight = 1;
+            if (return_derivatives) {
+                for (int a = 0; a < 3; ++a) {
+                    for (int dim = 0; dim < 3; ++dim) {
+                        weight_d[a][dim] = 0;
+                    }
+                }
+            }
+            break;
+        case K3Weighting::SmoothCutoff:
+        default: {
+            double y = functions.sharpness;
+            double frac_ij = d_ji/functions.cutoff;
+            double frac_jk = d_jk/functions.cutoff;
+            double pow1_ij = pow(frac_ij, y+1);
+            double pow2_ij = pow(frac_ij, y);
+            double pow1_jk = pow(frac_jk, y+1);
+            double pow2_jk = pow(frac_jk, y);
+            double f_ij = 1 + y*pow1_ij - (y+1)*pow2_ij;
+            double f_jk = 1 + y*pow1_jk - (y+1)*pow2_jk;
+            weight = f_ij*f_jk;
+
+            if (return_derivatives) {
+                double c1 = y*(y+1)/(d_ji*d_ji)*(pow1_ij-pow2_ij)/f_ij;
+                double c2 = y*(y+1)/(d_jk*d_jk)*(pow1_jk-pow2_jk)/f_jk;
+                for (int dim = 0; dim < 3; ++dim) {
+                    weight_d[0][dim] = -c1*r_ji[dim];
+                    weight_d[1][dim] =  c2*r_jk[dim] + c1*r_ji[dim];
+                    weight_d[2][dim] = -c2*r_jk[dim];
+                }
+            }
+            break;
+        }
+    }
+
+    double num = d_ji*d_ji + d_jk*d_jk - d_ik*d_ik;  // Numerator
+    double den = d_jk*d_ji;                          // Denumerator
+
+    // Due to numerical reasons the cosine might be slightly under -1 or above
+    // 1. E.g. acos is not defined then so we clip the values to prevent NaN:s
+    double cosine = std::max(-1.0, std::min(0.5*num/den, 1.0));
+    if (functions.geometry == K3Geometry::Angle) {
+        geom = acos(cosine)*180.0/PI;
+        return;
+    }
+    geom = cosine;
+    if (return_derivatives) {
+        for (int dim = 0; dim < 3; ++dim) {
+            double num_d_i = 2.0*(-r_ji[dim] - r_ik[dim]);
+            double num_d_j = 2.0*( r_ji[dim] + r_jk[dim]);
+            double num_d_k = 2.0*(-r_jk[dim] + r_ik[dim]);
+
+            double den_d_i = -d_jk/d_ji*r_ji[dim];
+            double den_d_j =  d_ji/d_jk*r_jk[dim] + d_jk/d_ji*r_ji[dim];
+            double den_d_k = -d_ji/d_jk*r_jk[dim];
+
+            geom_d[0][dim] = 0.5*(num_d_i*den - num*den_d_i)/(den*den);
+            geom_d[1][dim] = 0.5*(num_d_j*den - num*den_d_j)/(den*den);
+            geom_d[2][dim] = 0.5*(num_d_k*den - num*den_d_k)/(den*den);
+        }
+    }
+}
+
+/**
+ * The grid on which the geometry values are broadened. Bin i spans the
+ * interval [start + i*dx, start + (i+1)*dx].
+ */
+struct Grid {
+    Grid(double min, double max, double sigma, int n)
+        : n(n)
+        , sigma(sigma)
+        , sigmasqrt2(sigma*sqrt(2.0))
+        , dx((max-min)/(n-1))
+        , start(min-dx/2)
+    {
+    }
+    const int n;
+    const double sigma;
+    const double sigmasqrt2;
+    const double dx;
+    const double start;
+};
+
+/**
+ * The gaussians are only evaluated within this many standard deviations
+ * from their center. Further away the bin values are below the double
+ * precision round-off of the cumulative distribution function.
+ */
+const double gaussianCutoff = 8.0;
+
+/**
+ * Finds the range [first, last) of bins that the truncated gaussian
+ * centered at the given value overlaps with.
+ */
+inline void getBinRange(double center, const Grid &grid, int &first, int &last)
+{
+    const double width = gaussianCutoff*grid.sigma;
+    const double lower = floor((center - width - grid.start)/grid.dx);
+    const double upper = ceil((center + width - grid.start)/grid.dx);
+    first = int(std::max(0.0, std::min(lower, double(grid.n))));
+    last = int(std::max(0.0, std::min(upper, double(grid.n))));
+}
+
+/**
+ * Broadens the given value with a weighted gaussian and passes the value of
+ * each overlapping bin to add(index, gauss). The bin values are calculated as
+ * differences of the cumulative distribution function, as with coarse
+ * discretization this preserves the norm better.
+ */
+template <typename F>
+inline void broaden(double center, double weight, const Grid &grid, F add)
+{
+    int first, last;
+    getBinRange(center, grid, first, last);
+    if (first >= last) {
+        return;
+    }
+    const double factor = 0.5*weight/grid.dx;
+    double erfPrev = erf((grid.start + first*grid.dx - center)/grid.sigmasqrt2);
+    for (int index = first; index < last; ++index) {
+        const double erfNext = erf((grid.start + (index+1)*grid.dx - center)/grid.sigmasqrt2);
+        add(index, factor*(erfNext - erfPrev));
+        erfPrev = erfNext;
+    }
+}
+
+/**
+ * Same as broaden, but also passes the derivative of each bin value with
+ * respect to the center: add(index, gauss, slope).
+ */
+template <typename F>
+inline void broadenWithSlope(double center, double weight, const Grid &grid, F add)
+{
+    int first, last;
+    getBinRange(center, grid, first, last);
+    if (first >= last) {
+        return;
+    }
+    const double factor = 0.5*weight/grid.dx;
+    const double slopeFactor = -weight/(grid.sigma*sqrt(2.0*PI)*grid.dx);
+    double u = (grid.start + first*grid.dx - center)/grid.sigmasqrt2;
+    double erfPrev = erf(u);
+    double expPrev = exp(-u*u);
+    for (int index = first; index < last; ++index) {
+        u = (grid.start + (index+1)*grid.dx - center)/grid.sigmasqrt2;
+        const double erfNext = erf(u);
+        const double expNext = exp(-u*u);
+        add(index, factor*(erfNext - erfPrev), slopeFactor*(expNext - expPrev));
+        erfPrev = erfNext;
+        expPrev = expNext;
+    }
+}
+
+/**
+ * The atoms that are considered in the MBTR calculation: the original atoms
+ * followed by the periodic copies that are within the cutoff from them,
+ * together with the neighbour list of the atoms in a compressed format.
+ */
+struct MBTRSystem {
+    int nOriginal;
+    vector<double> positions;
+    vector<int> atomicNumbers;
+    vector<int> cells;
+    vector<int> neighbourOffsets;
+    vector<int> neighbourIndices;
+};
+
+/**
+ * Creates the extended system and its neighbour lists with cell lists. The
+ * periodic copies are identified by the index of the periodic image they
+ * belong to, which is zero for the original atoms. Without a cutoff every
+ * atom is a neighbour of every other atom.
+ *
+ * @param allNeighbours Whether the neighbours are needed also for the
+ *   periodic copies, or only for the original atoms.
+ */
+MBTRSystem getSystem(py::array_t<double> &positions, py::array_t<int> &atomic_numbers, py::array_t<double> &cell, py::array_t<bool> &pbc, double cutoff, bool allNeighbours)
+{
+    auto positions_u = positions.unchecked<2>();
+    auto atomic_numbers_u = atomic_numbers.unchecked<1>();
+    auto pbc_u = pbc.unchecked<1>();
+    const int nAtoms = atomic_numbers_u.shape(0);
+
+    MBTRSystem system;
+    system.nOriginal = nAtoms;
+    for (int i = 0; i < nAtoms; ++i) {
+        for (int dim = 0; dim < 3; ++dim) {
+            system.positions.push_back(positions_u(i, dim));
+        }
+        system.atomicNumbers.push_back(atomic_numbers_u(i));
+        system.cells.push_back(0);
+    }
+    system.neighbourOffsets.push_back(0);
+
+    // Without a cutoff all pairs of atoms are neighbours
+    if (cutoff <= 0) {
+        if (pbc_u(0) || pbc_u(1) || pbc_u(2)) {
+            throw invalid_argument("Periodic systems need a finite cutoff.");
+        }
+        for (int i = 0; i < nAtoms; ++i) {
+            for (int j = 0; j < nAtoms; ++j) {
+                if (j != i) {
+                    system.neighbourIndices.push_back(j);
+                }
+            }
+            system.neighbourOffsets.push_back(system.neighbourIndices.size());
+        }
+        return system;
+    }
+
+    // Add each periodic copy that is within the cutoff from an original atom
+    // once
+    CellList periodicList(positions, cutoff, cell, pbc);
+    CellListNeighbours neighbours;
+    vector<int> copyIndices(periodicList.getNumberOfImages()*nAtoms, -1);
+    for (int i = 0; i < nAtoms; ++i) {
+        periodicList.getNeighboursForPosition(positions_u(i, 0), positions_u(i, 1), positions_u(i, 2), neighbours);
+        for (size_t k = 0; k < neighbours.indices.size(); ++k) {
+            const int j = neighbours.indices[k];
+            const int image = neighbours.images[k];
+            if (image == 0 || copyIndices[image*nAtoms + j] >= 0) {
+                continue;
+            }
+            copyIndices[image*nAtoms + j] = system.atomicNumbers.size();
+            const double* shift = periodicList.getShift(image);
+            for (int dim = 0; dim < 3; ++dim) {
+                system.positions.push_back(positions_u(j, dim) + shift[dim]);
+            }
+            system.atomicNumbers.push_back(atomic_numbers_u(j));
+            system.cells.push_back(image);
+        }
+    }
+
+    // The neighbours are searched within the extended system, which is
+    // treated as a finite system.
+    const int nExtended = system.atomicNumbers.size();
+    py::array_t<double> extendedPositions({nExtended, 3});
+    auto extendedPositions_mu = extendedPositions.mutable_unchecked<2>();
+    for (int i = 0; i < nExtended; ++i) {
+        for (int dim = 0; dim < 3; ++dim) {
+            extendedPositions_mu(i, dim) = system.positions[3*i + dim];
+        }
+    }
+    CellList cellList(extendedPositions, cutoff);
+    const int nQueried = allNeighbours ? nExtended : nAtoms;
+    for (int i = 0; i < nQueried; ++i) {
+        const double* position = &system.positions[3*i];
+        cellList.getNeighboursForPosition(position[0], position[1], position[2], neighbours);
+        for (const int &j : neighbours.indices) {
+            if (j != i) {
+                system.neighbourIndices.push_back(j);
+            }
+        }
+        system.neighbourOffsets.push_back(system.neighbourIndices.size());
+    }
+    return system;
+}
+
+inline double getDistance(const double* positions, int i, int j)
+{
+    double dx = positions[3*i] - positions[3*j];
+    double dy = positions[3*i+1] - positions[3*j+1];
+    double dz = positions[3*i+2] - positions[3*j+2];
+    return sqrt(dx*dx + dy*dy + dz*dz);
+}
+
+/**
+ * Returns the first position of each atom in the given list of atom indices,
+ * or -1 for the atoms that are not in the list.
+ */
+vector<int> getIndexSlots(py::array_t<int> &indices, int nAtoms)
+{
+    auto indices_u = indices.unchecked<1>();
+    vector<int> slots(nAtoms, -1);
+    for (int slot = indices_u.shape(0) - 1; slot >= 0; --slot) {
+        slots[indices_u(slot)] = slot;
+    }
+    return slots;
+}
+
+/**
+ * Returns the pairs (slot, first slot) for the atoms that are included more
+ * than once in the given list of atom indices.
+ */
+vector<pair<int, int>> getDuplicateSlots(py::array_t<int> &indices, const vector<int> &slots)
+{
+    auto indices_u = indices.unchecked<1>();
+    vector<pair<int, int>> duplicates;
+    for (int slot = 0; slot < indices_u.shape(0); ++slot) {
+        const int first = slots[indices_u(slot)];
+        if (first != slot) {
+            duplicates.push_back(make_pair(slot, first));
+        }
+    }
+    return duplicates;
+}
+
+/**
+ * Copies the derivatives of a single center from the first slot of each
+ * duplicated atom to its other slots.
+ */
+void copyDuplicateSlots(const vector<pair<int, int>> &duplicates, double* rowDerivatives, int nFeatures)
+{
+    const size_t blockSize = 3*nFeatures;
+    for (const pair<int, int> &duplicate : duplicates) {
+        const double* first = rowDerivatives + duplicate.second*blockSize;
+        copy(first, first + blockSize, rowDerivatives + duplicate.first*blockSize);
+    }
+}
+
+/**
+ * Creates the cell list that is used to find the neighbours of the local
+ * centers. Without a cutoff every atom is a neighbour and no cell list is
+ * created, which is only possible for finite systems.
+ */
+unique_ptr<CellList> getLocalCellList(py::array_t<double> &positions, py::array_t<double> &cell, py::array_t<bool> &pbc, double cutoff)
+{
+    if (cutoff <= 0) {
+        auto pbc_u = pbc.unchecked<1>();
+        if (pbc_u(0) || pbc_u(1) || pbc_u(2)) {
+            throw invalid_argument("Periodic systems need a finite cutoff.");
+        }
+        return nullptr;
+    }
+    return unique_ptr<CellList>(new CellList(positions, cutoff, cell, pbc));
+}
+
+/**
+ * The neighbours of a local center: their atom indices, the vectors from the
+ * center to them and the lengths of these vectors. In periodic systems the
+ * same atom may be a neighbour several times, once for each periodic image.
+ */
+struct LocalNeighbours {
+    vector<int> indices;
+    vector<double> vectors;
+    vector<double> distances;
+};
+
+/**
+ * Finds the neighbours of a local center. The atom that the center is
+ * attached to is not its own neighbour, but its periodic images are. Atoms
+ * exactly at the center have no defined distance or angle and are skipped.
+ *
+ * @param cellList Cell list for the atoms, or nullptr if every atom is a
+ *   neighbour.
+ * @param centerIndex Index of the atom that the center is attached to, or -1.
+ * @param found Buffer for the cell list query.
+ */
+void getLocalNeighbours(const CellList* cellList, const py::detail::unchecked_reference<double, 2> &positions, const double* center, int centerIndex, CellListNeighbours &found, LocalNeighbours &neighbours)
+{
+    neighbours.indices.clear();
+    neighbours.vectors.clear();
+    neighbours.distances.clear();
+    if (cellList == nullptr) {
+        for (int i = 0; i < positions.shape(0); ++i) {
+            double v[3] = {positions(i, 0) - center[0], positions(i, 1) - center[1], positions(i, 2) - center[2]};
+            double distanceSquared = v[0]*v[0] + v[1]*v[1] + v[2]*v[2];
+            if (i == centerIndex || distanceSquared == 0) {
+                continue;
+            }
+            neighbours.indices.push_back(i);
+            neighbours.vectors.insert(neighbours.vectors.end(), v, v + 3);
+            neighbours.distances.push_back(sqrt(distanceSquared));
+        }
+        return;
+    }
+    cellList->getNeighboursForPosition(center[0], center[1], center[2], found);
+    for (size_t q = 0; q < found.indices.size(); ++q) {
+        if ((found.indices[q] == centerIndex && found.images[q] == 0) || found.distancesSquared[q] == 0) {
+            continue;
+        }
+        neighbours.indices.push_back(found.indices[q]);
+        neighbours.vectors.push_back(found.dx[q]);
+        neighbours.vectors.push_back(found.dy[q]);
+        neighbours.vectors.push_back(found.dz[q]);
+        neighbours.distances.push_back(sqrt(found.distancesSquared[q]));
+    }
+}
+}
+
+MBTR::MBTR(map<int,int> atomicNumberToIndexMap, int interactionLimit)
     : atomicNumberToIndexMap(atomicNumberToIndexMap)
     , interactionLimit(interactionLimit)
-    , cellIndices(cellIndices)
 {
 }
 
 void MBTR::getK1(py::array_t<double> &descriptor, const vector<int> &Z, const string &geomFunc, const string &weightFunc, const map<string, double> &parameters, double min, double max, double sigma, int n)
 {
+    // The only supported functions are the atomic number and unity weighting
+    if (geomFunc != "atomic_number") {
+        throw invalid_argument("Invalid geometry function.");
+    }
+    if (weightFunc != "unity") {
+        throw invalid_argument("Invalid weighting function.");
+    }
+
+    ScopedTimer timer("MBTR", "k1");
+
     // Create mutable and unchecked version
     auto descriptor_mu = descriptor.mutable_unchecked<1>();
 
     int nAtoms = Z.size();
-    double dx = (max-min)/(n-1);
-    double sigmasqrt2 = sigma*sqrt(2.0);
-    double start = min-dx/2;
+    const Grid grid(min, max, sigma, n);
 
     for (int i = 0; i < nAtoms; ++i) {
         // Only consider atoms within the original cell
@@ -25,120 +578,59 @@ void MBTR::getK1(py::array_t<double> &descriptor, const vector<int> &Z, const st
             continue;
         }
 
-        // Calculate geometry value
-        double geom;
-        if (geomFunc == "atomic_number") {
-            geom = k1GeomAtomicNumber(i, Z);
-        } else {
-            throw invalid_argument("Invalid geometry function.");
-        }
-
-        // Calculate weight value
-        double weight;
-        if (weightFunc == "unity") {
-            weight = k1WeightUnity(i);
-        } else {
-            throw invalid_argument("Invalid weighting function.");
-        }
-
-        // Calculate gaussian
-        vector<double> gauss = gaussian(geom, weight, start, dx, sigmasqrt2, n);
-
         // Get the index of the present elements in the final vector
-        int i_elem = Z[i];
-        int i_index = this->atomicNumberToIndexMap.at(i_elem);
+        int i_index = this->atomicNumberToIndexMap.at(Z[i]);
         int begin = i_index * n;
-        int end = (i_index + 1) * n;
-
-        for (int index = 0; index < n; ++index) {
-            descriptor_mu[begin+index] += gauss[index];
-        }
+        broaden(Z[i], 1.0, grid, [&](int index, double gauss) {
+            descriptor_mu(begin+index) += gauss;
+        });
     }
 }
 
-void MBTR::getK2(py::array_t<double> &descriptor, py::array_t<double> &derivatives, bool return_descriptor, bool return_derivatives, const vector<int> &Z, const vector<vector<double>> &positions, const vector<vector<double>> &distances, const vector<vector<int>> &neighbours, const string &geomFunc, const string &weightFunc, const map<string, double> &parameters, double min, double max, double sigma, int n)
+void MBTR::getK2(py::array_t<double> &descriptor, py::array_t<double> &derivatives, bool return_descriptor, bool return_derivatives, py::array_t<double> &positions, py::array_t<int> &atomic_numbers, py::array_t<double> &cell, py::array_t<bool> &pbc, double radialCutoff, const string &geomFunc, const string &weightFunc, const map<string, double> &parameters, double min, double max, double sigma, int n)
 {
+    const K2Functions functions = parseK2Functions(geomFunc, weightFunc, parameters);
+
+    // The neighbour lists are created while holding the GIL, since they use
+    // temporary numpy arrays.
+    PhaseTimer neighboursTimer("MBTR", "neighbours");
+    neighboursTimer.start();
+    const MBTRSystem system = getSystem(positions, atomic_numbers, cell, pbc, radialCutoff, false);
+    neighboursTimer.stop();
+    Profiler::add_count("MBTR", "neighbours", system.neighbourIndices.size());
+    GILRelease release;
+    ScopedTimer timer("MBTR", "k2");
+
     // Create mutable and unchecked versions
     auto descriptor_mu = descriptor.mutable_unchecked<1>();
     auto derivatives_mu = derivatives.mutable_unchecked<3>();
 
     // Initialize some variables outside the loop
-    int nAtoms = Z.size();
+    const int nOriginal = system.nOriginal;
+    const double* pos = system.positions.data();
+    const vector<int> &Z = system.atomicNumbers;
     int nElem = this->atomicNumberToIndexMap.size();
-    double dx = (max-min)/(n-1);
-    double sigmasqrt2 = sigma*sqrt(2.0);
-    double start = min-dx/2;
+    const Grid grid(min, max, sigma, n);
 
-    // We have to loop over all atoms in the system
-    for (int i = 0; i < nAtoms; ++i) {
+    // Every pair has at least one atom in the original cell, so the pairs are
+    // found from the neighbours of the original atoms.
+    for (int i = 0; i < nOriginal; ++i) {
 
         // For each atom we loop only over the neighbours
-        const vector<int> &i_neighbours = neighbours[i];
-        for (const int &j : i_neighbours) {
+        for (int j_idx = system.neighbourOffsets[i]; j_idx < system.neighbourOffsets[i+1]; ++j_idx) {
+            const int j = system.neighbourIndices[j_idx];
             if (j <= i) {
                 continue;
             }
 
-            // Only consider pairs that have one atom in the original cell
-            if (i >= this->interactionLimit && j >= this->interactionLimit) {
-                continue;
-            }
-                
             // Distance vector between atom pair (i,j) and its length
-            vector<double> dist_vec{ positions[i][0] - positions[j][0],
-                                    positions[i][1] - positions[j][1],
-                                    positions[i][2] - positions[j][2]};
-            //double dist = sqrt(inner_product(dist_vec.begin(), dist_vec.end(), dist_vec.begin(), 0.0));
-            double dist = distances[i][j];
-
-            // Calculate geometry value
-            double geom;
-            vector<double> geom_d(3);
-            if (geomFunc == "inverse_distance") {
-                geom = k2GeomInverseDistance(i, j, distances);
-               //geom = 1/dist;
-                if (return_derivatives) {
-                    for (int dim = 0; dim < 3; ++dim) {
-                        geom_d[dim] = -dist_vec[dim]/pow(dist,3.0);
-                    }
-                }
-            } else if (geomFunc == "distance") {
-                geom = k2GeomDistance(i, j, distances);
-                //geom = dist;
-                for (int dim = 0; dim<3; ++dim) {
-                    geom_d[dim] = dist_vec[dim]/dist;
-                }
-            } else {
-                throw invalid_argument("Invalid geometry function.");
-            }
+            double dist_vec[3] = {pos[3*i] - pos[3*j], pos[3*i+1] - pos[3*j+1], pos[3*i+2] - pos[3*j+2]};
+            double dist = getDistance(pos, i, j);
 
-            // Calculate weight value
-            double weight;
-            vector<double> weight_d(3, 0.0); // Weight derivatives divided by weight!
-            if (weightFunc == "exp") {
-                double scale = parameters.at("scale");
-                double threshold = parameters.at("threshold");
-                weight = k2WeightExponential(i, j, distances, scale);
-                if (weight < threshold) {
-                    continue;
-                }
-                if (return_derivatives) {
-                    for (int dim = 0; dim < 3; ++dim) {
-                        weight_d[dim] = -scale/dist*dist_vec[dim];
-                    }
-                }
-            } else if (weightFunc == "unity") {
-                weight = k2WeightUnity(i, j, distances);
-                // weight_d = [0,0,0]
-            } else if (weightFunc == "inverse_square") {
-                weight = k2WeightSquare(i, j, distances);
-                if (return_derivatives) {
-                    for (int dim = 0; dim < 3; ++dim) {
-                        weight_d[dim] = -2.0/(dist*dist)*dist_vec[dim];
-                    }
-                }
-            } else {
-                throw invalid_argument("Invalid weighting function.");
+            // The exponential weighting may skip the pair
+            double geom, geom_d, weight, weight_d;
+            if (!getK2Values(functions, dist, geom, geom_d, weight, weight_d)) {
+                continue;
             }
 
             // When the pair of atoms are in different copies of the cell, the
@@ -148,22 +640,15 @@ void MBTR::getK2(py::array_t<double> &descriptor, py::array_t<double> &derivativ
             // supercells equal to the primitive cell within a constant that is
             // given by the number of repetitions of the primitive cell in the
             // supercell.
-            vector<int> i_copy = this->cellIndices[i];
-            vector<int> j_copy = this->cellIndices[j];
             int derivative_correction = 1;
-            if (i_copy != j_copy) {
+            if (system.cells[i] != system.cells[j]) {
                 weight /= 2;
                 derivative_correction = 2;
             }
 
-            // Calculate gaussian
-            vector<double> gauss = gaussian(geom, weight, start, dx, sigmasqrt2, n);
-
             // Get the index of the present elements in the final vector
-            int i_elem = Z[i];
-            int j_elem = Z[j];
-            int i_index = this->atomicNumberToIndexMap.at(i_elem);
-            int j_index = this->atomicNumberToIndexMap.at(j_elem);
+            int i_index = this->atomicNumberToIndexMap.at(Z[i]);
+            int j_index = this->atomicNumberToIndexMap.at(Z[j]);
 
             // Save information in the part where j_index >= i_index
             if (j_index < i_index) {
@@ -177,650 +662,438 @@ void MBTR::getK2(py::array_t<double> &descriptor, py::array_t<double> &derivativ
             // to bottom.
             int m = int(j_index + i_index*nElem - i_index*(i_index + 1)/2);
             int begin = m * n;
-            int end = (m + 1) * n;
 
-            if (return_descriptor) {
-                for (int index = 0; index < n; ++index) {
-                    descriptor_mu[begin+index] += gauss[index];
+            if (!return_derivatives) {
+                if (return_descriptor) {
+                    broaden(geom, weight, grid, [&](int index, double gauss) {
+                        descriptor_mu(begin+index) += gauss;
+                    });
                 }
+                continue;
             }
 
-            if (return_derivatives) {
-                // Calculate x*gaussian distribution.
-                vector<double> xgauss = xgaussian(geom, weight, start, dx, sigma, n);
-                
-                // Add derivative contribution to derivatives that it affects.
-                // Derivatives are antisymmetric.
+            // Add derivative contribution to derivatives that it affects.
+            // Derivatives are antisymmetric. The correction counteracts the
+            // weight halving.
+            const bool j_original = j < nOriginal;
+            broadenWithSlope(geom, weight, grid, [&](int index, double gauss, double slope) {
+                if (return_descriptor) {
+                    descriptor_mu(begin+index) += gauss;
+                }
+                const double factor = derivative_correction*(geom_d*slope + weight_d*gauss);
                 for (int dim = 0; dim < 3; ++dim) {
-                    for (int index = 0; index < n; ++index) {
-                        double gauss_d = geom_d[dim]*(xgauss[index] - gauss[index]*geom)*pow(sigma,-2.0)
-                                        + weight_d[dim]*gauss[index];
-                        // Counteracting the weight halving
-                        gauss_d *= derivative_correction;
-                        if (i < this->interactionLimit) {
-                            derivatives_mu(i, dim, begin+index) += gauss_d;
-                        }
-                        if (j < this->interactionLimit) {
-                            derivatives_mu(j, dim, begin+index) -= gauss_d;
-                        }
-                    }                        
+                    const double gauss_d = factor*dist_vec[dim];
+                    derivatives_mu(i, dim, begin+index) += gauss_d;
+                    if (j_original) {
+                        derivatives_mu(j, dim, begin+index) -= gauss_d;
+                    }
                 }
-            }
+            });
         }
     }
 }
 
-void MBTR::getK3(py::array_t<double> &descriptor, py::array_t<double> &derivatives, bool return_descriptor, bool return_derivatives, const vector<int> &Z, const vector<vector<double>> &positions, const vector<vector<double>> &distances, const vector<vector<int>> &neighbours, const string &geomFunc, const string &weightFunc, const map<string, double> &parameters, double min, double max, double sigma, int n)
+void MBTR::getK3(py::array_t<double> &descriptor, py::array_t<double> &derivatives, bool return_descriptor, bool return_derivatives, py::array_t<double> &positions, py::array_t<int> &atomic_numbers, py::array_t<double> &cell, py::array_t<bool> &pbc, double radialCutoff, const string &geomFunc, const string &weightFunc, const map<string, double> &parameters, double min, double max, double sigma, int n)
 {
-    // Create mutable and unchecked versions
-    auto descriptor_mu = descriptor.mutable_unchecked<1>();
-    auto derivatives_mu = derivatives.mutable_unchecked<3>();
+    const K3Functions functions = parseK3Functions(geomFunc, weightFunc, parameters);
+    if (return_derivatives && functions.geometry == K3Geometry::Angle) {
+        throw invalid_argument("Derivatives not implemented for geometry function 'angle'.");
+    }
 
+    // The neighbour lists are created while holding the GIL, since they use
+    // temporary numpy arrays.
+    PhaseTimer neighboursTimer("MBTR", "neighbours");
+    neighboursTimer.start();
+    const MBTRSystem system = getSystem(positions, atomic_numbers, cell, pbc, radialCutoff, true);
+    neighboursTimer.stop();
+    Profiler::add_count("MBTR", "neighbours", system.neighbourIndices.size());
+    GILRelease release;
+    ScopedTimer timer("MBTR", "k3");
+
+    const int nOriginal = system.nOriginal;
+    const double* pos = system.positions.data();
+    const vector<int> &Z = system.atomicNumbers;
     int nAtoms = Z.size();
     int nElem = this->atomicNumberToIndexMap.size();
-    double dx = (max-min)/(n-1);
-    double sigmasqrt2 = sigma*sqrt(2.0);
-    double start = min-dx/2;
-
+    const int nFeatures = nElem*nElem*(nElem + 1)/2*n;
+    const Grid grid(min, max, sigma, n);
+    vector<int> elementIndex(nAtoms);
     for (int i = 0; i < nAtoms; ++i) {
+        elementIndex[i] = this->atomicNumberToIndexMap.at(Z[i]);
+    }
 
-        // For each atom we loop only over the atoms triplets that are
-        // within the neighbourhood
-        const vector<int> &i_neighbours = neighbours[i];
-        for (const int &j : i_neighbours) {
-            const vector<int> &j_neighbours = neighbours[j];
-            for (const int &k : j_neighbours) {
-                // Only consider triplets that have one atom in the original
-                // cell
-                if (i >= this->interactionLimit && j >= this->interactionLimit && k >= this->interactionLimit)  {
-                    continue;
-                }
-                // Calculate angle for all index permutations from choosing
-                // three out of nAtoms. The same atom cannot be present twice
-                // in the permutation.
-                if (j == i || k == j || k == i) {
-                    continue;
-                }
-                // The angles are symmetric: ijk = kji. The value is
-                // calculated only for the triplet where k > i.
-                if (k <= i){
-                    continue;
-                }
+    // The triplets are enumerated around their middle atom j, and the middle
+    // atoms are split into chunks that are processed by the native threads.
+    // The first chunk writes to the output directly and the others to their
+    // own zeroed copies, which are summed to the output in chunk order.
+    const int nChunks = get_num_chunks(nAtoms);
+    const size_t descriptorSize = return_descriptor ? nFeatures : 0;
+    const size_t derivativesSize = return_derivatives ? (size_t)nOriginal*3*nFeatures : 0;
+    vector<vector<double>> descriptorParts(nChunks);
+    vector<vector<double>> derivativesParts(nChunks);
+
+    parallel_for(nAtoms, nChunks, [&](int jBegin, int jEnd, int i_chunk) {
+        double* descriptorOut = descriptor.mutable_data();
+        double* derivativesOut = derivatives.mutable_data();
+        if (i_chunk > 0) {
+            descriptorParts[i_chunk].assign(descriptorSize, 0.0);
+            derivativesParts[i_chunk].assign(derivativesSize, 0.0);
+            descriptorOut = descriptorParts[i_chunk].data();
+            derivativesOut = derivativesParts[i_chunk].data();
+        }
+        vector<double> neighbourDistances;
+
+        for (int j = jBegin; j < jEnd; ++j) {
+            const int nbrBegin = system.neighbourOffsets[j];
+            const int nbrEnd = system.neighbourOffsets[j+1];
+            neighbourDistances.resize(nbrEnd - nbrBegin);
+            for (int idx = nbrBegin; idx < nbrEnd; ++idx) {
+                neighbourDistances[idx - nbrBegin] = getDistance(pos, j, system.neighbourIndices[idx]);
+            }
 
-                // Find distance vectors
-                vector<double> r_ji{ positions[j][0] - positions[i][0],
-                                    positions[j][1] - positions[i][1],
-                                    positions[j][2] - positions[i][2]};
-                vector<double> r_ik{ positions[i][0] - positions[k][0],
-                                    positions[i][1] - positions[k][1],
-                                    positions[i][2] - positions[k][2]};
-                vector<double> r_jk{ positions[j][0] - positions[k][0],
-                                    positions[j][1] - positions[k][1],
-                                    positions[j][2] - positions[k][2]};
-                
-                // Distances
-                double d_ji = distances[j][i];
-                double d_ik = distances[i][k];
-                double d_jk = distances[j][k];
-                
-                // Calculate geometry value and its derivatives.
-                // "angle" is not supported because it is not differentiable.
-                double geom;
-                vector<vector<double>> geom_d(3);
-                if (geomFunc == "cosine") {
-                    // geom = k3GeomCosine(i, j, k, distances);
-                    
-                    double num = d_ji*d_ji + d_jk*d_jk - d_ik*d_ik;  // Numerator
-                    double den = d_jk*d_ji;                          // Denumerator
-                    
-                    double cosine = 0.5*num/den;
-                    geom = std::max(-1.0, std::min(cosine, 1.0));
-                    
-                    if (return_derivatives) {
-                        for (int dim = 0; dim < 3; ++dim) {
-                            double num_d_i = 2.0*(-r_ji[dim] - r_ik[dim]);
-                            double num_d_j = 2.0*( r_ji[dim] + r_jk[dim]);
-                            double num_d_k = 2.0*(-r_jk[dim] + r_ik[dim]);
-
-                            double den_d_i = -d_jk/d_ji*r_ji[dim];
-                            double den_d_j =  d_ji/d_jk*r_jk[dim] + d_jk/d_ji*r_ji[dim];
-                            double den_d_k = -d_ji/d_jk*r_jk[dim];
-                            
-                            geom_d[0].push_back(0.5*(num_d_i*den - num*den_d_i)/(den*den));
-                            geom_d[1].push_back(0.5*(num_d_j*den - num*den_d_j)/(den*den));
-                            geom_d[2].push_back(0.5*(num_d_k*den - num*den_d_k)/(den*den));
-                        }
-                    }
-                } else if (geomFunc == "angle") {
-                    geom = k3GeomAngle(i, j, k, distances);
-                    if (return_derivatives) {
-                        throw invalid_argument("Derivatives not implemented for geometry function 'angle'.");
-                    }
-                } else {
-                    throw invalid_argument("Invalid geometry function.");
+            // Both end atoms i and k are neighbours of j. The neighbour lists
+            // do not contain the atom itself, so j differs from i and k.
+            for (int i_idx = nbrBegin; i_idx < nbrEnd; ++i_idx) {
+                const int i = system.neighbourIndices[i_idx];
+                const double d_ji = neighbourDistances[i_idx - nbrBegin];
+                if (d_ji > functions.cutoff) {
+                    continue;
                 }
-
-                // Calculate weight value and its derivatives.
-                double weight;
-                vector<vector<double>> weight_d(3); // Weight derivatives divided by weight!
-                if (weightFunc == "exp") {
-                    double scale = parameters.at("scale");
-                    double threshold = parameters.at("threshold");
-                    weight = k3WeightExponential(i, j, k, distances, scale);
-                    if (weight < threshold) {
+                for (int k_idx = nbrBegin; k_idx < nbrEnd; ++k_idx) {
+                    const int k = system.neighbourIndices[k_idx];
+                    // The angles are symmetric: ijk = kji. The value is
+                    // calculated only for the triplet where k > i.
+                    if (k <= i) {
                         continue;
                     }
-                    if (return_derivatives) {
-                        for (int dim = 0; dim < 3; ++dim) {
-                            weight_d[0].push_back(scale*( r_ji[dim]/d_ji - r_ik[dim]/d_ik));
-                            weight_d[1].push_back(scale*(-r_ji[dim]/d_ji - r_jk[dim]/d_jk));
-                            weight_d[2].push_back(scale*( r_jk[dim]/d_jk + r_ik[dim]/d_ik));
-                        }
-                    }
-                } else if (weightFunc == "unity") {
-                    weight = k3WeightUnity(i, j, k, distances);
-                    if (return_derivatives) {
-                        weight_d[0] = vector<double>(3,0.0);
-                        weight_d[1] = vector<double>(3,0.0);
-                        weight_d[2] = vector<double>(3,0.0);
+                    // Only consider triplets that have one atom in the
+                    // original cell
+                    if (i >= nOriginal && j >= nOriginal && k >= nOriginal)  {
+                        continue;
                     }
-                } else if (weightFunc == "smooth_cutoff") {
-                    double y = parameters.at("sharpness");
-                    double cutoff = parameters.at("cutoff");
-                    if (d_ji > cutoff || d_jk > cutoff){
+                    const double d_jk = neighbourDistances[k_idx - nbrBegin];
+                    if (d_jk > functions.cutoff) {
                         continue;
                     }
-                    //weight = k3WeightSmooth(i, j, k, distances, y, cutoff);
-                    double frac_ij = d_ji/cutoff;
-                    double frac_jk = d_jk/cutoff;
-                    double pow1_ij = pow(frac_ij, y+1);
-                    double pow2_ij = pow(frac_ij, y);
-                    double pow1_jk = pow(frac_jk, y+1);
-                    double pow2_jk = pow(frac_jk, y);
-                    double f_ij = 1 + y*pow1_ij - (y+1)*pow2_ij;
-                    double f_jk = 1 + y*pow1_jk - (y+1)*pow2_jk;
-                    weight = f_ij*f_jk;
-
-                    double c1 = y*(y+1)/(d_ji*d_ji)*(pow1_ij-pow2_ij)/f_ij;
-                    double c2 = y*(y+1)/(d_jk*d_jk)*(pow1_jk-pow2_jk)/f_jk;
-                    for(int dim=0; dim<3; ++dim){
-                        weight_d[0].push_back(-c1*r_ji[dim]);
-                        weight_d[1].push_back( c2*r_jk[dim] + c1*r_ji[dim]);
-                        weight_d[2].push_back(-c2*r_jk[dim]);
+                    const double d_ik = getDistance(pos, i, k);
+                    const double perimeter = d_ji + d_jk + d_ik;
+                    if (perimeter > functions.maxPerimeter) {
+                        continue;
                     }
-                } else {
-                    throw invalid_argument("Invalid weighting function.");
-                }
-
-                // The contributions are weighted by their multiplicity arising from
-                // the translational symmetry. Each triple of atoms is repeated N
-                // times in the extended system through translational symmetry. The
-                // weight for the angles is thus divided by N so that the
-                // multiplication from symmetry is countered. This makes the final
-                // spectrum invariant to the selected supercell size and shape
-                // after normalization. The number of repetitions N is given by how
-                // many unique cell indices (the index of the repeated cell with
-                // respect to the original cell at index [0, 0, 0]) are present for
-                // the atoms in the triple.
-                vector<int> i_copy = this->cellIndices[i];
-                vector<int> j_copy = this->cellIndices[j];
-                vector<int> k_copy = this->cellIndices[k];
-                bool ij_diff = i_copy != j_copy;
-                bool ik_diff = i_copy != k_copy;
-                bool jk_diff = j_copy != k_copy;
-                int diff_sum = (int)ij_diff + (int)ik_diff + (int)jk_diff;
-                int derivative_correction = 1;
-                if (diff_sum > 1) {
-                    weight /= diff_sum;
-                    derivative_correction = diff_sum;
-                }
 
-                // Calculate gaussian
-                vector<double> gauss = gaussian(geom, weight, start, dx, sigmasqrt2, n);
-
-                // Get the index of the present elements in the final vector
-                int i_elem = Z[i];
-                int j_elem = Z[j];
-                int k_elem = Z[k];
-                int i_index = this->atomicNumberToIndexMap.at(i_elem);
-                int j_index = this->atomicNumberToIndexMap.at(j_elem);
-                int k_index = this->atomicNumberToIndexMap.at(k_elem);
-
-                // Save information in the part where k_index >= i_index
-                if (k_index < i_index) {
-                    int temp = k_index;
-                    k_index = i_index;
-                    i_index = temp;
-                }
+                    // Find distance vectors
+                    double r_ji[3] = {pos[3*j] - pos[3*i], pos[3*j+1] - pos[3*i+1], pos[3*j+2] - pos[3*i+2]};
+                    double r_ik[3] = {pos[3*i] - pos[3*k], pos[3*i+1] - pos[3*k+1], pos[3*i+2] - pos[3*k+2]};
+                    double r_jk[3] = {pos[3*j] - pos[3*k], pos[3*j+1] - pos[3*k+1], pos[3*j+2] - pos[3*k+2]};
+
+                    // Calculate the geometry and weight values and their
+                    // derivatives
+                    double geom, weight;
+                    double geom_d[3][3];
+                    double weight_d[3][3];
+                    getK3Values(functions, r_ji, r_ik, r_jk, d_ji, d_ik, d_jk, return_derivatives, geom, geom_d, weight, weight_d);
+
+                    // The contributions are weighted by their multiplicity arising from
+                    // the translational symmetry. Each triple of atoms is repeated N
+                    // times in the extended system through translational symmetry. The
+                    // weight for the angles is thus divided by N so that the
+                    // multiplication from symmetry is countered. This makes the final
+                    // spectrum invariant to the selected supercell size and shape
+                    // after normalization. The number of repetitions N is given by how
+                    // many unique cell indices (the index of the repeated cell with
+                    // respect to the original cell at index [0, 0, 0]) are present for
+                    // the atoms in the triple.
+                    bool ij_diff = system.cells[i] != system.cells[j];
+                    bool ik_diff = system.cells[i] != system.cells[k];
+                    bool jk_diff = system.cells[j] != system.cells[k];
+                    int diff_sum = (int)ij_diff + (int)ik_diff + (int)jk_diff;
+                    int derivative_correction = 1;
+                    if (diff_sum > 1) {
+                        weight /= diff_sum;
+                        derivative_correction = diff_sum;
+                    }
 
-                // This is the index of the spectrum. It is given by enumerating the
-                // elements of a three-dimensional array where for valid elements
-                // k>=i. The enumeration begins from [0, 0, 0], and ends at [n_elem,
-                // n_elem, n_elem], looping the elements in the order j, i, k.
-                int m = int(j_index * nElem * (nElem + 1) / 2 + k_index + i_index * nElem - i_index * (i_index + 1) / 2);
-                int begin = m * n;
-                int end = (m + 1) * n;
+                    // Get the index of the present elements in the final
+                    // vector. Save information in the part where k_index >=
+                    // i_index.
+                    int i_index = elementIndex[i];
+                    int j_index = elementIndex[j];
+                    int k_index = elementIndex[k];
+                    if (k_index < i_index) {
+                        int temp = k_index;
+                        k_index = i_index;
+                        i_index = temp;
+                    }
 
-                if (return_descriptor) {
-                    for (int index = 0; index < n; ++index) {
-                        descriptor_mu[begin+index] += gauss[index];
+                    // This is the index of the spectrum. It is given by enumerating the
+                    // elements of a three-dimensional array where for valid elements
+                    // k>=i. The enumeration begins from [0, 0, 0], and ends at [n_elem,
+                    // n_elem, n_elem], looping the elements in the order j, i, k.
+                    int m = int(j_index * nElem * (nElem + 1) / 2 + k_index + i_index * nElem - i_index * (i_index + 1) / 2);
+                    int begin = m * n;
+
+                    if (!return_derivatives) {
+                        if (return_descriptor) {
+                            broaden(geom, weight, grid, [&](int index, double gauss) {
+                                descriptorOut[begin+index] += gauss;
+                            });
+                        }
+                        continue;
                     }
-                }
 
-                if (return_derivatives) {
-                    // Calculate x*gaussian distribution.
-                    vector<double> xgauss = xgaussian(geom, weight, start, dx, sigma, n);
-                    
-                    vector<int> atom_indices{i, j, k};
-                    for (int a = 0; a < 3; ++a) {
-                        int atom = atom_indices[a];
-                        if (atom >= this->interactionLimit) continue;
-                        for (int dim = 0; dim < 3; ++dim) {
-                            for (int index = 0; index < n; ++index) {
-                                double gauss_d = geom_d[a][dim]*(xgauss[index] - gauss[index]*geom)*pow(sigma,-2.0)
-                                                + weight_d[a][dim]*gauss[index];
-                                // Counteracting the weight halving
-                                gauss_d *= derivative_correction;
-                                derivatives_mu(atom, dim, begin+index) += gauss_d;
+                    // The correction counteracts the weight division
+                    const int atom_indices[3] = {i, j, k};
+                    broadenWithSlope(geom, weight, grid, [&](int index, double gauss, double slope) {
+                        if (return_descriptor) {
+                            descriptorOut[begin+index] += gauss;
+                        }
+                        for (int a = 0; a < 3; ++a) {
+                            int atom = atom_indices[a];
+                            if (atom >= nOriginal) continue;
+                            double* atomOut = derivativesOut + (size_t)atom*3*nFeatures + begin + index;
+                            for (int dim = 0; dim < 3; ++dim) {
+                                double gauss_d = geom_d[a][dim]*slope + weight_d[a][dim]*gauss;
+                                atomOut[dim*nFeatures] += derivative_correction*gauss_d;
                             }
                         }
-                    }
+                    });
                 }
             }
         }
+    });
+
+    // Sum the partial results of the other chunks to the output
+    double* descriptorOut = descriptor.mutable_data();
+    double* derivativesOut = derivatives.mutable_data();
+    for (int i_chunk = 1; i_chunk < nChunks; ++i_chunk) {
+        const vector<double> &descriptorPart = descriptorParts[i_chunk];
+        for (size_t q = 0; q < descriptorPart.size(); ++q) {
+            descriptorOut[q] += descriptorPart[q];
+        }
+        const vector<double> &derivativesPart = derivativesParts[i_chunk];
+        for (size_t q = 0; q < derivativesPart.size(); ++q) {
+            derivativesOut[q] += derivativesPart[q];
+        }
     }
 }
 
-inline vector<double> MBTR::gaussian(double center, double weight, double start, double dx, double sigmasqrt2, int n) {
-
-    // We first calculate the cumulative distibution function for a normal
-    // distribution.
-    vector<double> cdf(n+1);
-    double x = start;
-    for (auto &it : cdf) {
-        it = weight*1.0/2.0*(1.0 + erf((x-center)/sigmasqrt2));
-        x += dx;
-    }
-
-    // The normal distribution is calculated as a derivative of the cumulative
-    // distribution, as with coarse discretization this methods preserves the
-    // norm better.
-    vector<double> pdf(n);
-    int i = 0;
-    for (auto &it : pdf) {
-        it = (cdf[i+1]-cdf[i])/dx;
-        ++i;
-    }
-
-    return pdf;
-}
-
-inline vector<double> MBTR::xgaussian(double center, double weight, double start, double dx, double sigma, int n) {
-
-    double sigmasqrt2 = sigma*sqrt(2.0);
-    double c1 = center*weight*1.0/2.0;
-    double c2 = weight*sigma/sqrt(2.0*PI);
-    double c3 = 2.0*sigma*sigma;
-    
-    // We first calculate the cumulative distibution function for
-    // x*gaussian distribution
-    // The first term is almost identical cdf of gaussian distribution,
-    // and calculating the two together would be faster.
-    vector<double> cdf(n+1);
-    double x = start;
-    for (auto &it : cdf) {
-        it = c1*(1.0 + erf((x-center)/sigmasqrt2)) - c2*(exp(-pow((x-center),2.0)/c3) - 1.0);
-        x += dx;
-    }
-
-    // The normal distribution is calculated as a derivative of the cumulative
-    // distribution, as with coarse discretization this methods preserves the
-    // norm better.
-    vector<double> pdf(n);
-    int i = 0;
-    for (auto &it : pdf) {
-        it = (cdf[i+1]-cdf[i])/dx;
-        ++i;
-    }
-
-    return pdf;
-}
-
-inline double MBTR::k1GeomAtomicNumber(const int &i, const vector<int> &Z)
-{
-    int atomicNumber = Z[i];
-    return atomicNumber;
-}
-
-inline double MBTR::k1WeightUnity(const int &i)
-{
-    return 1;
-}
-
-inline double MBTR::k2GeomInverseDistance(const int &i, const int &j, const vector<vector<double> > &distances)
-{
-    double dist = k2GeomDistance(i, j, distances);
-    double invDist = 1/dist;
-    return invDist;
-}
-
-inline double MBTR::k2GeomDistance(const int &i, const int &j, const vector<vector<double> > &distances)
-{
-    double dist = distances[i][j];
-    return dist;
-}
-
-inline double MBTR::k2WeightUnity(const int &i, const int &j, const vector<vector<double> > &distances)
-{
-    return 1;
-}
-
-inline double MBTR::k2WeightExponential(const int &i, const int &j, const vector<vector<double> > &distances, double scale)
-{
-    double dist = distances[i][j];
-    double expValue = exp(-scale*dist);
-    return expValue;
-}
-
-inline double MBTR::k2WeightSquare(const int &i, const int &j, const vector<vector<double> > &distances)
-{
-    double dist = distances[i][j];
-    double value = 1/(dist*dist);
-    return value;
-}
-
-inline double MBTR::k3GeomCosine(const int &i, const int &j, const int &k, const vector<vector<double> > &distances)
-{
-    double r_ji = distances[j][i];
-    double r_ik = distances[i][k];
-    double r_jk = distances[j][k];
-    double r_ji_square = r_ji*r_ji;
-    double r_ik_square = r_ik*r_ik;
-    double r_jk_square = r_jk*r_jk;
-    double cosine = 0.5/(r_jk*r_ji) * (r_ji_square+r_jk_square-r_ik_square);
-
-    // Due to numerical reasons the cosine might be slightly under -1 or
-    // above 1 degrees. E.g. acos is not defined then so we clip the values
-    // to prevent NaN:s
-    cosine = max(-1.0, min(cosine, 1.0));
-
-    return cosine;
-}
-
-inline double MBTR::k3GeomAngle(const int &i, const int &j, const int &k, const vector<vector<double> > &distances)
-{
-    double cosine = this->k3GeomCosine(i, j, k, distances);
-    double angle = acos(cosine)*180.0/PI;
-
-    return angle;
-}
-
-inline double MBTR::k3WeightExponential(const int &i, const int &j, const int &k, const vector<vector<double> > &distances, double scale)
-{
-    double dist1 = distances[i][j];
-    double dist2 = distances[j][k];
-    double dist3 = distances[k][i];
-    double distTotal = dist1 + dist2 + dist3;
-    double expValue = exp(-scale*distTotal);
-
-    return expValue;
-}
-
-inline double MBTR::k3WeightSmooth(const int &i, const int &j, const int &k, const vector<vector<double> > &distances, double sharpness, double cutoff)
-{
-    double dist1 = distances[i][j];
-    double dist2 = distances[j][k];
-    double f_ij = 1 + sharpness* pow((dist1/cutoff), (sharpness+1)) - (sharpness+1)* pow((dist1/cutoff), sharpness);
-    double f_jk = 1 + sharpness* pow((dist2/cutoff), (sharpness+1)) - (sharpness+1)* pow((dist2/cutoff), sharpness);
-
-    return f_ij*f_jk;
-}
-
-inline double MBTR::k3WeightUnity(const int &i, const int &j, const int &k, const vector<vector<double> > &distances)
-{
-    return 1;
-}
-
-vector<map<string, vector<double>>> MBTR::getK2Local(const vector<int> &indices, const vector<int> &Z, const vector<vector<double> > &distances, const vector<vector<int> > &neighbours, const string &geomFunc, const string &weightFunc, const map<string, double> &parameters, double min, double max, double sigma, int n)
+void MBTR::getK2Local(py::array_t<double> &descriptor, py::array_t<double> &derivatives, bool return_descriptor, bool return_derivatives, py::array_t<double> &positions, py::array_t<int> &atomic_numbers, py::array_t<double> &cell, py::array_t<bool> &pbc, py::array_t<double> &centers, py::array_t<int> &center_indices, py::array_t<int> &indices, double radialCutoff, const string &geomFunc, const string &weightFunc, const map<string, double> &parameters, double min, double max, double sigma, int n)
 {
-    // Initialize some variables outside the loop
-    int nPos = indices.size();
-    vector<map<string, vector<double> > > k2Maps(nPos);
-    double dx = (max-min)/(n-1);
-    double sigmasqrt2 = sigma*sqrt(2.0);
-    double start = min-dx/2;
-
-    // We loop over the specified indices
-    for (int i = 0; i < nPos; ++i) {
-        int iTrue = indices[i];
-        map<string, vector<double> > k2Map;
-
-        // For each atom we loop only over the neighbours
-        const vector<int> &i_neighbours = neighbours[i];
-        for (const int &j : i_neighbours) {
-
-            // Self-distances are not considered
-            if (iTrue == j) {
-                continue;
-            }
-
-            // Calculate geometry value
-            double geom;
-            if (geomFunc == "inverse_distance") {
-                geom = k2GeomInverseDistance(i, j, distances);
-            } else if (geomFunc == "distance") {
-                geom = k2GeomDistance(i, j, distances);
-            } else {
-                throw invalid_argument("Invalid geometry function.");
-            }
-
-            // Calculate weight value
-            double weight;
-            if (weightFunc == "exp") {
-                double scale = parameters.at("scale");
-                double threshold = parameters.at("threshold");
-                weight = k2WeightExponential(i, j, distances, scale);
-                if (weight < threshold) {
+    const K2Functions functions = parseK2Functions(geomFunc, weightFunc, parameters);
+
+    // The cell list is created while holding the GIL, since it uses numpy
+    // arrays.
+    const unique_ptr<CellList> cellList = getLocalCellList(positions, cell, pbc, radialCutoff);
+    GILRelease release;
+    ScopedTimer timer("MBTR", "k2_local");
+
+    auto positions_u = positions.unchecked<2>();
+    auto atomic_numbers_u = atomic_numbers.unchecked<1>();
+    auto centers_u = centers.unchecked<2>();
+    auto center_indices_u = center_indices.unchecked<1>();
+    const int nAtoms = atomic_numbers_u.shape(0);
+    const int nCenters = centers_u.shape(0);
+    Profiler::add_count("MBTR", "centers", nCenters);
+    const size_t nIndices = indices.shape(0);
+    const int nFeatures = this->atomicNumberToIndexMap.size()*n;
+    const Grid grid(min, max, sigma, n);
+    const vector<int> slots = getIndexSlots(indices, nAtoms);
+    const vector<pair<int, int>> duplicates = getDuplicateSlots(indices, slots);
+    vector<int> elementIndex(nAtoms);
+    for (int i = 0; i < nAtoms; ++i) {
+        elementIndex[i] = this->atomicNumberToIndexMap.at(atomic_numbers_u(i));
+    }
+    double* descriptorOut = descriptor.mutable_data();
+    double* derivativesOut = derivatives.mutable_data();
+
+    // Each center only writes to its own rows of the output, so the centers
+    // are processed by the native threads without any reduction.
+    parallel_for(nCenters, [&](int cBegin, int cEnd, int) {
+        CellListNeighbours found;
+        LocalNeighbours neighbours;
+        for (int c = cBegin; c < cEnd; ++c) {
+            const double center[3] = {centers_u(c, 0), centers_u(c, 1), centers_u(c, 2)};
+            const int centerIndex = center_indices_u(c);
+            const int centerSlot = centerIndex >= 0 ? slots[centerIndex] : -1;
+            getLocalNeighbours(cellList.get(), positions_u, center, centerIndex, found, neighbours);
+            double* row = descriptorOut + (size_t)c*nFeatures;
+            double* rowDerivatives = derivativesOut + (size_t)c*nIndices*3*nFeatures;
+
+            for (size_t q = 0; q < neighbours.indices.size(); ++q) {
+                const int atom = neighbours.indices[q];
+
+                // The exponential weighting may skip the pair
+                double geom, geom_d, weight, weight_d;
+                if (!getK2Values(functions, neighbours.distances[q], geom, geom_d, weight, weight_d)) {
                     continue;
                 }
-            } else if (weightFunc == "unity") {
-                weight = k2WeightUnity(i, j, distances);
-            } else {
-                throw invalid_argument("Invalid weighting function.");
-            }
 
-            // Calculate gaussian
-            vector<double> gauss = gaussian(geom, weight, start, dx, sigmasqrt2, n);
+                // The center is always the element X with index zero, so the
+                // pair is identified by the element of the neighbour.
+                const int begin = elementIndex[atom]*n;
 
-            // Get the index of the present elements in the final vector
-            int i_elem = 0;
-            int j_elem = Z[j];
-            int i_index = this->atomicNumberToIndexMap.at(i_elem);
-            int j_index = this->atomicNumberToIndexMap.at(j_elem);
+                if (!return_derivatives) {
+                    if (return_descriptor) {
+                        broaden(geom, weight, grid, [&](int index, double gauss) {
+                            row[begin+index] += gauss;
+                        });
+                    }
+                    continue;
+                }
 
-            // Save information in the part where j_index >= i_index
-            if (j_index < i_index) {
-                int temp = j_index;
-                j_index = i_index;
-                i_index = temp;
+                // The derivatives with respect to the neighbour and the
+                // center are antisymmetric. The center only moves if it is
+                // attached to an atom.
+                const double* dist_vec = &neighbours.vectors[3*q];
+                const int atomSlot = slots[atom];
+                broadenWithSlope(geom, weight, grid, [&](int index, double gauss, double slope) {
+                    if (return_descriptor) {
+                        row[begin+index] += gauss;
+                    }
+                    const double factor = geom_d*slope + weight_d*gauss;
+                    for (int dim = 0; dim < 3; ++dim) {
+                        const double gauss_d = factor*dist_vec[dim];
+                        if (atomSlot >= 0) {
+                            rowDerivatives[((size_t)atomSlot*3 + dim)*nFeatures + begin + index] += gauss_d;
+                        }
+                        if (centerSlot >= 0) {
+                            rowDerivatives[((size_t)centerSlot*3 + dim)*nFeatures + begin + index] -= gauss_d;
+                        }
+                    }
+                });
             }
-
-            // Form the key as string to enable passing it through cython
-            stringstream ss;
-            ss << i_index;
-            ss << ",";
-            ss << j_index;
-            string stringKey = ss.str();
-
-            // Sum gaussian into output
-            auto it = k2Map.find(stringKey);
-            if ( it == k2Map.end() ) {
-                k2Map[stringKey] = gauss;
-            } else {
-                vector<double> &old = it->second;
-                transform(old.begin(), old.end(), gauss.begin(), old.begin(), plus<double>());
+            if (return_derivatives) {
+                copyDuplicateSlots(duplicates, rowDerivatives, nFeatures);
             }
         }
-        k2Maps[i] = k2Map;
-    }
-
-    return k2Maps;
+    });
 }
 
-vector<map<string, vector<double>>> MBTR::getK3Local(const vector<int> &indices, const vector<int> &Z, const vector<vector<double>> &distances, const vector<vector<int>> &neighbours, const string &geomFunc, const string &weightFunc, const map<string, double> &parameters, double min, double max, double sigma, int n)
+void MBTR::getK3Local(py::array_t<double> &descriptor, py::array_t<double> &derivatives, bool return_descriptor, bool return_derivatives, py::array_t<double> &positions, py::array_t<int> &atomic_numbers, py::array_t<double> &cell, py::array_t<bool> &pbc, py::array_t<double> &centers, py::array_t<int> &center_indices, py::array_t<int> &indices, double radialCutoff, const string &geomFunc, const string &weightFunc, const map<string, double> &parameters, double min, double max, double sigma, int n)
 {
-    // Initialize some variables outside the loop
-    vector<map<string, vector<double>>> k3Maps(indices.size());
-    double dx = (max-min)/(n-1);
-    double sigmasqrt2 = sigma*sqrt(2.0);
-    double start = min-dx/2;
-    int iLoc = 0;
-
-    // We loop over the specified indices
-    for (const int &i : indices) {
-        map<string, vector<double> > k3Map;
-
-        // For each atom we loop only over the atoms triplets that are
-        // within the neighbourhood
-        const vector<int> &i_neighbours = neighbours[i];
-        for (const int &j : i_neighbours) {
-            for (const int &k : i_neighbours) {
-                // Calculate angle for all index permutations from choosing
-                // three out of nAtoms. The same atom cannot be present twice
-                // in the permutation.
-                if (j != i && k != j && k != i) {
-
-                    // Calculate geometry value
-                    double geom;
-                    if (geomFunc == "cosine") {
-                        geom = k3GeomCosine(i, j, k, distances);
-                    } else if (geomFunc == "angle") {
-                        geom = k3GeomAngle(i, j, k, distances);
-                    } else {
-                        throw invalid_argument("Invalid geometry function.");
-                    }
-
-                    // Calculate weight value
-                    double weight;
-                    if (weightFunc == "exp") {
-                        double scale = parameters.at("scale");
-                        double threshold = parameters.at("threshold");
-                        weight = k3WeightExponential(i, j, k, distances, scale);
-                        if (weight < threshold) {
-                            continue;
-                        }
-                    } else if (weightFunc == "unity") {
-                        weight = k3WeightUnity(i, j, k, distances);
-                    } else {
-                        throw invalid_argument("Invalid weighting function.");
-                    }
-
-                    // Calculate gaussian
-                    vector<double> gauss = gaussian(geom, weight, start, dx, sigmasqrt2, n);
-
-                    // Get the index of the present elements in the final vector
-                    int i_elem = 0;
-                    int j_elem = Z[j];
-                    int k_elem = Z[k];
-                    int i_index = this->atomicNumberToIndexMap.at(i_elem);
-                    int j_index = this->atomicNumberToIndexMap.at(j_elem);
-                    int k_index = this->atomicNumberToIndexMap.at(k_elem);
+    const K3Functions functions = parseK3Functions(geomFunc, weightFunc, parameters);
+    if (return_derivatives && functions.geometry == K3Geometry::Angle) {
+        throw invalid_argument("Derivatives not implemented for geometry function 'angle'.");
+    }
 
-                    // Save information in the part where k_index >= i_index
-                    if (k_index < i_index) {
-                        int temp = k_index;
-                        k_index = i_index;
-                        i_index = temp;
-                    }
+    // The cell list is created while holding the GIL, since it uses numpy
+    // arrays.
+    const unique_ptr<CellList> cellList = getLocalCellList(positions, cell, pbc, radialCutoff);
+    GILRelease release;
+    ScopedTimer timer("MBTR", "k3_local");
+
+    auto positions_u = positions.unchecked<2>();
+    auto atomic_numbers_u = atomic_numbers.unchecked<1>();
+    auto centers_u = centers.unchecked<2>();
+    auto center_indices_u = center_indices.unchecked<1>();
+    const int nAtoms = atomic_numbers_u.shape(0);
+    const int nCenters = centers_u.shape(0);
+    Profiler::add_count("MBTR", "centers", nCenters);
+    const size_t nIndices = indices.shape(0);
+    const int nElem = this->atomicNumberToIndexMap.size();
+    const int nFeatures = nElem*(3*nElem - 1)/2*n;
+    const Grid grid(min, max, sigma, n);
+    const vector<int> slots = getIndexSlots(indices, nAtoms);
+    const vector<pair<int, int>> duplicates = getDuplicateSlots(indices, slots);
+    vector<int> elementIndex(nAtoms);
+    for (int i = 0; i < nAtoms; ++i) {
+        elementIndex[i] = this->atomicNumberToIndexMap.at(atomic_numbers_u(i));
+    }
+    double* descriptorOut = descriptor.mutable_data();
+    double* derivativesOut = derivatives.mutable_data();
+
+    // Each center only writes to its own rows of the output, so the centers
+    // are processed by the native threads without any reduction.
+    parallel_for(nCenters, [&](int cBegin, int cEnd, int) {
+        CellListNeighbours found;
+        LocalNeighbours neighbours;
+        double* row = nullptr;
+        double* rowDerivatives = nullptr;
+
+        // Adds the triplet i-j-k with the middle atom j to the spectrum m.
+        // The slots tell where the derivatives with respect to i, j and k
+        // are stored.
+        auto addTriplet = [&](const double* r_ji, const double* r_ik, const double* r_jk, double d_ji, double d_ik, double d_jk, int m, const int (&atomSlots)[3]) {
+            if (!isK3Included(functions, d_ji, d_ik, d_jk)) {
+                return;
+            }
+            double geom, weight;
+            double geom_d[3][3];
+            double weight_d[3][3];
+            getK3Values(functions, r_ji, r_ik, r_jk, d_ji, d_ik, d_jk, return_derivatives, geom, geom_d, weight, weight_d);
+            const int begin = m*n;
 
-                    // Form the key as string to enable passing it through cython
-                    stringstream ss;
-                    ss << i_index;
-                    ss << ",";
-                    ss << j_index;
-                    ss << ",";
-                    ss << k_index;
-                    string stringKey = ss.str();
-
-                    // Sum gaussian into output
-                    auto it = k3Map.find(stringKey);
-                    if ( it == k3Map.end() ) {
-                        k3Map[stringKey] = gauss;
-                    } else {
-                        vector<double> &old = it->second;
-                        transform(old.begin(), old.end(), gauss.begin(), old.begin(), plus<double>());
+            if (!return_derivatives) {
+                if (return_descriptor) {
+                    broaden(geom, weight, grid, [&](int index, double gauss) {
+                        row[begin+index] += gauss;
+                    });
+                }
+                return;
+            }
+            broadenWithSlope(geom, weight, grid, [&](int index, double gauss, double slope) {
+                if (return_descriptor) {
+                    row[begin+index] += gauss;
+                }
+                for (int a = 0; a < 3; ++a) {
+                    if (atomSlots[a] < 0) {
+                        continue;
                     }
-
-                    // Also include the angle where the local center is in
-                    // the middle. Include it only once.
-                    if (k > j) {
-                        // Calculate geometry value
-                        double geom;
-                        if (geomFunc == "cosine") {
-                            geom = k3GeomCosine(j, i, k, distances);
-                        } else if (geomFunc == "angle") {
-                            geom = k3GeomAngle(j, i, k, distances);
-                        } else {
-                            throw invalid_argument("Invalid geometry function.");
-                        }
-
-                        // Calculate weight value
-                        double weight;
-                        if (weightFunc == "exp") {
-                            double scale = parameters.at("scale");
-                            double threshold = parameters.at("threshold");
-                            weight = k3WeightExponential(j, i, k, distances, scale);
-                            if (weight < threshold) {
-                                continue;
-                            }
-                        } else if (weightFunc == "unity") {
-                            weight = k3WeightUnity(j, i, k, distances);
-                        } else {
-                            throw invalid_argument("Invalid weighting function.");
-                        }
-
-                        // Calculate gaussian
-                        vector<double> gauss = gaussian(geom, weight, start, dx, sigmasqrt2, n);
-
-                        // Get the index of the present elements in the final vector
-                        int i_elem = 0;
-                        int j_elem = Z[j];
-                        int k_elem = Z[k];
-                        int i_index = this->atomicNumberToIndexMap.at(i_elem);
-                        int j_index = this->atomicNumberToIndexMap.at(j_elem);
-                        int k_index = this->atomicNumberToIndexMap.at(k_elem);
-
-                        // Save information in the part where k_index >= j_index
-                        if (k_index < j_index) {
-                            int temp = k_index;
-                            k_index = j_index;
-                            j_index = temp;
-                        }
-
-                        // Form the key as string to enable passing it through cython
-                        stringstream ss;
-                        ss << j_index;
-                        ss << ",";
-                        ss << i_index;
-                        ss << ",";
-                        ss << k_index;
-                        string stringKey = ss.str();
-
-                        // Sum gaussian into output
-                        auto it = k3Map.find(stringKey);
-                        if ( it == k3Map.end() ) {
-                            k3Map[stringKey] = gauss;
-                        } else {
-                            vector<double> &old = it->second;
-                            transform(old.begin(), old.end(), gauss.begin(), old.begin(), plus<double>());
-                        }
+                    double* atomOut = rowDerivatives + (size_t)atomSlots[a]*3*nFeatures + begin + index;
+                    for (int dim = 0; dim < 3; ++dim) {
+                        atomOut[dim*nFeatures] += geom_d[a][dim]*slope + weight_d[a][dim]*gauss;
                     }
                 }
+            });
+        };
+
+        for (int c = cBegin; c < cEnd; ++c) {
+            const double center[3] = {centers_u(c, 0), centers_u(c, 1), centers_u(c, 2)};
+            const int centerIndex = center_indices_u(c);
+            const int centerSlot = centerIndex >= 0 ? slots[centerIndex] : -1;
+            getLocalNeighbours(cellList.get(), positions_u, center, centerIndex, found, neighbours);
+            row = descriptorOut + (size_t)c*nFeatures;
+            rowDerivatives = derivativesOut + (size_t)c*nIndices*3*nFeatures;
+
+            // Each pair of neighbours forms three triplets with the center:
+            // two where the center is at the end and one where it is in the
+            // middle. The vectors v point from the center to the neighbours.
+            const int nNeighbours = neighbours.indices.size();
+            for (int q1 = 0; q1 < nNeighbours; ++q1) {
+                const int atom1 = neighbours.indices[q1];
+                const int e1 = elementIndex[atom1];
+                const double* v1 = &neighbours.vectors[3*q1];
+                const double d1 = neighbours.distances[q1];
+                for (int q2 = q1 + 1; q2 < nNeighbours; ++q2) {
+                    const int atom2 = neighbours.indices[q2];
+                    const int e2 = elementIndex[atom2];
+                    const double* v2 = &neighbours.vectors[3*q2];
+                    const double d2 = neighbours.distances[q2];
+                    const double v12[3] = {v1[0] - v2[0], v1[1] - v2[1], v1[2] - v2[2]};
+                    const double v21[3] = {-v12[0], -v12[1], -v12[2]};
+                    const double d12 = sqrt(v12[0]*v12[0] + v12[1]*v12[1] + v12[2]*v12[2]);
+                    const double minus_v1[3] = {-v1[0], -v1[1], -v1[2]};
+                    const double minus_v2[3] = {-v2[0], -v2[1], -v2[2]};
+
+                    // The spectra where the center is at the end come after
+                    // the ones where it is in the middle. They are enumerated
+                    // by the middle element, which is never X, and the other
+                    // end element.
+                    const int offset = nElem*(nElem + 1)/2;
+                    addTriplet(v1, minus_v2, v12, d1, d2, d12, offset + (e1 - 1)*nElem + e2, {centerSlot, slots[atom1], slots[atom2]});
+                    addTriplet(v2, minus_v1, v21, d2, d1, d12, offset + (e2 - 1)*nElem + e1, {centerSlot, slots[atom2], slots[atom1]});
+
+                    // The spectra where the center is in the middle are
+                    // enumerated like the elements of an upper triangular
+                    // matrix.
+                    const int a = std::min(e1, e2);
+                    const int b = std::max(e1, e2);
+                    addTriplet(minus_v1, v12, minus_v2, d1, d12, d2, b + a*nElem - a*(a + 1)/2, {slots[atom1], centerSlot, slots[atom2]});
+                }
+            }
+            if (return_derivatives) {
+                copyDuplicateSlots(duplicates, rowDerivatives, nFeatures);
             }
         }
-        k3Maps[iLoc] = k3Map;
-        ++iLoc;
-    }
-    return k3Maps;
+    });
 }
-
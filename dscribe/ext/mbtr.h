@@ -33,174 +33,64 @@ class MBTR {
         /**
          * Constructor
          *
-         * @param positions Atomic positions in cartesian coordinates.
-         * @param atomicNumbers Atomic numbers.
          * @param atomicNumberToIndexMap Mapping between atomic numbers and
          * their position in the final MBTR vector.
          * @param interactionLimit The number of atoms that are interacting.
          * The atoms with indices < interactionLimit are considered to be
          * interacting with other atoms.
-         * @param cellIndices 3D index of the periodically repeated cell in
-         * which each atom is in the system
-         * @param local Whether a local or a global MBTR is calculated.
          */
-        MBTR(map<int,int> atomicNumberToIndexMap, int interactionLimit,  vector<vector<int>> cellIndices);
+        MBTR(map<int,int> atomicNumberToIndexMap, int interactionLimit);
         void getK1(py::array_t<double> &descriptor, const vector<int> &Z, const string &geomFunc, const string &weightFunc, const map<string, double> &parameters, double min, double max, double sigma, int n);
-        void getK2(py::array_t<double> &descriptor, py::array_t<double> &derivatives, bool return_descriptor, bool return_derivatives, const vector<int> &Z, const vector<vector<double>> &positions, const vector<vector<double>> &distances, const vector<vector<int>> &neighbours, const string &geomFunc, const string &weightFunc, const map<string, double> &parameters, double min, double max, double sigma, int n);
-        void getK3(py::array_t<double> &descriptor, py::array_t<double> &derivatives, bool return_descriptor, bool return_derivatives, const vector<int> &Z, const vector<vector<double>> &positions, const vector<vector<double>> &distances, const vector<vector<int>> &neighbours, const string &geomFunc, const string &weightFunc, const map<string, double> &parameters, double min, double max, double sigma, int n);
-        vector<map<string, vector<double>>> getK2Local(const vector<int> &indices, const vector<int> &Z, const vector<vector<double>> &distances, const vector<vector<int>> &neighbours, const string &geomFunc, const string &weightFunc, const map<string, double> &parameters, double min, double max, double sigma, int n);
-        vector<map<string, vector<double>>> getK3Local(const vector<int> &indices, const vector<int> &Z, const vector<vector<double>> &distances, const vector<vector<int>> &neighbours, const string &geomFunc, const string &weightFunc, const map<string, double> &parameters, double min, double max, double sigma, int n);
-        vector<double> gaussian(double center, double weight, double start, double dx, double sigmasqrt2, int n);
-        vector<double> xgaussian(double center, double weight, double start, double dx, double sigma, int n);
-        
-    private:
-        const map<int,int> atomicNumberToIndexMap;
-        const int interactionLimit;
-        const vector<vector<int> > cellIndices;
-
-        /**
-         * Calculates the geometry function based on atomic numbers defined for
-         * k=1.
-         *
-         * @param i Index of first atom.
-         *
-         * @return Atomic number for the given index.
-         */
-        double k1GeomAtomicNumber(const int &i, const vector<int> &Z);
-
-        /**
-         * Weighting of 1. Usually used for finite small
-         * systems.
-         *
-         * @param i Index of first atom.
-         *
-         * @return Weight of 1.
-         */
-        double k1WeightUnity(const int &i);
-        /**
-         * Calculates the inverse distance geometry function defined for k=2.
-         *
-         * @return A map of inverse distance values for the given atomic pairs.
-         */
-        /**
-         * Calculates the distance geometry function defined for k=2.
-         *
-         * @param i Index of first atom.
-         * @param j Index of second atom.
-         * @param distances Distance matrix
-         *
-         * @return Inverse distance between atoms.
-         */
-        double k2GeomInverseDistance(const int &i, const int &j, const vector<vector<double> > &distances);
-        /**
-         * Weighting of 1 for all indices. Usually used for finite small
-         * systems.
-         *
-         * @param i Index of first atom.
-         * @param j Index of second atom.
-         * @param distances Distance matrix
-         *
-         * @return Distance between atoms.
-         */
-        double k2GeomDistance(const int &i, const int &j, const vector<vector<double> > &distances);
-        /**
-         * Weighting of 1. Usually used for finite small
-         * systems.
-         *
-         * @param i Index of first atom.
-         * @param j Index of second atom.
-         * @param distances Distance matrix
-         *
-         * @return Weight of 1.
-         */
-        double k2WeightUnity(const int &i, const int &j, const vector<vector<double> > &distances);
-        /**
-         * Weighting defined as e^(-sx), where x is the distance from
-         * A->B and s is the scaling factor.
-         *
-         * @param i Index of first atom.
-         * @param j Index of second atom.
-         * @param distances Distance matrix
-         * @param scale The prefactor in the exponential weighting.
-         *
-         * @return The exponential weight.
-         */
-        double k2WeightExponential(const int &i, const int &j, const vector<vector<double> > &distances, double scale);
-        /**
-         * Weighting defined as 1/(x^2), where x is the distance from
-         * A->B.
-         *
-         * @param i Index of first atom.
-         * @param j Index of second atom.
-         * @param distances Distance matrix.
-         *
-         * @return The inverse of distance squared as weight.
-         */
-        double k2WeightSquare(const int &i, const int &j, const vector<vector<double> > &distances);
-        /**
-         * Calculates the cosine geometry function defined for k3.
-         *
-         * @param i Index of first atom.
-         * @param j Index of second atom.
-         * @param k Index of third atom.
-         * @param distances Distance matrix
-         *
-         * @return The cosine value for the angle defined between the given
-         * three atomic indices.
-         */
-        double k3GeomCosine(const int &i, const int &j, const int &k, const vector<vector<double>> &distances);
         /**
-         * Calculates the angle (degrees) geometry function defined for k3.
-         *
-         * @param i Index of first atom.
-         * @param j Index of second atom.
-         * @param k Index of third atom.
-         * @param distances Distance matrix
-         *
-         * @return The angle defined between the given three atomic indices.
-         * Between 0 and 180 degrees.
+         * Calculates the k=2 term and/or its derivatives. The periodic copies
+         * and the neighbour lists are created with cell lists, so only the
+         * pairs within the radial cutoff are visited.
+         *
+         * @param positions Atomic positions of the original system.
+         * @param atomic_numbers Atomic numbers of the original system.
+         * @param cell Unit cell of the original system.
+         * @param pbc Periodic boundary conditions of the original system.
+         * @param radialCutoff Radial cutoff for the pairs. A non-positive
+         * value means that all pairs are included, which is only possible
+         * for finite systems.
          */
-        double k3GeomAngle(const int &i, const int &j, const int &k, const vector<vector<double>> &distances);
+        void getK2(py::array_t<double> &descriptor, py::array_t<double> &derivatives, bool return_descriptor, bool return_derivatives, py::array_t<double> &positions, py::array_t<int> &atomic_numbers, py::array_t<double> &cell, py::array_t<bool> &pbc, double radialCutoff, const string &geomFunc, const string &weightFunc, const map<string, double> &parameters, double min, double max, double sigma, int n);
         /**
-         * Weighting of 1. Usually used for finite small
-         * systems.
-         *
-         * @param i Index of first atom.
-         * @param j Index of second atom.
-         * @param k Index of third atom.
-         * @param distances Distance matrix
-         *
-         * @return Weight of 1.
+         * Calculates the k=3 term and/or its derivatives. The arguments are
+         * the same as for getK2, and the triplets are formed from atoms that
+         * are within the radial cutoff from the middle atom.
          */
-        double k3WeightUnity(const int &i, const int &j, const int &k, const vector<vector<double>> &distances);
+        void getK3(py::array_t<double> &descriptor, py::array_t<double> &derivatives, bool return_descriptor, bool return_derivatives, py::array_t<double> &positions, py::array_t<int> &atomic_numbers, py::array_t<double> &cell, py::array_t<bool> &pbc, double radialCutoff, const string &geomFunc, const string &weightFunc, const map<string, double> &parameters, double min, double max, double sigma, int n);
         /**
-         * Weighting defined as e^(-sx), where x is the distance from
-         * A->B->C->A and s is the scaling factor.
-         *
-         * @param i Index of first atom.
-         * @param j Index of second atom.
-         * @param k Index of third atom.
-         * @param distances Distance matrix
-         * @param scale The prefactor in the exponential weighting.
-         *
-         * @return Exponential weight.
+         * Calculates the local k=2 term and/or its derivatives for the given
+         * centers. The center is the element X, and it is paired with every
+         * atom within the radial cutoff. Each center fills its own row of the
+         * descriptor, which has the shape (n_centers, n_features), and its
+         * own block of the derivatives, which have the shape (n_centers,
+         * n_indices, 3, n_features).
+         *
+         * @param centers Cartesian positions of the centers.
+         * @param center_indices Index of the atom that each center is
+         * attached to, or -1. The attached atom is not paired with its own
+         * center, and the derivatives with respect to it include the motion
+         * of the center.
+         * @param indices Indices of the atoms for which the derivatives are
+         * calculated.
+         * @param radialCutoff Radial cutoff around the centers. A
+         * non-positive value means that all atoms are included, which is
+         * only possible for finite systems.
          */
-        double k3WeightExponential(const int &i, const int &j, const int &k, const vector<vector<double>> &distances, double scale);
+        void getK2Local(py::array_t<double> &descriptor, py::array_t<double> &derivatives, bool return_descriptor, bool return_derivatives, py::array_t<double> &positions, py::array_t<int> &atomic_numbers, py::array_t<double> &cell, py::array_t<bool> &pbc, py::array_t<double> &centers, py::array_t<int> &center_indices, py::array_t<int> &indices, double radialCutoff, const string &geomFunc, const string &weightFunc, const map<string, double> &parameters, double min, double max, double sigma, int n);
         /**
-         * Weighting defined by smooth cutoff function f(r) = 1 + y * (r/R)^(y+1)
-         * - (y+1) * (r/R)^y, where r is the distance between atoms, y is
-         * sharpness and R is the cutoff distance.
-         *
-         * @param i Index of first atom.
-         * @param j Index of second atom.
-         * @param k Index of third atom.
-         * @param distances Distance matrix.
-         * @param sharpness Sharpness of the function.
-         * @param cutoff Cutoff distance of the weighting.
-         *
-         * @return Weight defined by smooth cutoff function.
+         * Calculates the local k=3 term and/or its derivatives. The arguments
+         * are the same as for getK2Local, and the triplets are formed from
+         * the center and two atoms within the radial cutoff from it.
          */
-        double k3WeightSmooth(const int &i, const int &j, const int &k, const vector<vector<double> > &distances, double sharpness, double cutoff);
+        void getK3Local(py::array_t<double> &descriptor, py::array_t<double> &derivatives, bool return_descriptor, bool return_derivatives, py::array_t<double> &positions, py::array_t<int> &atomic_numbers, py::array_t<double> &cell, py::array_t<bool> &pbc, py::array_t<double> &centers, py::array_t<int> &center_indices, py::array_t<int> &indices, double radialCutoff, const string &geomFunc, const string &weightFunc, const map<string, double> &parameters, double min, double max, double sigma, int n);
+
+    private:
+        const map<int,int> atomicNumberToIndexMap;
+        const int interactionLimit;
 };
 
-#endif
\ No newline at end of file
+#endif
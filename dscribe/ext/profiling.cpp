@@ -0,0 +1,93 @@
+/*Copyright 2019 DScribe developers
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include "profiling.h"
+#include <map>
+#include <mutex>
+#include <string>
+
+using namespace std;
+
+namespace {
+
+struct PhaseStats {
+    double seconds = 0;
+    long long calls = 0;
+};
+
+struct DescriptorStats {
+    map<string, PhaseStats> phases;
+    map<string, long long> counters;
+};
+
+// The statistics of all descriptor classes. Only touched while holding the
+// mutex, which the timers take once when they are destroyed.
+mutex stats_mutex;
+map<string, DescriptorStats> stats;
+
+}
+
+atomic<bool> Profiler::active(false);
+
+void Profiler::set_enabled(bool enabled)
+{
+    Profiler::active.store(enabled, memory_order_relaxed);
+}
+
+void Profiler::add_time(const char* descriptor, const char* phase, double seconds, long long calls)
+{
+    lock_guard<mutex> lock(stats_mutex);
+    PhaseStats &phase_stats = stats[descriptor].phases[phase];
+    phase_stats.seconds += seconds;
+    phase_stats.calls += calls;
+}
+
+void Profiler::add_count(const char* descriptor, const char* counter, long long value)
+{
+    if (!Profiler::enabled()) {
+        return;
+    }
+    lock_guard<mutex> lock(stats_mutex);
+    stats[descriptor].counters[counter] += value;
+}
+
+py::dict Profiler::get_stats()
+{
+    lock_guard<mutex> lock(stats_mutex);
+    py::dict result;
+    for (const auto &descriptor : stats) {
+        py::dict phases;
+        for (const auto &phase : descriptor.second.phases) {
+            py::dict phase_stats;
+            phase_stats["time"] = phase.second.seconds;
+            phase_stats["calls"] = phase.second.calls;
+            phases[py::str(phase.first)] = phase_stats;
+        }
+        py::dict counters;
+        for (const auto &counter : descriptor.second.counters) {
+            counters[py::str(counter.first)] = counter.second;
+        }
+        py::dict descriptor_stats;
+        descriptor_stats["phases"] = phases;
+        descriptor_stats["counters"] = counters;
+        result[py::str(descriptor.first)] = descriptor_stats;
+    }
+    return result;
+}
+
+void Profiler::reset()
+{
+    lock_guard<mutex> lock(stats_mutex);
+    stats.clear();
+}
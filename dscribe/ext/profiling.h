@@ -0,0 +1,163 @@
+/*Copyright 2019 DScribe developers
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef PROFILING_H
+#define PROFILING_H
+
+#include <pybind11/pybind11.h>
+#include <atomic>
+#include <chrono>
+
+namespace py = pybind11;
+using namespace std;
+
+/**
+ * Opt-in instrumentation of the native kernels. When enabled, the time spent
+ * in each phase of a calculation and counters such as the number of
+ * neighbours are collected for each descriptor class. The statistics are
+ * aggregated over all calls and threads until they are reset. When disabled,
+ * the instrumentation only costs a check of a flag.
+ */
+class Profiler {
+    public:
+        /**
+         * Returns whether the statistics are collected.
+         */
+        static bool enabled() {return Profiler::active.load(memory_order_relaxed);};
+
+        /**
+         * Starts or stops collecting the statistics. The collected
+         * statistics are kept until reset is called.
+         */
+        static void set_enabled(bool enabled);
+
+        /**
+         * Adds the given time in seconds and number of calls to a phase.
+         */
+        static void add_time(const char* descriptor, const char* phase, double seconds, long long calls=1);
+
+        /**
+         * Adds the given value to a counter.
+         */
+        static void add_count(const char* descriptor, const char* counter, long long value);
+
+        /**
+         * Returns the statistics as a dictionary that maps the descriptor
+         * classes to their "phases" and "counters". Each phase has the total
+         * "time" in seconds and the number of "calls". Needs the GIL.
+         */
+        static py::dict get_stats();
+
+        /**
+         * Clears the collected statistics.
+         */
+        static void reset();
+
+    private:
+        static atomic<bool> active;
+};
+
+/**
+ * Accumulates the time of a phase over several start and stop calls, and
+ * adds it to the profiler when destroyed. Can be used in the hot loops of a
+ * thread without synchronization. Whether the time is measured is decided
+ * when the timer is created.
+ */
+class PhaseTimer {
+    public:
+        PhaseTimer(const char* descriptor, const char* phase)
+            : descriptor(descriptor)
+            , phase(phase)
+            , active(Profiler::enabled())
+        {
+        };
+        PhaseTimer(const PhaseTimer&) = delete;
+        PhaseTimer& operator=(const PhaseTimer&) = delete;
+        ~PhaseTimer()
+        {
+            if (this->active && this->calls > 0) {
+                Profiler::add_time(this->descriptor, this->phase, this->seconds, this->calls);
+            }
+        };
+        void start()
+        {
+            if (this->active) {
+                this->begin = chrono::steady_clock::now();
+            }
+        };
+        void stop()
+        {
+            if (this->active) {
+                this->seconds += chrono::duration<double>(chrono::steady_clock::now() - this->begin).count();
+                ++this->calls;
+            }
+        };
+
+    private:
+        const char* descriptor;
+        const char* phase;
+        const bool active;
+        double seconds = 0;
+        long long calls = 0;
+        chrono::steady_clock::time_point begin;
+};
+
+/**
+ * Measures the enclosing scope as one call of a phase.
+ */
+class ScopedTimer {
+    public:
+        ScopedTimer(const char* descriptor, const char* phase)
+            : timer(descriptor, phase)
+        {
+            this->timer.start();
+        };
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+        ~ScopedTimer() {this->timer.stop();};
+
+    private:
+        PhaseTimer timer;
+};
+
+/**
+ * Accumulates a counter locally and adds it to the profiler when destroyed.
+ */
+class PhaseCounter {
+    public:
+        PhaseCounter(const char* descriptor, const char* counter)
+            : descriptor(descriptor)
+            , counter(counter)
+            , active(Profiler::enabled())
+        {
+        };
+        PhaseCounter(const PhaseCounter&) = delete;
+        PhaseCounter& operator=(const PhaseCounter&) = delete;
+        ~PhaseCounter()
+        {
+            if (this->active && this->value != 0) {
+                Profiler::add_count(this->descriptor, this->counter, this->value);
+            }
+        };
+        void add(long long value) {this->value += value;};
+
+    private:
+        const char* descriptor;
+        const char* counter;
+        const bool active;
+        long long value = 0;
+};
+
+#endif
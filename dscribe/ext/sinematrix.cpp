@@ -0,0 +1,71 @@
+/*Copyright 2019 DScribe developers
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include "sinematrix.h"
+#include <math.h>
+
+using namespace std;
+using namespace Eigen;
+
+SineMatrix::SineMatrix(
+    unsigned int n_atoms_max,
+    string permutation,
+    double sigma,
+    int seed
+)
+    : DescriptorMatrix(n_atoms_max, permutation, sigma, seed, false)
+{
+}
+
+void SineMatrix::create_raw(
+    py::detail::unchecked_mutable_reference<double, 1> &out_mu, 
+    py::detail::unchecked_reference<double, 2> &positions_u, 
+    py::detail::unchecked_reference<int, 1> &atomic_numbers_u,
+    py::detail::unchecked_reference<double, 2> &cell_u,
+    CellList &
+)
+{
+    int n_atoms = atomic_numbers_u.shape(0);
+    Matrix3d cell;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            cell(i, j) = cell_u(i, j);
+        }
+    }
+    const Matrix3d cell_inv = cell.inverse();
+
+    // The scaled positions multiplied by pi. The sine only depends on their
+    // differences, so the periodic images do not need to be considered.
+    MatrixXd scaled(n_atoms, 3);
+    for (int i = 0; i < n_atoms; ++i) {
+        const RowVector3d position(positions_u(i, 0), positions_u(i, 1), positions_u(i, 2));
+        scaled.row(i) = PI*position*cell_inv;
+    }
+
+    // Construct matrix. The off-diagonal elements are Zi*Zj/phi, where phi
+    // is the norm of sum_k sin^2(pi*(s_j - s_i)_k)*B_k.
+    MatrixXd matrix(n_atoms, n_atoms);
+    for (int i = 0; i < n_atoms; ++i) {
+        matrix(i, i) = 0.5 * pow(atomic_numbers_u(i), 2.4);
+        for (int j = i + 1; j < n_atoms; ++j) {
+            const RowVector3d sines = (scaled.row(j) - scaled.row(i)).array().sin().square();
+            const double phi = (sines*cell).norm();
+            const double value = atomic_numbers_u(i) * atomic_numbers_u(j) / phi;
+            matrix(i, j) = value;
+            matrix(j, i) = value;
+        }
+    }
+
+    this->set_output(matrix, out_mu);
+}
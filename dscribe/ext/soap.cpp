@@ -12,13 +12,27 @@ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 See the License for the specific language governing permissions and
 limitations under the License.
 */
+#include <algorithm>
+#include <stdexcept>
 #include "soap.h"
 #include "soapGeneral.h"
 #include "soapGTO.h"
-#include "geometry.h"
+#include "profiling.h"
 
 using namespace std;
 
+namespace {
+    /**
+     * Checks that the given output array is a float32 or float64 array.
+     */
+    void check_precision(const py::array &array, const string &name)
+    {
+        if (!py::isinstance<py::array_t<float>>(array) && !py::isinstance<py::array_t<double>>(array)) {
+            throw invalid_argument("The " + name + " must be a float32 or float64 array.");
+        }
+    }
+}
+
 SOAPGTO::SOAPGTO(
     double rcut,
     int nmax,
@@ -38,12 +52,14 @@ SOAPGTO::SOAPGTO(
     , nmax(nmax)
     , lmax(lmax)
     , eta(eta)
-    , weighting(weighting)
+    , weighting(parseWeighting(weighting))
     , crossover(crossover)
     , cutoff_padding(cutoff_padding)
     , alphas(alphas)
     , betas(betas)
     , species(species)
+    , species_index(get_species_index(species))
+    , kernel(getGTOKernel(nmax, lmax))
 {
 }
 
@@ -56,15 +72,33 @@ void SOAPGTO::create(
     py::array_t<double> centers
 ) const
 {
-    // Extend system if periodicity is requested.
+    // The periodic copies of the atoms are found by the cell list, so the
+    // system does not need to be extended.
     auto pbc_u = pbc.unchecked<1>();
     bool is_periodic = this->periodic && (pbc_u(0) || pbc_u(1) || pbc_u(2));
     if (is_periodic) {
-        ExtendedSystem system_extended = extend_system(positions, atomic_numbers, cell, pbc, this->cutoff);
-        positions = system_extended.positions;
-        atomic_numbers = system_extended.atomic_numbers;
+        CellList cell_list(positions, this->cutoff, cell, pbc);
+        this->create(out, positions, atomic_numbers, centers, cell_list);
+    } else {
+        this->create(out, positions, atomic_numbers, centers);
     }
-    this->create(out, positions, atomic_numbers, centers);
+}
+
+void SOAPGTO::create(
+    py::array_t<float, py::array::c_style> out,
+    py::array_t<double> positions,
+    py::array_t<int> atomic_numbers,
+    py::array_t<double> cell,
+    py::array_t<bool> pbc,
+    py::array_t<double> centers
+) const
+{
+    auto pbc_u = pbc.unchecked<1>();
+    bool is_periodic = this->periodic && (pbc_u(0) || pbc_u(1) || pbc_u(2));
+    CellList cell_list = is_periodic
+        ? CellList(positions, this->cutoff, cell, pbc)
+        : CellList(positions, this->cutoff);
+    this->calculate(out, positions, atomic_numbers, centers, cell_list);
 }
 
 void SOAPGTO::create(
@@ -84,7 +118,18 @@ void SOAPGTO::create(
     py::array_t<double> positions,
     py::array_t<int> atomic_numbers,
     py::array_t<double> centers,
-    CellList cell_list
+    const CellList &cell_list
+) const
+{
+    this->calculate(out, positions, atomic_numbers, centers, cell_list);
+}
+
+void SOAPGTO::calculate(
+    py::array out,
+    py::array_t<double> positions,
+    py::array_t<int> atomic_numbers,
+    py::array_t<double> centers,
+    const CellList &cell_list
 ) const
 {
     // Empty mock arrays since we are not calculating the derivatives
@@ -95,7 +140,10 @@ void SOAPGTO::create(
     py::array_t<int> indices({1});
     py::array_t<int> center_indices({1});
 
-    soapGTO(
+    // The cell list for the centers is only used for the derivatives, so the
+    // atomic cell list is passed in its place.
+    auto workspace = this->workspaces.acquire();
+    this->kernel(
         derivatives,
         out,
         xd,
@@ -108,8 +156,7 @@ void SOAPGTO::create(
         this->betas,
         atomic_numbers,
         this->species,
-        this->rcut,
-        this->cutoff_padding,
+        this->species_index,
         this->nmax,
         this->lmax,
         this->eta,
@@ -120,7 +167,10 @@ void SOAPGTO::create(
         false,
         true,
         false,
-        cell_list
+        cell_list,
+        cell_list,
+        *workspace,
+        nullptr
     );
 }
 
@@ -133,8 +183,8 @@ int SOAPGTO::get_number_of_features() const
 }
 
 void SOAPGTO::derivatives_analytical(
-    py::array_t<double> derivatives,
-    py::array_t<double> descriptor,
+    py::array derivatives,
+    py::array descriptor,
     py::array_t<double> xd,
     py::array_t<double> yd,
     py::array_t<double> zd,
@@ -149,19 +199,87 @@ void SOAPGTO::derivatives_analytical(
     const bool return_descriptor
 ) const
 {
-    // Extend system if periodicity is requested.
+    check_precision(derivatives, "derivatives");
+    check_precision(descriptor, "descriptor");
+
+    // Calculate neighbours with cell lists. For periodic systems the cell
+    // lists also find the periodic copies of the atoms and centers.
     auto pbc_u = pbc.unchecked<1>();
     bool is_periodic = this->periodic && (pbc_u(0) || pbc_u(1) || pbc_u(2));
-    if (is_periodic) {
-        ExtendedSystem system_extended = extend_system(positions, atomic_numbers, cell, pbc, this->cutoff);
-        positions = system_extended.positions;
-        atomic_numbers = system_extended.atomic_numbers;
+    CellList cell_list = is_periodic
+        ? CellList(positions, this->cutoff, cell, pbc)
+        : CellList(positions, this->cutoff);
+    CellList cell_list_centers = is_periodic
+        ? CellList(centers, this->cutoff, cell, pbc)
+        : CellList(centers, this->cutoff);
+
+    auto workspace = this->workspaces.acquire();
+    this->kernel(
+        derivatives,
+        descriptor,
+        xd,
+        yd,
+        zd,
+        positions,
+        centers,
+        center_indices,
+        this->alphas,
+        this->betas,
+        atomic_numbers,
+        this->species,
+        this->species_index,
+        this->nmax,
+        this->lmax,
+        this->eta,
+        this->weighting,
+        this->crossover,
+        this->average,
+        indices,
+        attach,
+        return_descriptor,
+        true,
+        cell_list,
+        cell_list_centers,
+        *workspace,
+        nullptr
+    );
+}
+
+py::tuple SOAPGTO::derivatives_analytical_sparse(
+    py::array descriptor,
+    py::array_t<double> positions,
+    py::array_t<int> atomic_numbers,
+    py::array_t<double> cell,
+    py::array_t<bool> pbc,
+    py::array_t<double> centers,
+    py::array_t<int> center_indices,
+    py::array_t<int> indices,
+    const bool attach,
+    const bool return_descriptor
+) const
+{
+    if (this->average != "off") {
+        throw invalid_argument("Sparse derivatives are not available for averaged output.");
     }
+    check_precision(descriptor, "descriptor");
+    auto pbc_u = pbc.unchecked<1>();
+    bool is_periodic = this->periodic && (pbc_u(0) || pbc_u(1) || pbc_u(2));
+    CellList cell_list = is_periodic
+        ? CellList(positions, this->cutoff, cell, pbc)
+        : CellList(positions, this->cutoff);
+    CellList cell_list_centers = is_periodic
+        ? CellList(centers, this->cutoff, cell, pbc)
+        : CellList(centers, this->cutoff);
 
-    // Calculate neighbours with a cell list
-    CellList cell_list(positions, this->cutoff);
+    // The dense arrays are not used for sparse output
+    py::array_t<double> xd({0, 0, 0, 0, 0});
+    py::array_t<double> yd({0, 0, 0, 0, 0});
+    py::array_t<double> zd({0, 0, 0, 0, 0});
+    py::array_t<double> derivatives({0, 0, 0, 0});
 
-    soapGTO(
+    SparseDerivatives sparse;
+    auto workspace = this->workspaces.acquire();
+    this->kernel(
         derivatives,
         descriptor,
         xd,
@@ -174,8 +292,7 @@ void SOAPGTO::derivatives_analytical(
         this->betas,
         atomic_numbers,
         this->species,
-        this->rcut,
-        this->cutoff_padding,
+        this->species_index,
         this->nmax,
         this->lmax,
         this->eta,
@@ -186,8 +303,14 @@ void SOAPGTO::derivatives_analytical(
         attach,
         return_descriptor,
         true,
-        cell_list
+        cell_list,
+        cell_list_centers,
+        *workspace,
+        &sparse
     );
+
+    ScopedTimer timer(this->get_name(), "conversion");
+    return sparse_derivatives_to_coo(sparse);
 }
 
 SOAPPolynomial::SOAPPolynomial(
@@ -209,12 +332,12 @@ SOAPPolynomial::SOAPPolynomial(
     , nmax(nmax)
     , lmax(lmax)
     , eta(eta)
-    , weighting(weighting)
+    , weighting(parseWeighting(weighting))
     , crossover(crossover)
     , cutoff_padding(cutoff_padding)
-    , rx(rx)
-    , gss(gss)
     , species(species)
+    , species_index(get_species_index(species))
+    , radial_table(rx.data(), gss.data(), rcut+cutoff_padding, eta, rx.shape(0), nmax, lmax)
 {
 }
 
@@ -227,15 +350,16 @@ void SOAPPolynomial::create(
     py::array_t<double> centers
 ) const
 {
-    // Extend system if periodicity is requested.
+    // The periodic copies of the atoms are found by the cell list, so the
+    // system does not need to be extended.
     auto pbc_u = pbc.unchecked<1>();
     bool is_periodic = this->periodic && (pbc_u(0) || pbc_u(1) || pbc_u(2));
     if (is_periodic) {
-        ExtendedSystem system_extended = extend_system(positions, atomic_numbers, cell, pbc, this->cutoff);
-        positions = system_extended.positions;
-        atomic_numbers = system_extended.atomic_numbers;
+        CellList cell_list(positions, this->cutoff, cell, pbc);
+        this->create(out, positions, atomic_numbers, centers, cell_list);
+    } else {
+        this->create(out, positions, atomic_numbers, centers);
     }
-    this->create(out, positions, atomic_numbers, centers);
 }
 
 void SOAPPolynomial::create(
@@ -255,26 +379,106 @@ void SOAPPolynomial::create(
     py::array_t<double> positions,
     py::array_t<int> atomic_numbers,
     py::array_t<double> centers,
-    CellList cell_list
+    const CellList &cell_list
 ) const
 {
+    // Empty mock arrays since we are not calculating the derivatives
+    py::array_t<double> xd({1, 1, 1, 1, 1});
+    py::array_t<double> yd({1, 1, 1, 1, 1});
+    py::array_t<double> zd({1, 1, 1, 1, 1});
+    py::array_t<double> derivatives({1, 1, 1, 1});
+    py::array_t<int> indices({1});
+    py::array_t<int> center_indices({1});
+
+    // The cell list for the centers is only used for the derivatives, so the
+    // atomic cell list is passed in its place.
+    auto workspace = this->workspaces.acquire();
     soapGeneral(
+        derivatives,
         out,
+        xd,
+        yd,
+        zd,
         positions,
         centers,
+        center_indices,
         atomic_numbers,
         this->species,
+        this->species_index,
         this->rcut,
         this->cutoff_padding,
         this->nmax,
         this->lmax,
-        this->eta,
         this->weighting,
-        this->rx,
-        this->gss,
+        this->radial_table,
         this->crossover,
         this->average,
-        cell_list
+        indices,
+        false,
+        true,
+        false,
+        cell_list,
+        cell_list,
+        *workspace
+    );
+}
+
+void SOAPPolynomial::derivatives_analytical(
+    py::array_t<double> derivatives,
+    py::array_t<double> descriptor,
+    py::array_t<double> xd,
+    py::array_t<double> yd,
+    py::array_t<double> zd,
+    py::array_t<double> positions,
+    py::array_t<int> atomic_numbers,
+    py::array_t<double> cell,
+    py::array_t<bool> pbc,
+    py::array_t<double> centers,
+    py::array_t<int> center_indices,
+    py::array_t<int> indices,
+    const bool attach,
+    const bool return_descriptor
+) const
+{
+    // Calculate neighbours with cell lists. For periodic systems the cell
+    // lists also find the periodic copies of the atoms and centers.
+    auto pbc_u = pbc.unchecked<1>();
+    bool is_periodic = this->periodic && (pbc_u(0) || pbc_u(1) || pbc_u(2));
+    CellList cell_list = is_periodic
+        ? CellList(positions, this->cutoff, cell, pbc)
+        : CellList(positions, this->cutoff);
+    CellList cell_list_centers = is_periodic
+        ? CellList(centers, this->cutoff, cell, pbc)
+        : CellList(centers, this->cutoff);
+
+    auto workspace = this->workspaces.acquire();
+    soapGeneral(
+        derivatives,
+        descriptor,
+        xd,
+        yd,
+        zd,
+        positions,
+        centers,
+        center_indices,
+        atomic_numbers,
+        this->species,
+        this->species_index,
+        this->rcut,
+        this->cutoff_padding,
+        this->nmax,
+        this->lmax,
+        this->weighting,
+        this->radial_table,
+        this->crossover,
+        this->average,
+        indices,
+        attach,
+        return_descriptor,
+        true,
+        cell_list,
+        cell_list_centers,
+        *workspace
     );
 }
 
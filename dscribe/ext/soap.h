@@ -20,6 +20,9 @@ limitations under the License.
 #include <string>
 #include "descriptor.h"
 #include "celllist.h"
+#include "soapGTO.h"
+#include "soapGeneral.h"
+#include "workspace.h"
 
 namespace py = pybind11;
 using namespace std;
@@ -58,6 +61,19 @@ class SOAPGTO: public Descriptor {
             py::array_t<double> centers
         ) const;
 
+        /**
+         * Writes the output in single precision without an intermediate
+         * double precision array.
+         */
+        void create(
+            py::array_t<float, py::array::c_style> out,
+            py::array_t<double> positions,
+            py::array_t<int> atomic_numbers,
+            py::array_t<double> cell,
+            py::array_t<bool> pbc,
+            py::array_t<double> centers
+        ) const;
+
         void create(
             py::array_t<double> out, 
             py::array_t<double> positions,
@@ -70,7 +86,7 @@ class SOAPGTO: public Descriptor {
             py::array_t<double> positions,
             py::array_t<int> atomic_numbers,
             py::array_t<double> centers,
-            CellList cell_list
+            const CellList &cell_list
         ) const;
 
         /**
@@ -78,12 +94,15 @@ class SOAPGTO: public Descriptor {
          */
         int get_number_of_features() const;
 
+        const char* get_name() const {return "SOAPGTO";};
+
         /**
-         * Analytical derivatives.
+         * Analytical derivatives. The derivatives and the descriptor can be
+         * float32 or float64 arrays.
          */
         void derivatives_analytical(
-            py::array_t<double> derivatives,
-            py::array_t<double> descriptor,
+            py::array derivatives,
+            py::array descriptor,
             py::array_t<double> xd,
             py::array_t<double> yd,
             py::array_t<double> zd,
@@ -98,17 +117,51 @@ class SOAPGTO: public Descriptor {
             const bool return_descriptor
         ) const;
 
+        /**
+         * Analytical derivatives that only stores the non-zero elements.
+         * Returns a tuple with the coordinates of the elements as a [4, n]
+         * array and their values. The coordinates are sorted and refer to the
+         * dense [n_centers, n_indices, 3, n_features] array. The descriptor
+         * can be a float32 or float64 array.
+         */
+        py::tuple derivatives_analytical_sparse(
+            py::array descriptor,
+            py::array_t<double> positions,
+            py::array_t<int> atomic_numbers,
+            py::array_t<double> cell,
+            py::array_t<bool> pbc,
+            py::array_t<double> centers,
+            py::array_t<int> center_indices,
+            py::array_t<int> indices,
+            const bool attach,
+            const bool return_descriptor
+        ) const;
+
     private:
+        /**
+         * Used to create the output in the precision of the given array.
+         */
+        void calculate(
+            py::array out,
+            py::array_t<double> positions,
+            py::array_t<int> atomic_numbers,
+            py::array_t<double> centers,
+            const CellList &cell_list
+        ) const;
+
         const double rcut;
         const int nmax;
         const int lmax;
         const double eta;
-        const py::dict weighting;
+        const Weighting weighting;
         const bool crossover;
         const double cutoff_padding;
         const py::array_t<double> alphas;
         const py::array_t<double> betas;
         const py::array_t<int> species;
+        const vector<int> species_index;
+        const GTOKernel kernel;
+        mutable WorkspacePool<GTOWorkspace> workspaces;
 };
 
 /**
@@ -157,7 +210,7 @@ class SOAPPolynomial: public Descriptor {
             py::array_t<double> positions,
             py::array_t<int> atomic_numbers,
             py::array_t<double> centers,
-            CellList cell_list
+            const CellList &cell_list
         ) const;
 
         /**
@@ -165,17 +218,40 @@ class SOAPPolynomial: public Descriptor {
          */
         int get_number_of_features() const;
 
+        const char* get_name() const {return "SOAPPolynomial";};
+
+        /**
+         * Analytical derivatives.
+         */
+        void derivatives_analytical(
+            py::array_t<double> derivatives,
+            py::array_t<double> descriptor,
+            py::array_t<double> xd,
+            py::array_t<double> yd,
+            py::array_t<double> zd,
+            py::array_t<double> positions,
+            py::array_t<int> atomic_numbers,
+            py::array_t<double> cell,
+            py::array_t<bool> pbc,
+            py::array_t<double> centers,
+            py::array_t<int> center_indices,
+            py::array_t<int> indices,
+            const bool attach,
+            const bool return_descriptor
+        ) const;
+
     private:
         const double rcut;
         const int nmax;
         const int lmax;
         const double eta;
-        const py::dict weighting;
+        const Weighting weighting;
         const bool crossover;
         const double cutoff_padding;
-        const py::array_t<double> rx;
-        const py::array_t<double> gss;
         const py::array_t<int> species;
+        const vector<int> species_index;
+        const PolyRadialTable radial_table;
+        mutable WorkspacePool<PolyWorkspace> workspaces;
 };
 
 #endif
@@ -18,20 +18,75 @@ limitations under the License.
 #include <vector>
 #include <pybind11/numpy.h>
 #include "celllist.h"
+#include "descriptor.h"
+#include "weighting.h"
 
 namespace py = pybind11;
 using namespace std;
 
-inline int getCrosNum(int n);
-inline int getDeltas(double* x, double* y, double* z, double *positions, double r[3], const vector<int> &indices);
-inline void getRsZs(double* x,double* x2,double* x4,double* x6,double* x8,double* x10,double* x12,double* x14,double* x16,double* x18, double* y,double* y2,double* y4,double* y6,double* y8,double* y10,double* y12,double* y14,double* y16,double* y18, double* z,double* r2,double* r4,double* r6,double* r8,double* r10,double* r12,double* r14,double* r16,double* r18,double* z2,double* z4,double* z6,double* z8,double* z10,double* z12,double* z14,double* z16,double* z18, int size, int lMax);
-void getAlphaBeta(double* aOa, double* bOa, double* alphas, double* betas, int Ns,int lMax, double oOeta, double oOeta3O2);
-void getCfactors(double* preCoef, int Asize, double* x,double* x2, double* x4, double* x6, double* x8, double* x10,double* x12,double* x14,double* x16,double* x18, double* y,double* y2, double* y4, double* y6, double* y8, double* y10,double* y12,double* y14,double* y16,double* y18, double* z, double* z2, double* z4, double* z6, double* z8, double* z10,double* z12,double* z14,double* z16,double* z18, double* r2, double* r4, double* r6, double* r8,double* r10,double* r12,double* r14,double* r16,double* r18, int totalAN, int lMax);
-void getC(double* CDevX,double* CDevY, double* CDevZ, double* C, double* preCoef, double* x, double* y, double* z,double* r2, double* bOa, double* aOa, double* exes,  int totalAN, int Asize, int Ns, int Ntypes, int lMax, int posI, int typeJ,vector<int>&indices);
-void getP(double* soapMat, double* Cnnd, int Ns, int Ts, int Hs, int lMax);
-void soapGTO(
-    py::array_t<double> derivatives,
-    py::array_t<double> descriptor,
+/**
+ * Scratch space for expanding the neighbourhood of a single center. The
+ * arrays hold capacity elements per neighbour quantity. For periodic systems
+ * a center may have more neighbours than there are atoms, so the capacity is
+ * increased when needed. One instance is needed per thread.
+ */
+struct GTOScratch {
+    /**
+     * Returns the number of bytes allocated for the buffer, which is zero
+     * when the existing buffer is large enough.
+     */
+    size_t resize(int capacity, int nMax, int lMax, bool return_derivatives);
+
+    int capacity = 0;
+
+    vector<double> buffer;
+    double *dx, *dy, *dz;
+    double *r1, *r2;
+    double *exes, *weights;
+    double *preCoef, *prCofDX, *prCofDY, *prCofDZ;
+    double *preExponents;
+    double *harmonicsWork;
+    vector<int> indices;
+    CellListNeighbours neighbours;
+
+    // The distinct neighbours of an attached center, used when the
+    // derivatives with respect to the center atom are summed up.
+    vector<int> others;
+    vector<bool> seen;
+
+    // Only used for averaged or sparse derivatives: the coefficient
+    // derivatives of a single center, their sum over the centers of the chunk
+    // for inner averaging, the power spectrum derivatives summed over the
+    // centers of the chunk for outer averaging and the derivatives of a
+    // single center and atom for sparse output.
+    py::array_t<double> cdevX, cdevY, cdevZ;
+    py::array_t<double> cdevSumX, cdevSumY, cdevSumZ;
+    py::array_t<double> derivativesSum;
+    vector<double> block;
+};
+
+/**
+ * Buffers that are reused between calls to soapGTO. The coefficient arrays
+ * may have more rows than there are centers in the current call.
+ */
+struct GTOWorkspace {
+    vector<GTOScratch> scratch;
+    vector<double> aOa;
+    vector<double> bOa;
+    py::array_t<double> cnnd;
+    py::array_t<double> cnnd_ave;
+    py::array_t<double> ps_temp;
+};
+
+/**
+ * Calculates the SOAP output and its derivatives with the GTO basis. The
+ * descriptor and the dense derivatives are written in the precision of the
+ * given arrays, which can be float32 or float64. The expansion is always
+ * calculated in double precision.
+ */
+typedef void (*GTOKernel)(
+    py::array derivatives,
+    py::array descriptor,
     py::array_t<double> cdevX,
     py::array_t<double> cdevY,
     py::array_t<double> cdevZ,
@@ -42,20 +97,30 @@ void soapGTO(
     py::array_t<double> betasArr,
     py::array_t<int> atomicNumbersArr,
     py::array_t<int> orderedSpeciesArr,
-    const double rCut,
-    const double cutoffPadding,
+    const vector<int> &speciesIndex,
     const int Ns,
     const int lMax,
     const double eta,
-    py::dict weighting,
+    const Weighting &weighting,
     const bool crossover,
     string average,
     py::array_t<int> indices,
     const bool attach,
     const bool return_descriptor,
     const bool return_derivatives,
-    CellList cell_list
+    const CellList &cell_list_atoms,
+    const CellList &cell_list_centers,
+    GTOWorkspace &workspace,
+    SparseDerivatives *sparse
 );
 
+/**
+ * Returns the kernel for the given number of radial basis functions and
+ * maximum degree. A few common pairs have kernels that are compiled for that
+ * size, so that the loops over the basis can be unrolled. Other pairs use a
+ * generic kernel.
+ */
+GTOKernel getGTOKernel(int nMax, int lMax);
+
 #endif
 
@@ -19,18 +19,20 @@ limitations under the License.
 #include <map>
 #include <set>
 #include <algorithm>
+#include <complex>
 #include <iostream>
 #include "soapGeneral.h"
+#include "descriptor.h"
 #include "weighting.h"
+#include "threadpool.h"
+#include "workspace.h"
+#include "profiling.h"
 
-#define tot (double*) malloc(sizeof(double)*nAtoms);
-#define totrs (double*) malloc(sizeof(double)*nAtoms*rsize);
 #define sd sizeof(double)
 #define PI 3.14159265359
 
-double* factorListSet()
+void factorListSet(double* c)
 {
- double* c = (double* ) malloc(sd*1326);
  c[0]= 0.2820947917738781;
  c[1]= 0.4886025119029199;
  c[2]= 0.3454941494713355;
@@ -1357,10 +1359,8 @@ c[454]=0.0;
  c[1323]=0.0;
  c[1324]=0.0;
  c[1325]=0.0;
-  return c;
 }
-double* getws(){ // OK
- double* c = (double* ) malloc(sd*100);
+void getws(double* c){ // OK
 c[0] = 7.34634490505672E-4;
 c[1] = 0.001709392653518105;
 c[2] = 0.002683925371553482;
@@ -1461,30 +1461,13 @@ c[96] = 0.003655961201326375;
 c[97] = 0.002683925371553482;
 c[98] = 0.001709392653518105;
 c[99] = 7.3463449050567E-4;
-return c;
 }
 
 inline double factorY(int l, int m, double* c)
 {
     return c[(l*(l+1))/2 + m];//l+1
 }
-inline double* getoOr(double* r, int rsize)
-{
-    double* oOr = (double*) malloc(sd*rsize);
-    for (int w = 0; w < rsize; w++) {
-        oOr[w] = 1/r[w];
-    }
-    return oOr;
-}
-inline double* getrw2(double* r, int rsize)
-{
-    double* rw2 = (double*) malloc(sd*rsize);
-    for(int w = 0; w < rsize; w++){
-        rw2[w] = r[w]*r[w];
-    }
-    return rw2;
-}
-inline void expMs(double* rExpDiff, double eta, double* r, double* ri, int isize, int rsize)
+inline void expMs(double* rExpDiff, double eta, const double* r, const double* ri, int isize, int rsize)
 {
     double rDiff;
     for (int i = 0; i < isize; i++) {
@@ -1498,7 +1481,7 @@ inline void expMs(double* rExpDiff, double eta, double* r, double* ri, int isize
         }
     }
 }
-inline void expPs(double* rExpSum, double eta, double* r, double* ri, int isize, int rsize)
+inline void expPs(double* rExpSum, double eta, const double* r, const double* ri, int isize, int rsize)
 {
     double rSum;
     for (int i = 0; i < isize; i++) {
@@ -1512,36 +1495,38 @@ inline void expPs(double* rExpSum, double eta, double* r, double* ri, int isize,
         }
     }
 }
-pair<int, int> getDeltas(double* dx, double* dy, double* dz, double* ri, double* rw, double rCut, double* oOri, double* oO4arri, double* minExp, double* pluExp, double eta, const py::array_t<double> &positions, const double ix, const double iy, const double iz, const vector<int> &indices, int rsize, int Ihpos, int Itype)
+pair<int, int> getDeltas(double* dx, double* dy, double* dz, double* ri, double* oOri, vector<int> &indices, const CellListNeighbours &neighbours, int begin, int end)
 {
     int iNeighbour = 0;
     int iCenter = 0;
     double ri2;
-    double oOa = 1/eta;
     double Xi; double Yi; double Zi;
-    int nNeighbours = indices.size();
-    double* oO4ari = (double*) malloc(sd*nNeighbours);
-
-    auto pos = positions.unchecked<2>();
-    for (const int &i : indices) {
-        Xi = pos(i, 0) - ix;
-        Yi = pos(i, 1) - iy;
-        Zi = pos(i, 2) - iz;
+
+    // The atom indices are stored in the same order as the deltas, followed
+    // by the indices of the centered atoms.
+    const int nEntries = end - begin;
+    indices.resize(nEntries);
+
+    for (int entry = begin; entry < end; ++entry) {
+        Xi = neighbours.dx[entry];
+        Yi = neighbours.dy[entry];
+        Zi = neighbours.dz[entry];
         ri2 = Xi*Xi + Yi*Yi + Zi*Zi;
 
         // When an atom is very close to the center (=approximately on top of
-        // it), we do not add it to the calculations, as the numerical
-        // integration cannot handle these cases. Instead, we gather the number
-        // of such centered atoms and report them back for later correction.
+        // it), we do not add it to the calculations, as the spherical
+        // harmonics are not defined there. Instead, we gather the number of
+        // such centered atoms and report them back for later correction.
         if (ri2<=1e-12) {
             iCenter++;
+            indices[nEntries - iCenter] = neighbours.indices[entry];
         } else {
+            indices[iNeighbour] = neighbours.indices[entry];
             ri[iNeighbour] = sqrt(ri2);
             dx[iNeighbour] = Xi;
             dy[iNeighbour] = Yi;
             dz[iNeighbour] = Zi;
             oOri[iNeighbour] = 1/ri[iNeighbour];
-            oO4ari[iNeighbour] = 0.25*oOa*oOri[iNeighbour];
             iNeighbour++;
         }
     }
@@ -1553,21 +1538,10 @@ pair<int, int> getDeltas(double* dx, double* dy, double* dz, double* ri, double*
         ri[iNeighbour] = 0;
     }
 
-    double* oOr = getoOr(rw, rsize);
-    for (int i = 0; i < iNeighbour; i++) {
-        for (int w = 0; w < rsize; w++) {
-            oO4arri[rsize*i + w] = oO4ari[i]*oOr[w];
-        }
-    }
-    expMs(minExp, eta, rw, ri, iNeighbour, rsize);
-    expPs(pluExp, eta, rw, ri, iNeighbour, rsize);
-
-    free(oO4ari);
     return make_pair(iNeighbour, iCenter);
 }
-double* getFlir(double* oO4arri,double* ri, double* minExp, double* pluExp, int icount, int rsize, int lMax)
+void getFlir(double* Flir, double* oO4arri,double* ri, double* minExp, double* pluExp, int icount, int rsize, int lMax)
 {
-    double* Flir = (double*) malloc(sd*(lMax+1)*icount*rsize);
     //l=0
     for (int i = 0; i < icount; i++) {
         for (int w = 0; w < rsize; w++) {
@@ -1596,8 +1570,6 @@ double* getFlir(double* oO4arri,double* ri, double* minExp, double* pluExp, int
             }
         }
     }
-
-    return Flir;
 }
 double legendre_poly(int l, int m, double x)
 {
@@ -1636,12 +1608,8 @@ double legendre_poly(int l, int m, double x)
         }
     }
 }
-double* getYlmi(double* x, double* y, double* z, double* oOri, double* cf, int icount, int lMax)
+void getYlmi(double* Ylmi, double* legPol, double* ChiCos, double* ChiSin, double* x, double* y, double* z, double* oOri, double* cf, int icount, int lMax)
 {
-    double* Ylmi = (double*) malloc(2*sd*(lMax+1)*(lMax+1)*icount);
-    double* legPol = (double*) malloc(sd*(lMax+1)*(lMax+1)*icount);
-    double* ChiCos= (double*) malloc(sd*(lMax+1)*icount);
-    double* ChiSin= (double*) malloc(sd*(lMax+1)*icount);
     double myAtan2;
 
     for (int i = 0; i < icount; i++) {
@@ -1667,56 +1635,32 @@ double* getYlmi(double* x, double* y, double* z, double* oOri, double* cf, int i
             }
         }
     }
-    free(legPol);
-    free(ChiCos);
-    free(ChiSin);
-
-    return Ylmi;
 }
-double* getIntegrand(double* Flir, double* Ylmi, int rsize, int icount, int lMax, double* weights)
+void getC(double* C, const PolyRadialTable &radialTable, double* radial, double* Ylmi, int lMax, int nMax, int nNeighbours, int nCenters, double* weights)
 {
-    double* summed = (double*) malloc(2*sd*(lMax+1)*rsize*(lMax+1));
-    double realY;
-    double imagY;
+    const int nL = lMax+1;
+    const int nR = nMax*nL;
 
     // Initialize to zero
-    memset(summed, 0.0, 2*(lMax+1)*rsize*(lMax+1)*sizeof(double));
+    memset(C, 0.0, 2*nL*nL*nMax*sizeof(double));
 
-    for (int l = 0; l < lMax+1; l++) {
-        for (int m = 0; m < l+1; m++) {
-            for (int i = 0; i < icount; i++) {
-                realY = Ylmi[2*(lMax+1)*icount*l + 2*icount*m + 2*i];
-                imagY = Ylmi[2*(lMax+1)*icount*l + 2*icount*m + 2*i + 1];
-                for (int rw = 0; rw < rsize; rw++) {
-                    summed[2*(lMax+1)*l*rsize + 2*m*rsize + 2*rw    ] += weights[i]*Flir[l*rsize*icount + rsize*i + rw] * realY;
-                    summed[2*(lMax+1)*l*rsize + 2*m*rsize + 2*rw + 1] += weights[i]*Flir[l*rsize*icount + rsize*i + rw] * imagY;
-                }
-            }
+    // For atoms at the center only l=0 is non-zero
+    if (nCenters > 0) {
+        const double* center = radialTable.centerValues();
+        const double weight = weights[nNeighbours];
+        for (int n = 0; n < nMax; n++) {
+            C[2*nL*nL*n] += nCenters*weight*0.5*0.564189583547756*center[n*nL];
         }
     }
-    return summed;
-}
-void getC(double* C, double* ws, double* rw2, double * gns, double* summed, double rCut, int lMax, int rsize, int gnsize, int nCenters, int nNeighbours, double eta, double* weights)
-{
-    // Initialize to zero
-    memset(C, 0.0, 2*(lMax+1)*(lMax+1)*gnsize*sizeof(double));
-
-    for (int n = 0; n < gnsize; n++) {
-        // For atoms at the center we add a precalculated constant value
-        // because the numerical integration cannot handle them
-        if (nCenters > 0) {
-            double weight = weights[nNeighbours];
-            for (int iCenter = 0; iCenter < nCenters; ++iCenter) {
-                for (int rw = 0; rw < rsize; rw++) {
-                    C[2*(lMax+1)*(lMax+1)*n] += weight * 0.5*0.564189583547756*rw2[rw]*ws[rw]*gns[rsize*n + rw]*exp(-eta*rw2[rw]);
-                }
-            }
-        }
-        for (int l = 0; l < lMax+1; l++) {
+    for (int i = 0; i < nNeighbours; i++) {
+        const double* R = radial + i*nR;
+        for (int l = 0; l < nL; l++) {
             for (int m = 0; m < l+1; m++) {
-                for (int rw = 0; rw < rsize; rw++) {
-                    C[2*(lMax+1)*(lMax+1)*n + l*2*(lMax+1) + 2*m    ] += rw2[rw]*ws[rw]*gns[rsize*n + rw]*summed[2*(lMax+1)*l*rsize + 2*m*rsize + 2*rw    ]; // Re
-                    C[2*(lMax+1)*(lMax+1)*n + l*2*(lMax+1) + 2*m + 1] += rw2[rw]*ws[rw]*gns[rsize*n + rw]*summed[2*(lMax+1)*l*rsize + 2*m*rsize + 2*rw + 1]; //Im
+                const double realY = weights[i]*Ylmi[2*nL*nNeighbours*l + 2*nNeighbours*m + 2*i];
+                const double imagY = weights[i]*Ylmi[2*nL*nNeighbours*l + 2*nNeighbours*m + 2*i + 1];
+                for (int n = 0; n < nMax; n++) {
+                    C[2*nL*nL*n + l*2*nL + 2*m    ] += R[n*nL + l]*realY; // Re
+                    C[2*nL*nL*n + l*2*nL + 2*m + 1] += R[n*nL + l]*imagY; // Im
                 }
             }
         }
@@ -1735,6 +1679,136 @@ void accumC(double* Cs, double* C, int lMax, int nMax, int typeI, int i, int nCo
     }
 }
 
+/**
+ * Used to calculate the derivatives of the coefficients of center i with
+ * respect to the positions of its neighbours of type typeJ.
+ *
+ * The radial integrals and their derivatives are given by the radial table
+ * in s.radial and s.radialDev. The gradients of the spherical harmonics are evaluated from
+ * Y_lm = f_lm*(-1)^m*A^m*P_l^(m)(z/r), where A = (x+iy)/r and P_l^(m) is
+ * the m:th derivative of the Legendre polynomial. This form stays finite on
+ * the z-axis. Atoms at the center only contribute to l=1.
+ */
+void getCDev(py::detail::unchecked_mutable_reference<double, 5> &CDevX, py::detail::unchecked_mutable_reference<double, 5> &CDevY, py::detail::unchecked_mutable_reference<double, 5> &CDevZ, PolyScratch &s, const PolyRadialTable &radialTable, double* cf, int nMax, int lMax, int nNeighbours, int nCenters, int i, int centerAtomI, int typeJ)
+{
+    const int nL = lMax+1;
+    const int nR = nMax*nL;
+    const int icount = nNeighbours;
+    double* Q = s.legDev;
+
+    for (int a = 0; a < nNeighbours; a++) {
+        const int index = s.indices[a];
+        const double oOri = s.oOri[a];
+        const double w = s.weights[a];
+        const double dw = s.dweights[a];
+        const double* radial = s.radial + a*nR;
+        const double* radialDev = s.radialDev + a*nR;
+
+        // Derivatives of the Legendre polynomials: Q[(nL+1)*l + m] = P_l^(m)
+        const double u[3] = {s.dx[a]*oOri, s.dy[a]*oOri, s.dz[a]*oOri};
+        for (int m = 0; m < nL; m++) {
+            double pmm = 1;
+            for (int k = 1; k < 2*m; k += 2) {
+                pmm *= k;
+            }
+            Q[(nL+1)*m + m] = pmm;
+            Q[(nL+1)*m + m + 1] = 0;
+            if (m + 1 < nL) {
+                Q[(nL+1)*(m+1) + m] = u[2]*(2*m+1)*pmm;
+            }
+            for (int l = m+2; l < nL; l++) {
+                Q[(nL+1)*l + m] = (u[2]*(2*l-1)*Q[(nL+1)*(l-1) + m] - (l+m-1)*Q[(nL+1)*(l-2) + m])/(l-m);
+            }
+        }
+
+        // Gradients of A and z/r
+        const complex<double> A(u[0], u[1]);
+        const complex<double> dA[3] = {
+            complex<double>(1 - u[0]*u[0], -u[0]*u[1])*oOri,
+            complex<double>(-u[0]*u[1], 1 - u[1]*u[1])*oOri,
+            complex<double>(-u[0]*u[2], -u[1]*u[2])*oOri
+        };
+        const double du[3] = {-u[2]*u[0]*oOri, -u[2]*u[1]*oOri, (1 - u[2]*u[2])*oOri};
+
+        for (int l = 0; l < nL; l++) {
+            complex<double> Am(1, 0);
+            complex<double> Am1(0, 0);
+            for (int m = 0; m < l+1; m++) {
+                const double f = (m % 2 ? -1 : 1)*factorY(l, m, cf);
+                const double realY = s.Ylmi[2*nL*icount*l + 2*icount*m + 2*a];
+                const double imagY = s.Ylmi[2*nL*icount*l + 2*icount*m + 2*a + 1];
+                complex<double> dY[3];
+                for (int c = 0; c < 3; c++) {
+                    dY[c] = f*((double)m*Am1*dA[c]*Q[(nL+1)*l + m] + Am*Q[(nL+1)*l + m + 1]*du[c]);
+                }
+                const int k = l*2*nL + 2*m;
+                for (int n = 0; n < nMax; n++) {
+                    const double R = radial[n*nL + l];
+                    const double dR = dw*R + w*radialDev[n*nL + l];
+                    CDevX(index, i, typeJ, n, k    ) += dR*u[0]*realY + w*R*dY[0].real();
+                    CDevX(index, i, typeJ, n, k + 1) += dR*u[0]*imagY + w*R*dY[0].imag();
+                    CDevY(index, i, typeJ, n, k    ) += dR*u[1]*realY + w*R*dY[1].real();
+                    CDevY(index, i, typeJ, n, k + 1) += dR*u[1]*imagY + w*R*dY[1].imag();
+                    CDevZ(index, i, typeJ, n, k    ) += dR*u[2]*realY + w*R*dY[2].real();
+                    CDevZ(index, i, typeJ, n, k + 1) += dR*u[2]*imagY + w*R*dY[2].imag();
+                }
+                Am1 = Am;
+                Am *= A;
+            }
+        }
+    }
+
+    // For atoms at the center F_1 is linear in ri, and the l=1 coefficients
+    // are linear in the atom displacement.
+    if (nCenters > 0 && lMax > 0) {
+        const double w = s.weights[nNeighbours];
+        const double f10 = factorY(1, 0, cf);
+        const double f11 = factorY(1, 1, cf);
+        const double* center = radialTable.centerDerivatives();
+        for (int n = 0; n < nMax; n++) {
+            const double K = center[n*nL + 1];
+            for (int c = nNeighbours; c < nNeighbours + nCenters; c++) {
+                const int index = s.indices[c];
+                CDevX(index, i, typeJ, n, 2*nL + 2) += -f11*w*K;
+                CDevY(index, i, typeJ, n, 2*nL + 3) += -f11*w*K;
+                CDevZ(index, i, typeJ, n, 2*nL    ) += f10*w*K;
+            }
+        }
+    }
+
+    // If attach=True, the derivative with respect to the center atom
+    // coordinates is the negative sum of derivatives with respect to
+    // coordinates of other atoms in the the neighbourhood. The derivatives of
+    // the periodic images of an atom are already summed together, so each
+    // atom is only counted once.
+    const int nIndices = nNeighbours + nCenters;
+    if (centerAtomI >= 0 && nIndices > 0) {
+        vector<int> others;
+        vector<bool> seen(*max_element(s.indices.begin(), s.indices.begin() + nIndices) + 1, false);
+        for (int a = 0; a < nIndices; a++) {
+            if (s.indices[a] != centerAtomI && !seen[s.indices[a]]) {
+                seen[s.indices[a]] = true;
+                others.push_back(s.indices[a]);
+            }
+        }
+        for (int n = 0; n < nMax; n++) {
+            for (int k = 0; k < 2*nL*nL; k++) {
+                double sumX = 0;
+                double sumY = 0;
+                double sumZ = 0;
+                for (const int &other : others) {
+                    sumX += CDevX(other, i, typeJ, n, k);
+                    sumY += CDevY(other, i, typeJ, n, k);
+                    sumZ += CDevZ(other, i, typeJ, n, k);
+                }
+                CDevX(centerAtomI, i, typeJ, n, k) = -sumX;
+                CDevY(centerAtomI, i, typeJ, n, k) = -sumY;
+                CDevZ(centerAtomI, i, typeJ, n, k) = -sumZ;
+            }
+        }
+    }
+}
+
 /**
  * Used to calculate the partial power spectrum.
  *
@@ -1747,11 +1821,11 @@ void accumC(double* Cs, double* C, int lMax, int nMax, int typeI, int i, int nCo
  */
 void getP(py::detail::unchecked_mutable_reference<double, 2> &Ps, double* Cs, int Nt, int lMax, int nMax, int Hs, double rCut2, int nFeatures, bool crossover, int nCoeffs)
 {
-    // The current index in the final power spectrum array.
-    int pIdx = 0;
-
-    for (int i = 0; i < Hs; i++) {
-        pIdx = 0;
+    // The centers are independent and are split between the native threads.
+    parallel_for(Hs, [&](int begin, int end, int) {
+    for (int i = begin; i < end; i++) {
+        // The current index in the final power spectrum array.
+        int pIdx = 0;
         for (int Z1 = 0; Z1 < Nt; Z1++) {
             int Z2Limit = crossover ? Nt : Z1+1;
             for (int Z2 = Z1; Z2 < Z2Limit; Z2++) {
@@ -1805,162 +1879,473 @@ void getP(py::detail::unchecked_mutable_reference<double, 2> &Ps, double* Cs, in
             }
         }
     }
+    });
 }
+/**
+ * Used to calculate the derivatives of the partial power spectrum. The
+ * features are in the same order as in getP.
+ */
+void getPDev(py::detail::unchecked_mutable_reference<double, 4> &derivatives, py::detail::unchecked_reference<double, 2> &positions, py::detail::unchecked_reference<int, 1> &indices, const CellList &cellList, py::detail::unchecked_reference<double, 5> &CDevX, py::detail::unchecked_reference<double, 5> &CDevY, py::detail::unchecked_reference<double, 5> &CDevZ, double* Cs, int Nt, int lMax, int nMax, int Hs, double rCut2, bool crossover, int nCoeffs)
+{
+    // Each atom writes to its own slot in the output, so the atoms are split
+    // between the native threads.
+    parallel_for(indices.size(), [&](int begin, int end, int) {
+    CellListNeighbours neighbours;
+    vector<int> centers;
+    vector<bool> seen(Hs);
+    for (int iIdx = begin; iIdx < end; ++iIdx) {
+        int iAtom = indices(iIdx);
+
+        // Get all neighbouring centers for the current atom. In periodic
+        // systems the same center can be found through several images, but
+        // the coefficient derivatives already contain the contribution of
+        // every image, so each center is only processed once.
+        cellList.getNeighboursForPosition(positions(iAtom, 0), positions(iAtom, 1), positions(iAtom, 2), neighbours);
+        centers.clear();
+        for (const int &iCenter : neighbours.indices) {
+            if (!seen[iCenter]) {
+                seen[iCenter] = true;
+                centers.push_back(iCenter);
+            }
+        }
+        for (const int &iCenter : centers) {
+            seen[iCenter] = false;
+        }
+
+        for (const int &i : centers) {
+            int pIdx = 0;
+            for (int Z1 = 0; Z1 < Nt; Z1++) {
+                int Z2Limit = crossover ? Nt : Z1+1;
+                for (int Z2 = Z1; Z2 < Z2Limit; Z2++) {
+                    for (int l = 0; l < lMax+1; l++) {
+                        double prefactor = PI*sqrt(8.0/(2.0*l+1.0))*39.478417604*rCut2;
+                        for (int N1 = 0; N1 < nMax; N1++) {
+                            // If the species are identical, then there is
+                            // symmetry in the radial basis.
+                            for (int N2 = Z1 == Z2 ? N1 : 0; N2 < nMax; N2++) {
+                                double* C1 = Cs + i*nCoeffs + 2*Z1*(lMax+1)*(lMax+1)*nMax + 2*(lMax+1)*(lMax+1)*N1 + l*2*(lMax+1);
+                                double* C2 = Cs + i*nCoeffs + 2*Z2*(lMax+1)*(lMax+1)*nMax + 2*(lMax+1)*(lMax+1)*N2 + l*2*(lMax+1);
+                                double sumX = 0;
+                                double sumY = 0;
+                                double sumZ = 0;
+                                for (int k = 0; k < 2*(l+1); k++) {
+                                    // The imaginary part is zero for m=0 and
+                                    // the m>0 terms are counted twice.
+                                    if (k == 1) {
+                                        continue;
+                                    }
+                                    double factor = k < 2 ? 1 : 2;
+                                    int k1 = l*2*(lMax+1) + k;
+                                    sumX += factor*(C1[k]*CDevX(iAtom, i, Z2, N2, k1) + C2[k]*CDevX(iAtom, i, Z1, N1, k1));
+                                    sumY += factor*(C1[k]*CDevY(iAtom, i, Z2, N2, k1) + C2[k]*CDevY(iAtom, i, Z1, N1, k1));
+                                    sumZ += factor*(C1[k]*CDevZ(iAtom, i, Z2, N2, k1) + C2[k]*CDevZ(iAtom, i, Z1, N1, k1));
+                                }
+                                derivatives(i, iIdx, 0, pIdx) += prefactor*sumX;
+                                derivatives(i, iIdx, 1, pIdx) += prefactor*sumY;
+                                derivatives(i, iIdx, 2, pIdx) += prefactor*sumZ;
+                                ++pIdx;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    });
+}
+void PolyScratch::resize(int capacity, int nMax, int lMax, bool return_derivatives)
+{
+    this->capacity = capacity;
+    const int nL = lMax+1;
+    const int nC = 2*nL*nL*nMax;
+    const int nR = nMax*nL;
+    const int nDev = return_derivatives ? capacity + nR*capacity + (nL+1)*(nL+1) : 0;
+    const size_t size = 6*capacity + nC + 3*nL*nL*capacity + 2*nL*capacity + nR*capacity + nDev;
+    if (this->buffer.size() < size) {
+        this->buffer.resize(size);
+    }
+    double* ptr = this->buffer.data();
+    double** perAtom[6] = {&dx, &dy, &dz, &ris, &weights, &oOri};
+    for (int i = 0; i < 6; ++i) {
+        *perAtom[i] = ptr;
+        ptr += capacity;
+    }
+    this->C = ptr;
+    ptr += nC;
+    this->Ylmi = ptr;
+    ptr += 2*nL*nL*capacity;
+    this->legPol = ptr;
+    ptr += nL*nL*capacity;
+    this->ChiCos = ptr;
+    ptr += nL*capacity;
+    this->ChiSin = ptr;
+    ptr += nL*capacity;
+    this->radial = ptr;
+    ptr += nR*capacity;
+
+    // Buffers that are only needed for the derivatives
+    if (return_derivatives) {
+        this->dweights = ptr;
+        ptr += capacity;
+        this->radialDev = ptr;
+        ptr += nR*capacity;
+        this->legDev = ptr;
+    }
+}
+
+void PolyWorkspace::init()
+{
+    if (this->cf.empty()) {
+        this->cf.resize(1326);
+        factorListSet(this->cf.data());
+    }
+}
+
+PolyRadialTable::PolyRadialTable(const double* rw, const double* gss, double rMax, double eta, int rsize, int nMax, int lMax)
+    : nValues(nMax*(lMax+1))
+{
+    // The integrals vary on the length scale of the atom density and of the
+    // distance between the quadrature points, which determines the spacing
+    // of the table.
+    const int nL = lMax+1;
+    const double sigma = 1/sqrt(2*eta);
+    const double step = min(sigma, rMax/rsize)/8;
+    this->nPoints = max(2, (int)ceil(rMax/step) + 1);
+    this->spacing = rMax/(this->nPoints - 1);
+    this->table.assign(2*this->nValues*this->nPoints, 0.0);
+
+    // The radial basis functions multiplied with the quadrature weights
+    vector<double> ws(100);
+    getws(ws.data());
+    vector<double> g(nMax*rsize);
+    for (int n = 0; n < nMax; n++) {
+        for (int r = 0; r < rsize; r++) {
+            g[rsize*n + r] = rw[r]*rw[r]*ws[r]*gss[rsize*n + r];
+        }
+    }
+
+    // For an atom at the center only F_0 is non-zero, and only F_1 has a
+    // non-zero derivative, as F_1 is linear in ri.
+    double* center = this->table.data();
+    for (int n = 0; n < nMax; n++) {
+        double sum = 0;
+        double sumDev = 0;
+        for (int r = 0; r < rsize; r++) {
+            const double e = exp(-eta*rw[r]*rw[r]);
+            sum += g[rsize*n + r]*e;
+            sumDev += g[rsize*n + r]*e*2*eta*rw[r]/3;
+        }
+        center[n*nL] = sum;
+        if (lMax > 0) {
+            center[this->nValues + n*nL + 1] = sumDev;
+        }
+    }
+
+    // The other distances are integrated in blocks to limit the size of the
+    // intermediate arrays.
+    const int blockSize = 64;
+    vector<double> ri(blockSize);
+    vector<double> oO4arri(blockSize*rsize);
+    vector<double> minExp(blockSize*rsize);
+    vector<double> pluExp(blockSize*rsize);
+    vector<double> Flir(nL*blockSize*rsize);
+    vector<double> dF(nL*rsize);
+    for (int begin = 1; begin < this->nPoints; begin += blockSize) {
+        const int icount = min(blockSize, this->nPoints - begin);
+        for (int a = 0; a < icount; a++) {
+            ri[a] = (begin + a)*this->spacing;
+            const double oO4ari = 0.25*(1/eta)*(1/ri[a]);
+            for (int r = 0; r < rsize; r++) {
+                oO4arri[rsize*a + r] = oO4ari*(1/rw[r]);
+            }
+        }
+        expMs(minExp.data(), eta, rw, ri.data(), icount, rsize);
+        expPs(pluExp.data(), eta, rw, ri.data(), icount, rsize);
+        getFlir(Flir.data(), oO4arri.data(), ri.data(), minExp.data(), pluExp.data(), icount, rsize, lMax);
+
+        for (int a = 0; a < icount; a++) {
+            const double oOri = 1/ri[a];
+
+            // Derivatives of the radial functions with respect to ri,
+            // obtained by differentiating the recurrence used in getFlir.
+            for (int r = 0; r < rsize; r++) {
+                const int ir = rsize*a + r;
+                const double o = oO4arri[ir];
+                const double dMin = 2*eta*(rw[r] - ri[a])*minExp[ir];
+                const double dPlu = -2*eta*(rw[r] + ri[a])*pluExp[ir];
+                dF[r] = -Flir[ir]*oOri + o*(dMin - dPlu);
+                if (lMax > 0) {
+                    dF[rsize + r] = -Flir[rsize*icount + ir]*oOri + o*(dMin + dPlu - 2*dF[r]);
+                }
+                for (int l = 2; l < nL; l++) {
+                    // The values that were clipped to zero are constant
+                    if (Flir[l*rsize*icount + ir] == 0) {
+                        dF[l*rsize + r] = 0;
+                    } else {
+                        dF[l*rsize + r] = dF[(l-2)*rsize + r] + (4*l-2)*o*(oOri*Flir[(l-1)*rsize*icount + ir] - dF[(l-1)*rsize + r]);
+                    }
+                }
+            }
+
+            double* values = this->table.data() + 2*this->nValues*(begin + a);
+            double* derivatives = values + this->nValues;
+            for (int n = 0; n < nMax; n++) {
+                for (int l = 0; l < nL; l++) {
+                    double sum = 0;
+                    double sumDev = 0;
+                    for (int r = 0; r < rsize; r++) {
+                        sum += g[rsize*n + r]*Flir[l*rsize*icount + rsize*a + r];
+                        sumDev += g[rsize*n + r]*dF[l*rsize + r];
+                    }
+                    values[n*nL + l] = sum;
+                    derivatives[n*nL + l] = sumDev;
+                }
+            }
+        }
+    }
+}
+
+void PolyRadialTable::evaluate(double ri, double* values, double* derivatives) const
+{
+    const double x = ri/this->spacing;
+    const int k = min((int)x, this->nPoints - 2);
+    const double t = x - k;
+    const double t2 = t*t;
+    const double t3 = t2*t;
+    const double* v0 = this->table.data() + 2*this->nValues*k;
+    const double* d0 = v0 + this->nValues;
+    const double* v1 = d0 + this->nValues;
+    const double* d1 = v1 + this->nValues;
+
+    // Cubic Hermite basis functions
+    const double h00 = 2*t3 - 3*t2 + 1;
+    const double h10 = (t3 - 2*t2 + t)*this->spacing;
+    const double h01 = -2*t3 + 3*t2;
+    const double h11 = (t3 - t2)*this->spacing;
+    for (int q = 0; q < this->nValues; q++) {
+        values[q] = h00*v0[q] + h10*d0[q] + h01*v1[q] + h11*d1[q];
+    }
+    if (derivatives) {
+        const double g00 = (6*t2 - 6*t)/this->spacing;
+        const double g10 = 3*t2 - 4*t + 1;
+        const double g11 = 3*t2 - 2*t;
+        for (int q = 0; q < this->nValues; q++) {
+            derivatives[q] = g00*(v0[q] - v1[q]) + g10*d0[q] + g11*d1[q];
+        }
+    }
+}
+
+const double* PolyRadialTable::centerValues() const
+{
+    return this->table.data();
+}
+
+const double* PolyRadialTable::centerDerivatives() const
+{
+    return this->table.data() + this->nValues;
+}
+
 void soapGeneral(
+    py::array_t<double> derivatives,
     py::array_t<double> PsArr,
+    py::array_t<double> cdevX,
+    py::array_t<double> cdevY,
+    py::array_t<double> cdevZ,
     py::array_t<double> positions,
     py::array_t<double> HposArr,
+    py::array_t<int> centerIndices,
     py::array_t<int> atomicNumbersArr,
     py::array_t<int> orderedSpeciesArr,
+    const vector<int> &speciesIndex,
     double rCut,
     double cutoffPadding,
     int nMax,
     int lMax,
-    double eta,
-    py::dict weighting,
-    py::array_t<double> rwArr,
-    py::array_t<double> gssArr,
+    const Weighting &weighting,
+    const PolyRadialTable &radialTable,
     bool crossover,
     string average,
-    CellList cellList)
+    py::array_t<int> indices,
+    bool attach,
+    bool return_descriptor,
+    bool return_derivatives,
+    const CellList &cellList,
+    const CellList &cellListCenters,
+    PolyWorkspace &workspace)
 {
     int nAtoms = atomicNumbersArr.shape(0);
     int Nt = orderedSpeciesArr.shape(0);
     int Hs = HposArr.shape(0);
     int nFeatures = crossover ? (Nt*nMax)*(Nt*nMax+1)/2*(lMax+1) : Nt*(lMax+1)*((nMax+1)*nMax)/2;
-    auto atomicNumbers = atomicNumbersArr.unchecked<1>();
-    auto species = orderedSpeciesArr.unchecked<1>();
     auto Ps = PsArr.mutable_unchecked<2>();
+    auto derivativesMu = derivatives.mutable_unchecked<4>();
+    auto cdevXMu = cdevX.mutable_unchecked<5>();
+    auto cdevYMu = cdevY.mutable_unchecked<5>();
+    auto cdevZMu = cdevZ.mutable_unchecked<5>();
+    auto cdevXU = cdevX.unchecked<5>();
+    auto cdevYU = cdevY.unchecked<5>();
+    auto cdevZU = cdevZ.unchecked<5>();
+    auto centerIndicesU = centerIndices.unchecked<1>();
+    auto indicesU = indices.unchecked<1>();
+    auto positionsU = positions.unchecked<2>();
     double *Hpos = (double*)HposArr.request().ptr;
-    double *rw = (double*)rwArr.request().ptr;
-    double *gss = (double*)gssArr.request().ptr;
-    double* cf = factorListSet();
-    const int rsize = 100; // The number of points in the radial integration grid
     double rCut2 = rCut*rCut;
-    double* dx = tot;
-    double* dy = tot;
-    double* dz = tot;
-    double* ris = tot;
-    double* weights = tot;
-    double* oOri = tot;
-    double* ws  = getws();
-    double* oOr = getoOr(rw, rsize);
-    double* rw2 = getrw2(rw, rsize);
-    double* oO4arri = totrs;
-    double* minExp = totrs;
-    double* pluExp = totrs;
-    double* C = (double*) malloc(2*sd*(lMax+1)*(lMax+1)*nMax);
-    
-    // Initialize arrays for storing the C coefficients.
+    workspace.init();
+    double* cf = workspace.cf.data();
+    const int nR = nMax*(lMax+1);
+
+    // Every chunk of centers is expanded using its own scratch space. The
+    // buffers are kept in the workspace and only grow when needed.
+    const int nChunks = get_num_chunks(Hs);
+    PhaseCounter allocated("SOAPPolynomial", "bytes_allocated");
+    Profiler::add_count("SOAPPolynomial", "centers", Hs);
+    vector<PolyScratch> &scratch = workspace.scratch;
+    if ((int)scratch.size() < nChunks) {
+        scratch.resize(nChunks);
+    }
+
+    // Initialize arrays for storing the C coefficients. The rows of Cs are
+    // zeroed when the centers are processed.
     int nCoeffs = 2*(lMax+1)*(lMax+1)*nMax*Nt;
-    int nCoeffsAll = nCoeffs*Hs;
-    double* Cs = (double*) malloc(sizeof(double)*nCoeffsAll);
-    double* CsAve;
-    memset(Cs, 0.0, nCoeffsAll*sizeof(double));
+    if (workspace.Cs.size() < (size_t)nCoeffs*Hs) {
+        workspace.Cs.resize((size_t)nCoeffs*Hs);
+        allocated.add(workspace.Cs.size()*sizeof(double));
+    }
+    double* Cs = workspace.Cs.data();
+    double* CsAve = nullptr;
     if (average == "inner") {
-        CsAve = (double*) malloc(nCoeffs*sizeof(double));
-        memset(CsAve, 0.0, nCoeffs*sizeof(double));
+        workspace.CsAve.assign(nCoeffs, 0.0);
+        CsAve = workspace.CsAve.data();
     }
 
-    // Create a mapping between an atomic index and its internal index in the
-    // output. The list of species is already ordered.
-    map<int, int> ZIndexMap;
-    for (int i = 0; i < species.size(); ++i) {
-        ZIndexMap[species(i)] = i;
+    // The internal index of the species of each atom, used for sorting the
+    // neighbours of a center by species.
+    vector<int> atomSpecies;
+    get_atom_species(atomSpecies, atomicNumbersArr, speciesIndex);
+
+    // Temporary array for the power spectrum of each center when outer
+    // averaging is requested. Allocated here since numpy arrays cannot be
+    // created without the GIL.
+    py::array_t<double> &PsTempArrChecked = workspace.PsTemp;
+    if (return_descriptor && average == "outer") {
+        allocated.add(reserveRows(PsTempArrChecked, {Hs, nFeatures}));
     }
 
-    // Loop through central points
-    for (int i = 0; i < Hs; i++) {
+    GILRelease release;
+
+    // Loop through central points. Each center only writes to its own row
+    // in Cs, so the centers are split between the native threads.
+    parallel_for(Hs, nChunks, [&](int begin, int end, int i_chunk) {
+      PhaseTimer neighboursTimer("SOAPPolynomial", "neighbours");
+      PhaseTimer expansionTimer("SOAPPolynomial", "expansion");
+      PhaseCounter neighboursCounter("SOAPPolynomial", "neighbours");
+      PolyScratch &s = scratch[i_chunk];
+      s.resize(nAtoms, nMax, lMax, return_derivatives);
+      for (int i = begin; i < end; i++) {
+        fill(Cs + i*nCoeffs, Cs + (i+1)*nCoeffs, 0.0);
+
+        // If computing derivatives with attach=True, index of the center atom is needed
+        int centerAtomI = (return_derivatives && attach) ? centerIndicesU(i) : -1;
 
         // Get all neighbours for the central atom i
+        neighboursTimer.start();
         double ix = Hpos[3*i];
         double iy = Hpos[3*i+1];
         double iz = Hpos[3*i+2];
-        CellListResult result = cellList.getNeighboursForPosition(ix, iy, iz);
+        cellList.getNeighboursForPosition(ix, iy, iz, s.neighbours);
 
-        // Sort the neighbours by type
-        map<int, vector<int>> atomicTypeMap;
-        for (const int &idx : result.indices) {
-            int Z = atomicNumbers(idx);
-            atomicTypeMap[Z].push_back(idx);
-        };
-
-        // Loop through neighbours sorted by type
-        for (const auto &ZIndexPair : atomicTypeMap) {
+        // Periodic systems can have more neighbours than atoms, in which case
+        // the scratch grows.
+        const int nFound = s.neighbours.indices.size();
+        neighboursCounter.add(nFound);
+        if (nFound > s.capacity) {
+            s.resize(nFound, nMax, lMax, return_derivatives);
+        }
 
-            // j is the internal index for this atomic number
-            int j = ZIndexMap[ZIndexPair.first];
+        // Sort the neighbours by species, after which the neighbours of each
+        // species form one contiguous range.
+        s.neighbours.sortByGroup(atomSpecies, Nt);
+        neighboursTimer.stop();
 
-            double* Ylmi; double* Flir; double* summed;
+        // Loop through the species that have neighbours. j is the internal
+        // index of the species.
+        expansionTimer.start();
+        for (int j = 0; j < Nt; ++j) {
+            const int first = s.neighbours.groupOffsets[j];
+            const int last = s.neighbours.groupOffsets[j + 1];
+            if (first == last) {
+                continue;
+            }
 
-            // Notice that due to the numerical integration the getDeltas
-            // function here has special functionality for positions that are
-            // centered on an atom.
-            pair<int, int> neighbours = getDeltas(dx, dy, dz, ris, rw, rCut, oOri, oO4arri, minExp, pluExp, eta, positions, ix, iy, iz, ZIndexPair.second, rsize, i, j);
+            // Notice that the getDeltas function has special functionality
+            // for positions that are centered on an atom.
+            pair<int, int> neighbours = getDeltas(s.dx, s.dy, s.dz, s.ris, s.oOri, s.indices, s.neighbours, first, last);
             int nNeighbours = neighbours.first;
             int nCenters = neighbours.second;
 
-            getWeights(nNeighbours + min(nCenters, 1), ris, NULL, false, weighting, weights);
-            Flir = getFlir(oO4arri, ris, minExp, pluExp, nNeighbours, rsize, lMax);
-            Ylmi = getYlmi(dx, dy, dz, oOri, cf, nNeighbours, lMax);
-            summed = getIntegrand(Flir, Ylmi, rsize, nNeighbours, lMax, weights);
-
-            getC(C, ws, rw2, gss, summed, rCut, lMax, rsize, nMax, nCenters, nNeighbours, eta, weights);
-            accumC(Cs, C, lMax, nMax, j, i, nCoeffs);
-            
-            free(Flir);
-            free(Ylmi);
-            free(summed);
+            // The radial integrals are interpolated from the table
+            for (int a = 0; a < nNeighbours; a++) {
+                radialTable.evaluate(s.ris[a], s.radial + a*nR, return_derivatives ? s.radialDev + a*nR : nullptr);
+            }
+
+            getWeights(nNeighbours + min(nCenters, 1), s.ris, NULL, false, weighting, s.weights);
+            getYlmi(s.Ylmi, s.legPol, s.ChiCos, s.ChiSin, s.dx, s.dy, s.dz, s.oOri, cf, nNeighbours, lMax);
+            getC(s.C, radialTable, s.radial, s.Ylmi, lMax, nMax, nNeighbours, nCenters, s.weights);
+            accumC(Cs, s.C, lMax, nMax, j, i, nCoeffs);
+
+            if (return_derivatives) {
+                getWeightDerivatives(nNeighbours, s.ris, weighting, s.dweights);
+                getCDev(cdevXMu, cdevYMu, cdevZMu, s, radialTable, cf, nMax, lMax, nNeighbours, nCenters, i, centerAtomI, j);
+            }
         }
+        expansionTimer.stop();
+      }
+    });
+
+    // Calculate the derivatives
+    if (return_derivatives) {
+        ScopedTimer timer("SOAPPolynomial", "derivatives");
+        getPDev(derivativesMu, positionsU, indicesU, cellListCenters, cdevXU, cdevYU, cdevZU, Cs, Nt, lMax, nMax, Hs, rCut2, crossover, nCoeffs);
     }
 
+    if (!return_descriptor) {
+        return;
+    }
+    ScopedTimer timer("SOAPPolynomial", "power_spectrum");
+
     // If inner averaging is requested, average the coefficients over the
     // positions (axis 0 in cnnd matrix) before calculating the power spectrum.
     if (average == "inner") {
-        for (int i = 0; i < Hs; i++) {
-            for (int j = 0; j < nCoeffs; j++) {
-                CsAve[j] += Cs[i*nCoeffs + j];
+        // Each thread sums a subset of the coefficients over all centers in
+        // order, so the result does not depend on the number of threads.
+        parallel_for(nCoeffs, [&](int begin, int end, int) {
+            for (int i = 0; i < Hs; i++) {
+                for (int j = begin; j < end; j++) {
+                    CsAve[j] += Cs[i*nCoeffs + j];
+                }
             }
-        }
-        for (int j = 0; j < nCoeffs; j++) {
-            CsAve[j] = CsAve[j] / (double)Hs;
-        }
+            for (int j = begin; j < end; j++) {
+                CsAve[j] = CsAve[j] / (double)Hs;
+            }
+        });
         getP(Ps, CsAve, Nt, lMax, nMax, 1, rCut2, nFeatures, crossover, nCoeffs);
-        free(CsAve);
     // Average the power spectrum across atoms
     } else if (average == "outer") {
-        // We allocate the memory and give array_t a pointer to it. This way
-        // the memory is owned and freed by C++.
-        double* PsTemp = new double[nFeatures*Hs];
-        py::array_t<double> PsTempArrChecked({Hs, nFeatures}, PsTemp);
         auto PsTempArr = PsTempArrChecked.mutable_unchecked<2>();
         getP(PsTempArr, Cs, Nt, lMax, nMax, Hs, rCut2, nFeatures, crossover, nCoeffs);
-        for (int i = 0; i < Hs; i++) {
-            for (int j = 0; j < nFeatures; j++) {
-                Ps(0, j) += PsTempArr(i, j);
+        parallel_for(nFeatures, [&](int begin, int end, int) {
+            for (int i = 0; i < Hs; i++) {
+                for (int j = begin; j < end; j++) {
+                    Ps(0, j) += PsTempArr(i, j);
+                }
             }
-        }
-        for (int j = 0; j < nFeatures; j++) {
-            Ps(0, j) = Ps(0, j) / (double)Hs;
-        }
-        free(PsTemp);
+            for (int j = begin; j < end; j++) {
+                Ps(0, j) = Ps(0, j) / (double)Hs;
+            }
+        });
     // Regular power spectrum without averaging
     } else {
         getP(Ps, Cs, Nt, lMax, nMax, Hs, rCut2, nFeatures, crossover, nCoeffs);
     }
 
-    free(Cs);
-    free(cf);
-    free(dx);
-    free(dy);
-    free(dz);
-    free(ris);
-    free(oOri);
-    free(ws);
-    free(oOr);
-    free(rw2) ;
-    free(oO4arri);
-    free(minExp);
-    free(pluExp);
-    free(C);
 }
@@ -20,43 +20,123 @@ limitations under the License.
 #include <pybind11/numpy.h>
 #include <string>
 #include "celllist.h"
+#include "weighting.h"
 
 namespace py = pybind11;
 using namespace std;
 
-double* factorListSet();
-double* getws();
+/**
+ * Scratch space for expanding the neighbourhood of a single center. The
+ * per-atom arrays hold capacity elements. For periodic systems a center may
+ * have more neighbours than there are atoms, so the capacity is increased
+ * when needed. One instance is needed per thread.
+ */
+struct PolyScratch {
+    void resize(int capacity, int nMax, int lMax, bool return_derivatives);
+
+    int capacity = 0;
+
+    vector<double> buffer;
+    double *dx, *dy, *dz, *ris, *weights, *oOri;
+    double *C, *Ylmi, *legPol, *ChiCos, *ChiSin;
+    double *radial, *dweights, *radialDev, *legDev;
+    vector<int> indices;
+    CellListNeighbours neighbours;
+};
+
+/**
+ * Buffers that are reused between calls to soapGeneral, including the
+ * constant tables of the spherical harmonics.
+ */
+struct PolyWorkspace {
+    void init();
+
+    vector<PolyScratch> scratch;
+    vector<double> cf;
+    vector<double> Cs;
+    vector<double> CsAve;
+    py::array_t<double> PsTemp;
+};
+
+/**
+ * The radial integrals of the polynomial basis. The integral of r^2*g_n(r)
+ * times the radial part of degree l of a Gaussian atom density only depends
+ * on the distance ri of the atom from the center. It is calculated once with
+ * the numerical quadrature for a uniform grid of distances, together with its
+ * derivative with respect to ri, and the values in between are given by a
+ * cubic Hermite interpolation.
+ */
+class PolyRadialTable {
+    public:
+        /**
+         * @param rw Points of the radial quadrature.
+         * @param gss Values of the radial basis functions at the points.
+         * @param rMax Largest tabulated distance.
+         * @param eta Inverse width of the atom density.
+         * @param rsize Number of points in the radial quadrature.
+         */
+        PolyRadialTable(const double* rw, const double* gss, double rMax, double eta, int rsize, int nMax, int lMax);
+
+        /**
+         * Writes the integrals of the distance ri to values[n*(lMax+1) + l]
+         * and their derivatives to derivatives, if it is not null.
+         */
+        void evaluate(double ri, double* values, double* derivatives) const;
+
+        /**
+         * Integrals and derivatives for an atom at the center.
+         */
+        const double* centerValues() const;
+        const double* centerDerivatives() const;
+
+    private:
+        int nValues;
+        int nPoints;
+        double spacing;
+        vector<double> table;
+};
+
+void factorListSet(double* c);
+void getws(double* c);
 inline double factorY(int l, int m, double* c);
-inline double* getoOr(double* r, int rsize);
-inline double* getrw2(double* r, int rsize);
-inline void expMs(double* rExpDiff, double eta, double* r, double* ri, int isize, int rsize);
-inline void expPs(double* rExpSum, double eta, double* r, double* ri, int isize, int rsize);
-pair<int, int> getDeltas(double* xNow, double* yNow, double* zNow, double* ri, double* rw, double rCut, double* oOri, double* oO4arri, double* minExp, double* pluExp,int* isCenter, double eta, const py::array_t<double> &positions, const double ix, const double iy, const double iz, const vector<int> &indices, int rsize, int Ihpos, int Itype);
-int getFilteredPos(double* xNow, double* yNow, double* zNow, double* ri, double* rw, double rCut, double* oOri, double* oO4arri, double* minExp, double* pluExp,int* isCenter, double eta, double* Apos, double* Hpos,int* typeNs, int rsize, int Ihpos, int Itype);
-double* getFlir(double* oO4arri,double* ri, double* minExp, double* pluExp, int icount, int rsize, int lMax);
+inline void expMs(double* rExpDiff, double eta, const double* r, const double* ri, int isize, int rsize);
+inline void expPs(double* rExpSum, double eta, const double* r, const double* ri, int isize, int rsize);
+pair<int, int> getDeltas(double* dx, double* dy, double* dz, double* ri, double* oOri, vector<int> &indices, const CellListNeighbours &neighbours, int begin, int end);
+void getFlir(double* Flir, double* oO4arri,double* ri, double* minExp, double* pluExp, int icount, int rsize, int lMax);
 double legendre_poly(int l, int m, double x);
-double* getYlmi(double* x, double* y, double* z, double* oOri, double* cf, int icount, int lMax);
-double* getIntegrand(double* Flir, double* Ylmi,int rsize, int icount, int lMax);
-void getC(double* Cs, double* ws, double* rw2, double * gns, double* summed, double rCut,int lMax, int rsize, int gnsize, int nCenters, int nNeighbours, double eta, double* weights);
+void getYlmi(double* Ylmi, double* legPol, double* ChiCos, double* ChiSin, double* x, double* y, double* z, double* oOri, double* cf, int icount, int lMax);
+void getC(double* C, const PolyRadialTable &radialTable, double* radial, double* Ylmi, int lMax, int nMax, int nNeighbours, int nCenters, double* weights);
 void accumC(double* Cs, double* C, int lMax, int gnsize, int typeI, int i, int nCoeffs);
 void getP(py::detail::unchecked_mutable_reference<double, 2> &Ps, double* Cts, int Nt, int lMax, int nMax, int Hs, double rCut2, int nFeatures, bool crossover, int nCoeffs);
+void getCDev(py::detail::unchecked_mutable_reference<double, 5> &CDevX, py::detail::unchecked_mutable_reference<double, 5> &CDevY, py::detail::unchecked_mutable_reference<double, 5> &CDevZ, PolyScratch &s, const PolyRadialTable &radialTable, double* cf, int nMax, int lMax, int nNeighbours, int nCenters, int i, int centerAtomI, int typeJ);
+void getPDev(py::detail::unchecked_mutable_reference<double, 4> &derivatives, py::detail::unchecked_reference<double, 2> &positions, py::detail::unchecked_reference<int, 1> &indices, const CellList &cellList, py::detail::unchecked_reference<double, 5> &CDevX, py::detail::unchecked_reference<double, 5> &CDevY, py::detail::unchecked_reference<double, 5> &CDevZ, double* Cs, int Nt, int lMax, int nMax, int Hs, double rCut2, bool crossover, int nCoeffs);
 void soapGeneral(
+    py::array_t<double> derivatives,
     py::array_t<double> PsArr,
+    py::array_t<double> cdevX,
+    py::array_t<double> cdevY,
+    py::array_t<double> cdevZ,
     py::array_t<double> positions,
     py::array_t<double> HposArr,
+    py::array_t<int> centerIndices,
     py::array_t<int> atomicNumbersArr,
     py::array_t<int> orderedSpeciesArr,
+    const vector<int> &speciesIndex,
     double rCut,
     double cutoffPadding,
     int nMax,
     int lMax,
-    double eta,
-    py::dict weighting,
-    py::array_t<double> rwArr,
-    py::array_t<double> gssArr,
+    const Weighting &weighting,
+    const PolyRadialTable &radialTable,
     bool crossover,
     string average,
-    CellList cellList
+    py::array_t<int> indices,
+    bool attach,
+    bool return_descriptor,
+    bool return_derivatives,
+    const CellList &cellList,
+    const CellList &cellListCenters,
+    PolyWorkspace &workspace
 );
 
 #endif
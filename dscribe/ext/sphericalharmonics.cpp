@@ -0,0 +1,184 @@
+/*Copyright 2019 DScribe developers
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include <cmath>
+#include "sphericalharmonics.h"
+
+using namespace std;
+
+#define PI 3.141592653589793238
+
+SolidHarmonics::SolidHarmonics(int lMax, int lMin)
+    : lMax(lMax)
+    , lMin(lMin)
+{
+    // The tables are indexed with l*(l+1)/2 + m for m >= 0. The factor
+    // (2m-1)!! of the associated Legendre polynomials is moved into the
+    // normalization, so that the recurrence in l starts from one.
+    const int size = (lMax + 1)*(lMax + 2)/2;
+    this->norms.resize(size);
+    this->a.resize(size);
+    this->b.resize(size);
+    for (int l = 0; l <= lMax; ++l) {
+        for (int m = 0; m <= l; ++m) {
+            double ratio = 1.0;
+            for (int k = l - m + 1; k <= l + m; ++k) {
+                ratio /= k;
+            }
+            for (int k = 1; k <= m; ++k) {
+                const double f = 2.0*k - 1.0;
+                ratio *= f*f;
+            }
+            double norm = sqrt((2*l + 1)/(4*PI)*ratio);
+            if (m > 0) {
+                norm *= sqrt(2.0);
+            }
+            const int index = l*(l + 1)/2 + m;
+            this->norms[index] = norm;
+            if (l >= m + 2) {
+                this->a[index] = (2*l - 1)/(double)(l - m);
+                this->b[index] = (l + m - 1)/(double)(l - m);
+            }
+        }
+    }
+}
+
+void SolidHarmonics::evaluate(
+    double* values,
+    double* dX,
+    double* dY,
+    double* dZ,
+    const double* x,
+    const double* y,
+    const double* z,
+    const double* r2,
+    int n,
+    int stride,
+    double* work,
+    bool return_derivatives
+) const
+{
+    // Real and imaginary parts of (x + iy)^m and (x + iy)^(m-1)
+    double* A = work;
+    double* B = work + n;
+    double* APrev = work + 2*n;
+    double* BPrev = work + 3*n;
+
+    // The Legendre part of the last three degrees and its partial
+    // derivatives with respect to z and r^2.
+    double* P[3] = {work + 4*n, work + 5*n, work + 6*n};
+    double* Pz[3] = {work + 7*n, work + 8*n, work + 9*n};
+    double* Ps[3] = {work + 10*n, work + 11*n, work + 12*n};
+
+    for (int i = 0; i < n; ++i) {
+        A[i] = 1.0;
+        B[i] = 0.0;
+    }
+    const int offset = lMin*lMin;
+    for (int m = 0; m <= lMax; ++m) {
+        if (m > 0) {
+            for (int i = 0; i < n; ++i) {
+                const double ap = A[i];
+                const double bp = B[i];
+                APrev[i] = ap;
+                BPrev[i] = bp;
+                A[i] = x[i]*ap - y[i]*bp;
+                B[i] = y[i]*ap + x[i]*bp;
+            }
+        }
+        for (int l = m; l <= lMax; ++l) {
+            const int index = l*(l + 1)/2 + m;
+            double* p = P[(l - m) % 3];
+            double* pz = Pz[(l - m) % 3];
+            double* ps = Ps[(l - m) % 3];
+            if (l == m) {
+                for (int i = 0; i < n; ++i) {
+                    p[i] = 1.0;
+                    pz[i] = 0.0;
+                    ps[i] = 0.0;
+                }
+            } else if (l == m + 1) {
+                const double c = 2*m + 1;
+                for (int i = 0; i < n; ++i) {
+                    p[i] = c*z[i];
+                    pz[i] = c;
+                    ps[i] = 0.0;
+                }
+            } else {
+                const double* p1 = P[(l - m + 2) % 3];
+                const double* p2 = P[(l - m + 1) % 3];
+                const double al = this->a[index];
+                const double bl = this->b[index];
+                if (return_derivatives) {
+                    const double* pz1 = Pz[(l - m + 2) % 3];
+                    const double* pz2 = Pz[(l - m + 1) % 3];
+                    const double* ps1 = Ps[(l - m + 2) % 3];
+                    const double* ps2 = Ps[(l - m + 1) % 3];
+                    for (int i = 0; i < n; ++i) {
+                        pz[i] = al*(p1[i] + z[i]*pz1[i]) - bl*r2[i]*pz2[i];
+                        ps[i] = al*z[i]*ps1[i] - bl*(p2[i] + r2[i]*ps2[i]);
+                    }
+                }
+                for (int i = 0; i < n; ++i) {
+                    p[i] = al*z[i]*p1[i] - bl*r2[i]*p2[i];
+                }
+            }
+            if (l < lMin) {
+                continue;
+            }
+
+            // The cosine part is stored at m and the sine part at -m.
+            const double norm = this->norms[index];
+            double* vc = values + stride*(l*l + l + m - offset);
+            double* vs = values + stride*(l*l + l - m - offset);
+            for (int i = 0; i < n; ++i) {
+                vc[i] = norm*p[i]*A[i];
+            }
+            if (m > 0) {
+                for (int i = 0; i < n; ++i) {
+                    vs[i] = norm*p[i]*B[i];
+                }
+            }
+            if (!return_derivatives) {
+                continue;
+            }
+            double* dXc = dX + stride*(l*l + l + m - offset);
+            double* dYc = dY + stride*(l*l + l + m - offset);
+            double* dZc = dZ + stride*(l*l + l + m - offset);
+            if (m == 0) {
+                for (int i = 0; i < n; ++i) {
+                    const double s2 = 2.0*ps[i];
+                    dXc[i] = norm*x[i]*s2;
+                    dYc[i] = norm*y[i]*s2;
+                    dZc[i] = norm*(pz[i] + z[i]*s2);
+                }
+                continue;
+            }
+            double* dXs = dX + stride*(l*l + l - m - offset);
+            double* dYs = dY + stride*(l*l + l - m - offset);
+            double* dZs = dZ + stride*(l*l + l - m - offset);
+            for (int i = 0; i < n; ++i) {
+                const double s2 = 2.0*ps[i];
+                const double pm = m*p[i];
+                const double zPart = pz[i] + z[i]*s2;
+                dXc[i] = norm*(x[i]*s2*A[i] + pm*APrev[i]);
+                dYc[i] = norm*(y[i]*s2*A[i] - pm*BPrev[i]);
+                dZc[i] = norm*zPart*A[i];
+                dXs[i] = norm*(x[i]*s2*B[i] + pm*BPrev[i]);
+                dYs[i] = norm*(y[i]*s2*B[i] + pm*APrev[i]);
+                dZs[i] = norm*zPart*B[i];
+            }
+        }
+    }
+}
@@ -0,0 +1,76 @@
+/*Copyright 2019 DScribe developers
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef SPHERICALHARMONICS_H
+#define SPHERICALHARMONICS_H
+
+#include <vector>
+
+using namespace std;
+
+/**
+ * Real regular solid harmonics r^l*Y_lm and their gradients for a batch of
+ * points. The orthonormal real spherical harmonics are used without the
+ * Condon-Shortley phase. The values are built with the recurrences of the
+ * associated Legendre polynomials in l and of (x + iy)^m in m, which only
+ * need polynomials of x, y, z and r^2 and thus have no singularity at the
+ * origin. Every step is a loop over the points, so that the compiler can
+ * vectorize it.
+ */
+class SolidHarmonics {
+    public:
+        /**
+         * @param lMax Maximum degree.
+         * @param lMin Minimum degree that is written to the output.
+         */
+        SolidHarmonics(int lMax, int lMin);
+
+        /**
+         * Evaluates the solid harmonics. The value of (l, m) for point i is
+         * written to values[stride*(l*l + l + m - lMin*lMin) + i] and the
+         * gradient to dX, dY and dZ in the same layout.
+         *
+         * @param x, y, z, r2 Coordinates of the points and their squared norm.
+         * @param n Number of points.
+         * @param stride Distance between two (l, m) rows in the output.
+         * @param work Scratch space for workSize*n values.
+         * @param return_derivatives Whether to calculate the gradients.
+         */
+        void evaluate(
+            double* values,
+            double* dX,
+            double* dY,
+            double* dZ,
+            const double* x,
+            const double* y,
+            const double* z,
+            const double* r2,
+            int n,
+            int stride,
+            double* work,
+            bool return_derivatives
+        ) const;
+
+        static const int workSize = 13;
+
+    private:
+        int lMax;
+        int lMin;
+        vector<double> norms;
+        vector<double> a;
+        vector<double> b;
+};
+
+#endif
@@ -0,0 +1,271 @@
+/*Copyright 2019 DScribe developers
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include "threadpool.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+using namespace std;
+
+GILRelease::GILRelease()
+    : state(PyGILState_Check() ? PyEval_SaveThread() : nullptr)
+{
+}
+
+GILRelease::~GILRelease()
+{
+    if (this->state) {
+        PyEval_RestoreThread(this->state);
+    }
+}
+
+namespace {
+
+/**
+ * Fixed set of worker threads that execute the chunks of one parallel_for
+ * call at a time.
+ */
+class ThreadPool {
+    public:
+        ThreadPool(int n_workers);
+        ~ThreadPool();
+        void run(int n_tasks, const function<void(int)> &task);
+
+    private:
+        void work();
+        void execute();
+
+        vector<thread> workers;
+        mutex m;
+        condition_variable start;
+        condition_variable done;
+        const function<void(int)>* task;
+        int n_tasks;
+        atomic<int> next;
+        int n_active;
+        unsigned long generation;
+        bool stop;
+        exception_ptr error;
+};
+
+// Set for the duration of a parallel region so that nested calls run serially.
+thread_local bool in_parallel_region = false;
+
+ThreadPool::ThreadPool(int n_workers)
+    : task(nullptr)
+    , n_tasks(0)
+    , next(0)
+    , n_active(0)
+    , generation(0)
+    , stop(false)
+{
+    for (int i = 0; i < n_workers; ++i) {
+        this->workers.emplace_back(&ThreadPool::work, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        lock_guard<mutex> lock(this->m);
+        this->stop = true;
+    }
+    this->start.notify_all();
+    for (thread &worker : this->workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::execute()
+{
+    in_parallel_region = true;
+    int i;
+    while ((i = this->next.fetch_add(1)) < this->n_tasks) {
+        try {
+            (*this->task)(i);
+        } catch (...) {
+            lock_guard<mutex> lock(this->m);
+            if (!this->error) {
+                this->error = current_exception();
+            }
+        }
+    }
+    in_parallel_region = false;
+}
+
+void ThreadPool::work()
+{
+    unsigned long seen = 0;
+    while (true) {
+        {
+            unique_lock<mutex> lock(this->m);
+            this->start.wait(lock, [&] { return this->stop || this->generation != seen; });
+            if (this->stop) {
+                return;
+            }
+            seen = this->generation;
+        }
+        this->execute();
+        {
+            lock_guard<mutex> lock(this->m);
+            --this->n_active;
+        }
+        this->done.notify_one();
+    }
+}
+
+void ThreadPool::run(int n_tasks, const function<void(int)> &task)
+{
+    {
+        lock_guard<mutex> lock(this->m);
+        this->task = &task;
+        this->n_tasks = n_tasks;
+        this->next = 0;
+        this->n_active = this->workers.size();
+        this->error = nullptr;
+        ++this->generation;
+    }
+    this->start.notify_all();
+    this->execute();
+    exception_ptr error;
+    {
+        unique_lock<mutex> lock(this->m);
+        this->done.wait(lock, [&] { return this->n_active == 0; });
+        error = this->error;
+        this->error = nullptr;
+    }
+    if (error) {
+        rethrow_exception(error);
+    }
+}
+
+int default_num_threads()
+{
+    const char* value = getenv("DSCRIBE_NUM_THREADS");
+    if (value == nullptr) {
+        return 1;
+    }
+    return atoi(value);
+}
+
+int hardware_threads()
+{
+    return max(1, (int)thread::hardware_concurrency());
+}
+
+// The pool is created lazily and replaced when the number of threads changes.
+// busy_mutex is held by whoever is currently running work on the pool.
+mutex config_mutex;
+mutex busy_mutex;
+int n_threads = 0;
+unique_ptr<ThreadPool> pool;
+pid_t pool_pid = 0;
+
+// Must be called with config_mutex held.
+int current_num_threads()
+{
+    if (n_threads == 0) {
+        int n = default_num_threads();
+        n_threads = n < 1 ? hardware_threads() : n;
+    }
+    return n_threads;
+}
+
+}
+
+int get_num_threads()
+{
+    lock_guard<mutex> lock(config_mutex);
+    return current_num_threads();
+}
+
+void set_num_threads(int n)
+{
+    // Wait for any running parallel region to finish before resizing.
+    GILRelease release;
+    lock_guard<mutex> busy(busy_mutex);
+    lock_guard<mutex> lock(config_mutex);
+    n_threads = n < 1 ? hardware_threads() : n;
+    pool.reset();
+}
+
+int get_num_chunks(int n)
+{
+    return max(1, min(n, get_num_threads()));
+}
+
+void parallel_for(int n, int n_chunks, const function<void(int, int, int)> &func)
+{
+    if (n <= 0) {
+        return;
+    }
+    n_chunks = max(1, min(n, n_chunks));
+    int chunk = n / n_chunks;
+    int remainder = n % n_chunks;
+    auto task = [&](int i_chunk) {
+        int begin = i_chunk*chunk + min(i_chunk, remainder);
+        int end = begin + chunk + (i_chunk < remainder ? 1 : 0);
+        func(begin, end, i_chunk);
+    };
+
+    // Serial execution when only one chunk is needed, when called from inside
+    // a parallel region or when another caller is using the pool. As with the
+    // pool, all chunks are run before the first exception is rethrown.
+    unique_lock<mutex> busy(busy_mutex, defer_lock);
+    if (n_chunks == 1 || in_parallel_region || !busy.try_lock()) {
+        exception_ptr error;
+        for (int i = 0; i < n_chunks; ++i) {
+            try {
+                task(i);
+            } catch (...) {
+                if (!error) {
+                    error = current_exception();
+                }
+            }
+        }
+        if (error) {
+            rethrow_exception(error);
+        }
+        return;
+    }
+    ThreadPool* current;
+    {
+        lock_guard<mutex> lock(config_mutex);
+
+        // The worker threads do not survive a fork, so a child process
+        // abandons the inherited pool and starts its own.
+        if (pool && pool_pid != getpid()) {
+            pool.release();
+        }
+        if (!pool) {
+            pool.reset(new ThreadPool(current_num_threads() - 1));
+            pool_pid = getpid();
+        }
+        current = pool.get();
+    }
+    current->run(n_chunks, task);
+}
+
+void parallel_for(int n, const function<void(int, int, int)> &func)
+{
+    parallel_for(n, get_num_chunks(n), func);
+}
@@ -0,0 +1,76 @@
+/*Copyright 2019 DScribe developers
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <pybind11/pybind11.h>
+#include <functional>
+
+namespace py = pybind11;
+using namespace std;
+
+/**
+ * Releases the GIL for the lifetime of the object, but only if the calling
+ * thread is holding it. Unlike py::gil_scoped_release this can be safely
+ * nested and used from the native worker threads, which never hold the GIL.
+ * No Python objects may be touched while an instance is alive.
+ */
+class GILRelease {
+    public:
+        GILRelease();
+        ~GILRelease();
+        GILRelease(const GILRelease&) = delete;
+        GILRelease& operator=(const GILRelease&) = delete;
+
+    private:
+        PyThreadState* state;
+};
+
+/**
+ * Returns the number of threads used by the native kernels.
+ */
+int get_num_threads();
+
+/**
+ * Sets the number of threads used by the native kernels. The initial value is
+ * read from the DSCRIBE_NUM_THREADS environment variable and defaults to one.
+ * A value smaller than one selects the number of hardware threads.
+ */
+void set_num_threads(int n_threads);
+
+/**
+ * Returns the number of chunks that parallel_for splits a range of size n
+ * into. Use it to allocate per-chunk scratch space or partial results.
+ */
+int get_num_chunks(int n);
+
+/**
+ * Splits the range [0, n) into n_chunks contiguous chunks and calls
+ * func(begin, end, i_chunk) for each of them using the native thread pool.
+ * The calling thread takes part in the work. The chunk boundaries only depend
+ * on n and n_chunks, so per-chunk results that are reduced in chunk order are
+ * deterministic. Nested calls, and calls made while the pool is busy with
+ * another caller, run the chunks serially in the calling thread. The first
+ * exception thrown by func is rethrown once all chunks have finished.
+ */
+void parallel_for(int n, int n_chunks, const function<void(int, int, int)> &func);
+
+/**
+ * Same as above with n_chunks = get_num_chunks(n).
+ */
+void parallel_for(int n, const function<void(int, int, int)> &func);
+
+#endif
@@ -0,0 +1,282 @@
+/*Copyright 2019 DScribe developers
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#include "trajectory.h"
+#include "threadpool.h"
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+using namespace Eigen;
+
+Trajectory::Trajectory(const Descriptor &descriptor, double skin, double tolerance)
+    : skin(skin)
+    , tolerance(tolerance)
+    , n_frames(0)
+    , n_rebuilds(0)
+    , n_computed_centers(0)
+    , descriptor(descriptor)
+    , periodic(false)
+{
+    if (skin < 0) {
+        throw invalid_argument("The skin cannot be negative.");
+    }
+    if (tolerance > 0 && descriptor.average != "off") {
+        throw invalid_argument("The output of the centers can only be reused without averaging.");
+    }
+}
+
+void Trajectory::reset()
+{
+    this->cell_list.reset();
+    this->neighbourhoods.clear();
+    this->rows.clear();
+}
+
+double Trajectory::move(vector<double> &unwrapped, vector<double> &previous, const vector<double> &reference, const double* coordinates, int n) const
+{
+    double max_distance_squared = 0;
+    for (int i = 0; i < n; ++i) {
+        double d[3];
+        for (int k = 0; k < 3; ++k) {
+            d[k] = coordinates[3*i + k] - previous[3*i + k];
+        }
+
+        // Atoms that were wrapped into the cell are moved back next to their
+        // previous position.
+        if (this->periodic) {
+            double f[3];
+            for (int j = 0; j < 3; ++j) {
+                f[j] = 0;
+                for (int k = 0; k < 3; ++k) {
+                    f[j] += d[k]*this->inverse_cell[3*k + j];
+                }
+                if (this->pbc[j]) {
+                    f[j] -= round(f[j]);
+                }
+            }
+            for (int k = 0; k < 3; ++k) {
+                d[k] = 0;
+                for (int j = 0; j < 3; ++j) {
+                    d[k] += f[j]*this->cell[3*j + k];
+                }
+            }
+        }
+
+        double distance_squared = 0;
+        for (int k = 0; k < 3; ++k) {
+            unwrapped[3*i + k] += d[k];
+            previous[3*i + k] = coordinates[3*i + k];
+            double r = unwrapped[3*i + k] - reference[3*i + k];
+            distance_squared += r*r;
+        }
+        max_distance_squared = max(max_distance_squared, distance_squared);
+    }
+    return max_distance_squared;
+}
+
+vector<int> Trajectory::get_changed_centers()
+{
+    const int n_centers = this->neighbourhoods.size();
+    const double tolerance_squared = this->tolerance*this->tolerance;
+    vector<char> changed(n_centers, 0);
+    {
+        GILRelease release;
+        parallel_for(n_centers, [&](int begin, int end, int) {
+            CellListNeighbours neighbours;
+            vector<int> order;
+            for (int i = begin; i < end; ++i) {
+                const double* center = &this->centers[3*i];
+                this->cell_list->getNeighboursForPosition(center[0], center[1], center[2], neighbours);
+                const int n_found = neighbours.indices.size();
+                order.resize(n_found);
+                for (int k = 0; k < n_found; ++k) {
+                    order[k] = k;
+                }
+                sort(order.begin(), order.end(), [&](int a, int b) {
+                    if (neighbours.images[a] != neighbours.images[b]) {
+                        return neighbours.images[a] < neighbours.images[b];
+                    }
+                    return neighbours.indices[a] < neighbours.indices[b];
+                });
+
+                // The center is kept if it has the same neighbours and
+                // none of them has moved too much relative to the center.
+                CenterNeighbourhood &neighbourhood = this->neighbourhoods[i];
+                bool same = neighbourhood.valid && (int)neighbourhood.indices.size() == n_found;
+                for (int k = 0; same && k < n_found; ++k) {
+                    const int q = order[k];
+                    const double* stored = &neighbourhood.displacements[3*k];
+                    const double ex = neighbours.dx[q] - stored[0];
+                    const double ey = neighbours.dy[q] - stored[1];
+                    const double ez = neighbours.dz[q] - stored[2];
+                    same = neighbourhood.indices[k] == neighbours.indices[q]
+                        && neighbourhood.images[k] == neighbours.images[q]
+                        && ex*ex + ey*ey + ez*ez <= tolerance_squared;
+                }
+                if (same) {
+                    continue;
+                }
+
+                // The output of the center is calculated again, so its
+                // current neighbourhood is stored for the next frames.
+                changed[i] = 1;
+                neighbourhood.valid = true;
+                neighbourhood.indices.resize(n_found);
+                neighbourhood.images.resize(n_found);
+                neighbourhood.displacements.resize(3*n_found);
+                for (int k = 0; k < n_found; ++k) {
+                    const int q = order[k];
+                    neighbourhood.indices[k] = neighbours.indices[q];
+                    neighbourhood.images[k] = neighbours.images[q];
+                    neighbourhood.displacements[3*k] = neighbours.dx[q];
+                    neighbourhood.displacements[3*k + 1] = neighbours.dy[q];
+                    neighbourhood.displacements[3*k + 2] = neighbours.dz[q];
+                }
+            }
+        });
+    }
+
+    vector<int> changed_centers;
+    for (int i = 0; i < n_centers; ++i) {
+        if (changed[i]) {
+            changed_centers.push_back(i);
+        }
+    }
+    return changed_centers;
+}
+
+void Trajectory::create(
+    py::array_t<double> out,
+    py::array_t<double, py::array::c_style | py::array::forcecast> positions,
+    py::array_t<int, py::array::c_style | py::array::forcecast> atomic_numbers,
+    py::array_t<double, py::array::c_style | py::array::forcecast> cell,
+    py::array_t<bool, py::array::c_style | py::array::forcecast> pbc,
+    py::array_t<double, py::array::c_style | py::array::forcecast> centers
+)
+{
+    if (positions.ndim() != 2 || positions.shape(1) != 3 || atomic_numbers.size() != positions.shape(0)) {
+        throw invalid_argument("The positions must have the shape (n_atoms, 3) and there must be one atomic number for each atom.");
+    }
+    if (centers.ndim() != 2 || centers.shape(1) != 3) {
+        throw invalid_argument("The centers must have the shape (n_centers, 3).");
+    }
+    if (cell.size() != 9 || pbc.size() != 3) {
+        throw invalid_argument("The cell must have the shape (3, 3) and the pbc three components.");
+    }
+    const int n_atoms = positions.shape(0);
+    const int n_centers = centers.shape(0);
+    const int n_features = this->descriptor.get_number_of_features();
+    const bool reuse = this->tolerance > 0;
+    if (reuse && (out.ndim() != 2 || out.shape(0) != n_centers || out.shape(1) != n_features)) {
+        throw invalid_argument("The output must have the shape (n_centers, n_features).");
+    }
+    const int* atomic_numbers_p = atomic_numbers.data();
+    const double* cell_p = cell.data();
+    const bool* pbc_p = pbc.data();
+    const bool is_periodic = this->descriptor.periodic && (pbc_p[0] || pbc_p[1] || pbc_p[2]);
+
+    // The list is rebuilt if the system has changed in any other way than by
+    // the motion of the atoms and centers.
+    bool rebuild = !this->cell_list
+        || is_periodic != this->periodic
+        || (int)this->centers.size() != 3*n_centers
+        || (int)this->atomic_numbers.size() != n_atoms
+        || !equal(this->atomic_numbers.begin(), this->atomic_numbers.end(), atomic_numbers_p)
+        || !equal(this->cell.begin(), this->cell.end(), cell_p)
+        || !equal(this->pbc.begin(), this->pbc.end(), pbc_p);
+    if (!rebuild) {
+        const double atom_distance = this->move(this->positions, this->previous_positions, this->reference_positions, positions.data(), n_atoms);
+        const double center_distance = this->move(this->centers, this->previous_centers, this->reference_centers, centers.data(), n_centers);
+        rebuild = 4*max(atom_distance, center_distance) > this->skin*this->skin;
+    }
+
+    if (rebuild) {
+        this->periodic = is_periodic;
+        this->atomic_numbers.assign(atomic_numbers_p, atomic_numbers_p + n_atoms);
+        this->cell.assign(cell_p, cell_p + 9);
+        this->pbc.assign(pbc_p, pbc_p + 3);
+        if (is_periodic) {
+            Map<const Matrix<double, 3, 3, RowMajor>> cell_m(cell_p);
+            if (cell_m.determinant() == 0) {
+                throw invalid_argument("The cell of a periodic system cannot be singular.");
+            }
+            Matrix<double, 3, 3, RowMajor> inverse = cell_m.inverse();
+            this->inverse_cell.assign(inverse.data(), inverse.data() + 9);
+        }
+        this->positions.assign(positions.data(), positions.data() + 3*n_atoms);
+        this->previous_positions = this->positions;
+        this->reference_positions = this->positions;
+        this->centers.assign(centers.data(), centers.data() + 3*n_centers);
+        this->previous_centers = this->centers;
+        this->reference_centers = this->centers;
+        if (is_periodic) {
+            this->cell_list.reset(new CellList(positions, this->descriptor.cutoff, this->skin, cell, pbc));
+        } else {
+            this->cell_list.reset(new CellList(positions, this->descriptor.cutoff, this->skin));
+        }
+        this->neighbourhoods.assign(n_centers, CenterNeighbourhood());
+        this->rows.assign((size_t)n_centers*n_features, 0.0);
+        ++this->n_rebuilds;
+    } else {
+        for (int i = 0; i < n_atoms; ++i) {
+            const double* position = &this->positions[3*i];
+            this->cell_list->setPosition(i, position[0], position[1], position[2]);
+        }
+    }
+    ++this->n_frames;
+    if (n_centers == 0) {
+        return;
+    }
+
+    // The descriptor sees the unwrapped positions, which are the ones stored
+    // in the Verlet list.
+    py::array_t<double> positions_unwrapped({n_atoms, 3}, this->positions.data());
+    if (!reuse) {
+        py::array_t<double> centers_unwrapped({n_centers, 3}, this->centers.data());
+        this->descriptor.create(out, positions_unwrapped, atomic_numbers, centers_unwrapped, *this->cell_list);
+        this->n_computed_centers += n_centers;
+        return;
+    }
+
+    // Only the centers whose neighbourhood has changed are calculated, and
+    // the rest are copied from the stored rows.
+    vector<int> changed = this->get_changed_centers();
+    const int n_changed = changed.size();
+    if (n_changed > 0) {
+        py::array_t<double> changed_centers({n_changed, 3});
+        py::array_t<double> changed_out({n_changed, n_features});
+        auto changed_centers_mu = changed_centers.mutable_unchecked<2>();
+        for (int i = 0; i < n_changed; ++i) {
+            for (int k = 0; k < 3; ++k) {
+                changed_centers_mu(i, k) = this->centers[3*changed[i] + k];
+            }
+        }
+        fill(changed_out.mutable_data(), changed_out.mutable_data() + changed_out.size(), 0.0);
+        this->descriptor.create(changed_out, positions_unwrapped, atomic_numbers, changed_centers, *this->cell_list);
+        const double* changed_out_p = changed_out.data();
+        for (int i = 0; i < n_changed; ++i) {
+            copy(changed_out_p + (size_t)i*n_features, changed_out_p + (size_t)(i + 1)*n_features, this->rows.begin() + (size_t)changed[i]*n_features);
+        }
+        this->n_computed_centers += n_changed;
+    }
+    auto out_mu = out.mutable_unchecked<2>();
+    for (int i = 0; i < n_centers; ++i) {
+        for (int j = 0; j < n_features; ++j) {
+            out_mu(i, j) = this->rows[(size_t)i*n_features + j];
+        }
+    }
+}
@@ -0,0 +1,119 @@
+/*Copyright 2019 DScribe developers
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#ifndef TRAJECTORY_H
+#define TRAJECTORY_H
+
+#include <pybind11/numpy.h>
+#include <memory>
+#include <vector>
+#include "celllist.h"
+#include "descriptor.h"
+
+namespace py = pybind11;
+using namespace std;
+
+/**
+ * Neighbourhood of a center at the time its output was last calculated. The
+ * neighbours are sorted by periodic image and atom index.
+ */
+struct CenterNeighbourhood {
+    bool valid = false;
+    vector<int> indices;
+    vector<int> images;
+    vector<double> displacements;
+};
+
+/**
+ * Creates the output of a local descriptor for consecutive frames of a
+ * trajectory. The neighbours are searched from a Verlet list: a cell list
+ * whose bins are extended by a skin distance. The list is only rebuilt when
+ * an atom or a center has moved more than half of the skin since the
+ * previous rebuild, or when the atomic numbers, the cell or the periodicity
+ * change. Otherwise the atoms are just moved within their bins.
+ *
+ * Atoms that are wrapped back into the cell between two frames are followed
+ * with the minimum image convention, so the atoms should move less than half
+ * of the cell between consecutive frames.
+ */
+class Trajectory {
+    public:
+        /**
+         * Constructor
+         *
+         * @param descriptor The descriptor that is calculated. Must stay
+         * alive as long as the trajectory is used.
+         * @param skin Distance by which the Verlet list extends the cutoff.
+         * @param tolerance If positive, the output of a center is reused
+         * from the frame in which it was last calculated as long as it has
+         * the same neighbours and none of their displacements from the
+         * center has changed by more than the tolerance. Only supported
+         * without averaging.
+         */
+        Trajectory(const Descriptor &descriptor, double skin, double tolerance);
+        /**
+         * Creates the output for the next frame. The arguments are the same
+         * as for Descriptor::create.
+         */
+        void create(
+            py::array_t<double> out,
+            py::array_t<double, py::array::c_style | py::array::forcecast> positions,
+            py::array_t<int, py::array::c_style | py::array::forcecast> atomic_numbers,
+            py::array_t<double, py::array::c_style | py::array::forcecast> cell,
+            py::array_t<bool, py::array::c_style | py::array::forcecast> pbc,
+            py::array_t<double, py::array::c_style | py::array::forcecast> centers
+        );
+        /**
+         * Forgets the previous frames, after which the next frame rebuilds
+         * the Verlet list and calculates all centers.
+         */
+        void reset();
+
+        const double skin;
+        const double tolerance;
+        int n_frames;
+        int n_rebuilds;
+        long n_computed_centers;
+
+    private:
+        /**
+         * Updates the unwrapped coordinates with the displacements between the
+         * previous and the given frame and returns the largest squared
+         * distance from the coordinates at the last rebuild.
+         */
+        double move(vector<double> &unwrapped, vector<double> &previous, const vector<double> &reference, const double* coordinates, int n) const;
+        /**
+         * Finds the neighbours of the centers and returns the indices of the
+         * centers whose output needs to be calculated again.
+         */
+        vector<int> get_changed_centers();
+
+        const Descriptor &descriptor;
+        unique_ptr<CellList> cell_list;
+        bool periodic;
+        vector<int> atomic_numbers;
+        vector<double> cell;
+        vector<double> inverse_cell;
+        vector<bool> pbc;
+        vector<double> positions;
+        vector<double> previous_positions;
+        vector<double> reference_positions;
+        vector<double> centers;
+        vector<double> previous_centers;
+        vector<double> reference_centers;
+        vector<CenterNeighbourhood> neighbourhoods;
+        vector<double> rows;
+};
+
+#endif
@@ -1,74 +1,122 @@
-#include <functional>
+#include <stdexcept>
 #include "weighting.h"
 namespace py = pybind11;
 using namespace std;
 
+/**
+ * Parses the weighting dictionary given from python.
+ */
+Weighting parseWeighting(const py::dict &weighting) {
+    Weighting parsed;
+    if (weighting.contains("w0")) {
+        parsed.has_w0 = true;
+        parsed.w0 = weighting["w0"].cast<double>();
+    }
+    if (weighting.contains("function")) {
+        string fname = weighting["function"].cast<string>();
+        if (fname == "poly") {
+            parsed.function = WeightingFunction::Poly;
+            parsed.r0 = weighting["r0"].cast<double>();
+            parsed.c = weighting["c"].cast<double>();
+            parsed.m = weighting["m"].cast<double>();
+        } else if (fname == "pow") {
+            parsed.function = WeightingFunction::Pow;
+            parsed.r0 = weighting["r0"].cast<double>();
+            parsed.c = weighting["c"].cast<double>();
+            parsed.d = weighting["d"].cast<double>();
+            parsed.m = weighting["m"].cast<double>();
+        } else if (fname == "exp") {
+            parsed.function = WeightingFunction::Exp;
+            parsed.r0 = weighting["r0"].cast<double>();
+            parsed.c = weighting["c"].cast<double>();
+            parsed.d = weighting["d"].cast<double>();
+        } else {
+            throw invalid_argument("Unknown weighting function '" + fname + "'.");
+        }
+    }
+    return parsed;
+}
+
+/**
+ * Writes func(r) for every distance. If hasCenterValue is set, atoms at the
+ * center get the value centerValue instead. The function is a template
+ * argument so that it is inlined into the loop.
+ */
+template <typename Function>
+inline void applyWeighting(int size, const double* r1s, bool hasCenterValue, double centerValue, Function func, double* out) {
+    if (hasCenterValue) {
+        for (int i = 0; i < size; i++) {
+            const double r = r1s[i];
+            out[i] = r == 0 ? centerValue : func(r);
+        }
+    } else {
+        for (int i = 0; i < size; i++) {
+            out[i] = func(r1s[i]);
+        }
+    }
+}
+
 /**
  * Used to calculate the Gaussian weights for each neighbouring atom. Provide
  * either r1s (=r) or r2s (=r^2) and use the boolean "squared" to indicate if
  * r1s should be calculated from r2s.
  */
-void getWeights(int size, double* r1s, double* r2s, const bool squared, const py::dict &weighting, double* weights) {
+void getWeights(int size, double* r1s, double* r2s, const bool squared, const Weighting &weighting, double* weights) {
     // No weighting specified
-    if (!weighting.contains("function") && !weighting.contains("w0")) {
+    if (weighting.function == WeightingFunction::None && !weighting.has_w0) {
         for (int i = 0; i < size; i++) {
             weights[i] = 1;
         }
-    } else {
-        // No weighting function, only w0
-        if (squared) {
-            for (int i = 0; i < size; i++) {
-                r1s[i] = sqrt(r2s[i]);
-            }
+        return;
+    }
+    if (squared) {
+        for (int i = 0; i < size; i++) {
+            r1s[i] = sqrt(r2s[i]);
         }
-        if (!weighting.contains("function") && weighting.contains("w0")) {
-            double w0 = weighting["w0"].cast<double>();
+    }
+    const double r0 = weighting.r0;
+    const double c = weighting.c;
+    const double d = weighting.d;
+    const double m = weighting.m;
+    switch (weighting.function) {
+        case WeightingFunction::None:
+            applyWeighting(size, r1s, true, weighting.w0, [](double) {return 1.0;}, weights);
+            break;
+        case WeightingFunction::Poly:
+            applyWeighting(size, r1s, weighting.has_w0, weighting.w0, [r0, c, m](double r) {return weightPoly(r, r0, c, m);}, weights);
+            break;
+        case WeightingFunction::Pow:
+            applyWeighting(size, r1s, weighting.has_w0, weighting.w0, [r0, c, d, m](double r) {return weightPow(r, r0, c, d, m);}, weights);
+            break;
+        case WeightingFunction::Exp:
+            applyWeighting(size, r1s, weighting.has_w0, weighting.w0, [r0, c, d](double r) {return weightExp(r, r0, c, d);}, weights);
+            break;
+    }
+}
+
+/**
+ * Used to calculate the derivatives of the weights with respect to the
+ * distance r1s. The weight w0 of atoms at the center is constant.
+ */
+void getWeightDerivatives(int size, double* r1s, const Weighting &weighting, double* dweights) {
+    const double r0 = weighting.r0;
+    const double c = weighting.c;
+    const double d = weighting.d;
+    const double m = weighting.m;
+    switch (weighting.function) {
+        case WeightingFunction::None:
             for (int i = 0; i < size; i++) {
-                double r = r1s[i];
-                if (r == 0) {
-                    weights[i] = w0;
-                } else {
-                    weights[i] = 1;
-                }
+                dweights[i] = 0;
             }
-        } else {
-            function<double (double)> func;
-            string fname = weighting["function"].cast<string>();
-            if (fname == "poly") {
-                double r0 = weighting["r0"].cast<double>();
-                double c = weighting["c"].cast<double>();
-                double m = weighting["m"].cast<double>();
-                func = [r0, c, m](double r) {return weightPoly(r, r0, c, m);};
-            } else if (fname == "pow") {
-                double r0 = weighting["r0"].cast<double>();
-                double c = weighting["c"].cast<double>();
-                double d = weighting["d"].cast<double>();
-                double m = weighting["m"].cast<double>();
-                func = [r0, c, d, m](double r) {return weightPow(r, r0, c, d, m);};
-            } else if (fname == "exp") {
-                double r0 = weighting["r0"].cast<double>();
-                double c = weighting["c"].cast<double>();
-                double d = weighting["d"].cast<double>();
-                func = [r0, c, d](double r) {return weightExp(r, r0, c, d);};
-            }
-            // Weighting function and w0
-            if (weighting.contains("w0")) {
-                double w0 = weighting["w0"].cast<double>();
-                for (int i = 0; i < size; i++) {
-                    double r = r1s[i];
-                    if (r == 0) {
-                        weights[i] = w0;
-                    } else {
-                        weights[i] = func(r);
-                    }
-                }
-            // Weighting function only
-            } else {
-                for (int i = 0; i < size; i++) {
-                    double r = r1s[i];
-                    weights[i] = func(r);
-                }
-            }
-        }
+            return;
+        case WeightingFunction::Poly:
+            applyWeighting(size, r1s, weighting.has_w0, 0.0, [r0, c, m](double r) {return weightPolyDerivative(r, r0, c, m);}, dweights);
+            break;
+        case WeightingFunction::Pow:
+            applyWeighting(size, r1s, weighting.has_w0, 0.0, [r0, c, d, m](double r) {return weightPowDerivative(r, r0, c, d, m);}, dweights);
+            break;
+        case WeightingFunction::Exp:
+            applyWeighting(size, r1s, weighting.has_w0, 0.0, [r0, c, d](double r) {return weightExpDerivative(r, r0, c, d);}, dweights);
+            break;
     }
 }
@@ -2,8 +2,35 @@
 #define WEIGHTING_H
 
 #include <cmath>
+#include <string>
 #include <pybind11/pybind11.h>
 
+/**
+ * The radial weighting functions that are available.
+ */
+enum class WeightingFunction { None, Poly, Pow, Exp };
+
+/**
+ * Typed copy of the weighting dictionary. The descriptors parse the
+ * dictionary once when they are constructed, so that the weights are
+ * evaluated without touching any Python objects and invalid settings are
+ * reported before any calculation.
+ */
+struct Weighting {
+    WeightingFunction function = WeightingFunction::None;
+    bool has_w0 = false;
+    double w0 = 1;
+    double r0 = 1;
+    double c = 1;
+    double d = 1;
+    double m = 1;
+};
+
+/**
+ * Parses the weighting dictionary given from python.
+ */
+Weighting parseWeighting(const pybind11::dict &weighting);
+
 /**
  * Polynomial weighting of the form:
  * w(r) = c * (1 + 2(r/r0)^3 - 3(r/r0)^2)^m, if r <= r0, 0 otherwise
@@ -36,11 +63,48 @@ inline double weightExp(const double r, const double r0, const double c, const d
     const double rr0 = r / r0;
     return c / (d + exp(-rr0));
 }
+/**
+ * Derivative of weightPoly with respect to r.
+ */
+inline double weightPolyDerivative(const double r, const double r0, const double c, const double m)
+{
+    if (r > r0) {
+        return 0;
+    }
+    const double rr0 = r / r0;
+    const double rr02 = rr0 * rr0;
+    const double rr03 = rr02 * rr0;
+    return c * m * pow(1 + 2*rr03 - 3*rr02, m - 1) * (6*rr02 - 6*rr0) / r0;
+}
+/**
+ * Derivative of weightPow with respect to r.
+ */
+inline double weightPowDerivative(const double r, const double r0, const double c, const double d, const double m)
+{
+    const double rr0 = r / r0;
+    const double denominator = d + pow(rr0, m);
+    return -c * m * pow(rr0, m - 1) / (r0 * denominator * denominator);
+}
+/**
+ * Derivative of weightExp with respect to r.
+ */
+inline double weightExpDerivative(const double r, const double r0, const double c, const double d)
+{
+    const double e = exp(-r / r0);
+    const double denominator = d + e;
+    return c * e / (r0 * denominator * denominator);
+}
 /**
  * Used to calculate the Gaussian weights for each neighbouring atom. Provide
  * either r1s (=r) or r2s (=r^2) and use the boolean "squared" to indicate if
  * r1s should be calculated from r2s.
  */
-void getWeights(int size, double* r1s, double* r2s, const bool squared, const pybind11::dict &weighting, double* weights);
+void getWeights(int size, double* r1s, double* r2s, const bool squared, const Weighting &weighting, double* weights);
+
+/**
+ * Used to calculate the derivatives of the weights with respect to the
+ * distance r1s. The weight w0 of atoms at the center is constant.
+ */
+void getWeightDerivatives(int size, double* r1s, const Weighting &weighting, double* dweights);
 
 #endif
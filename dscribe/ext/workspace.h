@@ -0,0 +1,120 @@
+/*Copyright 2019 DScribe developers
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef WORKSPACE_H
+#define WORKSPACE_H
+
+#include <pybind11/numpy.h>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace py = pybind11;
+using namespace std;
+
+/**
+ * Thread-safe pool of reusable workspaces. Each calculation checks out a
+ * workspace of its own, so concurrent callers never share one. The
+ * workspaces keep their buffers between calls: they grow to the largest
+ * system seen and after that the calculations stop allocating. Copies of a
+ * pool start out empty.
+ */
+template <typename T>
+class WorkspacePool {
+    public:
+        /**
+         * Gives access to a checked out workspace and returns it to the pool
+         * when destroyed.
+         */
+        class Lease {
+            public:
+                Lease(WorkspacePool &pool, unique_ptr<T> workspace)
+                    : pool(pool)
+                    , workspace(move(workspace))
+                {
+                }
+                Lease(Lease &&other) = default;
+                Lease(const Lease&) = delete;
+                Lease& operator=(const Lease&) = delete;
+                ~Lease()
+                {
+                    if (this->workspace) {
+                        this->pool.release(move(this->workspace));
+                    }
+                }
+                T& operator*() const {return *this->workspace;};
+                T* operator->() const {return this->workspace.get();};
+
+            private:
+                WorkspacePool &pool;
+                unique_ptr<T> workspace;
+        };
+
+        WorkspacePool() {};
+        WorkspacePool(const WorkspacePool&) {};
+        WorkspacePool& operator=(const WorkspacePool&) {return *this;};
+
+        /**
+         * Checks out a workspace, creating a new one if all of them are in
+         * use.
+         */
+        Lease acquire()
+        {
+            unique_ptr<T> workspace;
+            {
+                lock_guard<mutex> lock(this->m);
+                if (!this->available.empty()) {
+                    workspace = move(this->available.back());
+                    this->available.pop_back();
+                }
+            }
+            if (!workspace) {
+                workspace.reset(new T());
+            }
+            return Lease(*this, move(workspace));
+        }
+
+    private:
+        void release(unique_ptr<T> workspace)
+        {
+            lock_guard<mutex> lock(this->m);
+            this->available.push_back(move(workspace));
+        }
+
+        mutex m;
+        vector<unique_ptr<T>> available;
+};
+
+/**
+ * Makes sure that the given C-contiguous array has at least shape[0] rows and
+ * otherwise the given shape. The array is only reallocated when it is too
+ * small, so it may end up having more rows than requested. Returns the number
+ * of allocated bytes, which is zero when the array is reused. Needs the GIL.
+ */
+inline size_t reserveRows(py::array_t<double> &array, const vector<ssize_t> &shape)
+{
+    bool fits = array.ndim() == (ssize_t)shape.size() && array.shape(0) >= shape[0];
+    for (size_t i = 1; fits && i < shape.size(); ++i) {
+        fits = array.shape(i) == shape[i];
+    }
+    if (fits) {
+        return 0;
+    }
+    array = py::array_t<double>(shape);
+    return array.nbytes();
+}
+
+#endif
@@ -16,6 +16,8 @@ limitations under the License.
 import numpy as np
 from dscribe.kernels.localsimilaritykernel import LocalSimilarityKernel
 
+import dscribe.ext
+
 
 class AverageKernel(LocalSimilarityKernel):
     """Used to compute a global similarity of structures based on the average
@@ -45,3 +47,19 @@ class AverageKernel(LocalSimilarityKernel):
         K_ij = np.mean(localkernel)
 
         return K_ij
+
+    def get_extension(self, n_features):
+        """Returns the C++ extension for this kernel. Subclasses that change
+        the pairwise or the global similarity are calculated in python.
+
+        Args:
+            n_features(int): The number of local features.
+        """
+        cls = type(self)
+        if (
+            cls.get_pairwise_matrix is not LocalSimilarityKernel.get_pairwise_matrix
+            or cls.get_global_similarity is not AverageKernel.get_global_similarity
+        ):
+            return None
+        gamma, degree, coef0 = self.get_metric_parameters(n_features)
+        return dscribe.ext.AverageKernel(self.metric, gamma, degree, coef0)
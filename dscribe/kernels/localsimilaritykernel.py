@@ -18,15 +18,24 @@ from abc import ABC, abstractmethod
 import numpy as np
 
 import sparse
+import scipy.sparse
 
 from sklearn.metrics.pairwise import pairwise_kernels
 
+import dscribe.ext
+
 
 class LocalSimilarityKernel(ABC):
     """An abstract base class for all kernels that use the similarity of local
     atomic environments to compute a global similarity measure.
+
+    The kernels provided by DScribe are calculated with a C++ extension when
+    the metric is one of "linear", "polynomial", "rbf" or "laplacian". Other
+    metrics are calculated with scikit-learn.
     """
 
+    native_metrics = ("linear", "polynomial", "rbf", "laplacian")
+
     def __init__(
         self,
         metric,
@@ -88,6 +97,25 @@ class LocalSimilarityKernel(ABC):
             y = x
             symmetric = True
 
+        # Dense features are calculated natively when possible. Sparse
+        # features stay sparse in the python implementation.
+        if isinstance(self.metric, str) and self.metric in self.native_metrics:
+            extension = self.get_extension(self.get_number_of_features(x))
+            if extension is not None and not (self.is_sparse(x) or self.is_sparse(y)):
+                x_features, x_offsets = self.get_concatenated_features(x)
+                if symmetric:
+                    y_features, y_offsets = x_features, x_offsets
+                else:
+                    y_features, y_offsets = self.get_concatenated_features(y)
+                return self.create_native(
+                    extension,
+                    x_features,
+                    x_offsets,
+                    y_features,
+                    y_offsets,
+                    symmetric,
+                )
+
         # First calculate the "raw" pairwise similarity of atomic environments
         n_x = len(x)
         n_y = len(y)
@@ -162,6 +190,146 @@ class LocalSimilarityKernel(ABC):
 
         return K_ij
 
+    def create_native(
+        self, extension, x_features, x_offsets, y_features, y_offsets, symmetric
+    ):
+        """Creates the kernel matrix with the C++ extension. The local
+        similarities are calculated in blocks that are divided between
+        native threads, see :func:`dscribe.ext.set_num_threads`.
+
+        Args:
+            extension: The C++ extension returned by :func:`get_extension`.
+            x_features(np.ndarray): Concatenated local features of x.
+            x_offsets(np.ndarray): Index of the first row of each structure in
+                x_features, followed by the total number of rows.
+            y_features(np.ndarray): Concatenated local features of y.
+            y_offsets(np.ndarray): Same as x_offsets for y_features.
+            symmetric(bool): Whether y is the same as x.
+
+        Returns:
+            The pairwise global similarity kernel, see :func:`create`.
+        """
+        if x_features.shape[1] != y_features.shape[1]:
+            raise ValueError(
+                "The local features of x and y have a different number of "
+                "features."
+            )
+        n_x = len(x_offsets) - 1
+        n_y = len(y_offsets) - 1
+        K_ij = np.zeros((n_x, n_y))
+        extension.create(K_ij, x_features, x_offsets, y_features, y_offsets, symmetric)
+
+        # Enforce kernel normalization if requested.
+        if self.normalize_kernel:
+            if symmetric:
+                x_k_ii_sqrt = np.sqrt(np.diagonal(K_ij))
+                y_k_ii_sqrt = x_k_ii_sqrt
+            else:
+                x_k_ii = np.empty(n_x)
+                extension.get_self_similarity(x_k_ii, x_features, x_offsets)
+                x_k_ii_sqrt = np.sqrt(x_k_ii)
+                y_k_ii = np.empty(n_y)
+                extension.get_self_similarity(y_k_ii, y_features, y_offsets)
+                y_k_ii_sqrt = np.sqrt(y_k_ii)
+            K_ij /= np.outer(x_k_ii_sqrt, y_k_ii_sqrt)
+
+        return K_ij
+
+    def get_number_of_features(self, x):
+        """Returns the number of local features in the given structures
+        without converting them.
+
+        Args:
+            x(iterable): A list of local feature arrays for each structure, or
+                a single array where the first dimension goes over the
+                structures.
+
+        Returns:
+            int: The size of the last dimension of the features.
+        """
+        if isinstance(x, (np.ndarray, sparse.COO)) and x.ndim == 3:
+            return x.shape[2]
+        for x_i in x:
+            return np.shape(x_i)[-1]
+        return 0
+
+    def is_sparse(self, x):
+        """Returns whether any of the given local features are sparse.
+
+        Args:
+            x(iterable): A list of local feature arrays for each structure, or
+                a single array where the first dimension goes over the
+                structures.
+        """
+        if isinstance(x, sparse.COO):
+            return True
+        if isinstance(x, np.ndarray):
+            return False
+        return any(
+            isinstance(x_i, sparse.COO) or scipy.sparse.issparse(x_i) for x_i in x
+        )
+
+    def get_concatenated_features(self, x):
+        """Concatenates the dense local features of the given structures into
+        one array.
+
+        Args:
+            x(iterable): A list of local feature arrays for each structure, or
+                a single array where the first dimension goes over the
+                structures, e.g. the output of a local descriptor for multiple
+                systems.
+
+        Returns:
+            tuple: The concatenated features as a 2D array and the index of
+            the first row of each structure, followed by the total number of
+            rows.
+        """
+        if isinstance(x, np.ndarray) and x.ndim == 3:
+            n_structures, n_local, n_features = x.shape
+            features = np.reshape(x, (n_structures * n_local, n_features))
+            offsets = np.arange(n_structures + 1, dtype=np.int32) * n_local
+            return np.asarray(features, dtype=np.float64), offsets
+
+        features = []
+        for x_i in x:
+            x_i = np.asarray(x_i, dtype=np.float64)
+            if x_i.ndim != 2:
+                raise ValueError(
+                    "The local features of each structure should be a 2D "
+                    "array with one row per local environment."
+                )
+            features.append(x_i)
+        offsets = np.zeros(len(features) + 1, dtype=np.int32)
+        offsets[1:] = np.cumsum([len(x_i) for x_i in features])
+        if len(features) == 0:
+            return np.empty((0, 0), dtype=np.float64), offsets
+
+        return np.concatenate(features), offsets
+
+    def get_metric_parameters(self, n_features):
+        """Returns the parameters of the pairwise metric with the same
+        defaults as in scikit-learn.
+
+        Args:
+            n_features(int): The number of local features.
+
+        Returns:
+            tuple: The gamma, degree and coef0 parameters.
+        """
+        gamma = self.gamma
+        if gamma is None:
+            gamma = 1.0 if self.metric == "linear" else 1.0 / n_features
+        return gamma, self.degree, self.coef0
+
+    def get_extension(self, n_features):
+        """Returns the C++ extension that calculates this kernel, or None if
+        the kernel can only be calculated in python.
+
+        Args:
+            n_features(int): The number of local features.
+        """
+        return None
+
     def get_pairwise_matrix(self, X, Y=None):
         """Calculates the pairwise similarity of atomic environments with
         scikit-learn, and the pairwise metric configured in the constructor.
@@ -16,6 +16,8 @@ limitations under the License.
 import numpy as np
 from dscribe.kernels.localsimilaritykernel import LocalSimilarityKernel
 
+import dscribe.ext
+
 
 class REMatchKernel(LocalSimilarityKernel):
     """Used to compute a global similarity of structures based on the
@@ -128,3 +130,21 @@ class REMatchKernel(LocalSimilarityKernel):
         glosim = np.sum(np.multiply(pity, localkernel))
 
         return glosim
+
+    def get_extension(self, n_features):
+        """Returns the C++ extension for this kernel. Subclasses that change
+        the pairwise or the global similarity are calculated in python.
+
+        Args:
+            n_features(int): The number of local features.
+        """
+        cls = type(self)
+        if (
+            cls.get_pairwise_matrix is not LocalSimilarityKernel.get_pairwise_matrix
+            or cls.get_global_similarity is not REMatchKernel.get_global_similarity
+        ):
+            return None
+        gamma, degree, coef0 = self.get_metric_parameters(n_features)
+        return dscribe.ext.REMatchKernel(
+            self.metric, gamma, degree, coef0, self.alpha, self.threshold
+        )
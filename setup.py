@@ -34,10 +34,13 @@ class get_pybind_include(object):
         return pybind11.get_include(self.user)
 
 
-cpp_extra_link_args = []
+cpp_extra_link_args = [
+    "-pthread",                     # Native thread pool
+]
 cpp_extra_compile_args = [
     "-std=c++11",                   # C++11
     "-O3",                          # O3 optimizations
+    "-pthread",                     # Native thread pool
     "-I dependencies/eigen/Eigen/"  # Eigen dependency
 ]
 
@@ -50,7 +53,7 @@ if platform.system() == "Darwin" and using_clang():
     cpp_extra_link_args.append("-mmacosx-version-min=10.7")
 
 extensions = [
-    # The SOAP, MBTR, ACSF and utils C++ extensions, wrapped with pybind11
+    # The SOAP, MBTR, ACSF, kernel and utils C++ extensions, wrapped with pybind11
     Extension(
         'dscribe.ext',
         [
@@ -58,14 +61,22 @@ extensions = [
             "dscribe/ext/celllist.cpp",
             "dscribe/ext/descriptorglobal.cpp",
             "dscribe/ext/descriptor.cpp",
+            "dscribe/ext/descriptormatrix.cpp",
             "dscribe/ext/cm.cpp",
+            "dscribe/ext/sinematrix.cpp",
+            "dscribe/ext/ewaldsummatrix.cpp",
             "dscribe/ext/soap.cpp",
             "dscribe/ext/soapGTO.cpp",
+            "dscribe/ext/sphericalharmonics.cpp",
             "dscribe/ext/soapGeneral.cpp",
             "dscribe/ext/acsf.cpp",
             "dscribe/ext/mbtr.cpp",
+            "dscribe/ext/kernels.cpp",
+            "dscribe/ext/trajectory.cpp",
             "dscribe/ext/geometry.cpp",
             "dscribe/ext/weighting.cpp",
+            "dscribe/ext/threadpool.cpp",
+            "dscribe/ext/profiling.cpp",
         ],
         include_dirs=[
             # Path to Eigen headers
@@ -1,6 +1,7 @@
 import math
 import pytest
 import numpy as np
+import sparse
 from ase import Atoms
 from ase.build import bulk
 from conftest import (
@@ -17,6 +18,7 @@ from conftest import (
     assert_derivatives_include,
     assert_derivatives_exclude,
     get_simple_finite,
+    get_complex_periodic,
 )
 from dscribe.descriptors import ACSF
 
@@ -120,16 +122,52 @@ def test_derivatives_numerical(pbc, attach):
     assert_derivatives(acsf(periodic=pbc), "numerical", pbc, attach=attach)
 
 
-@pytest.mark.parametrize("method", ("numerical",))
+@pytest.mark.parametrize("pbc", (False, True))
+def test_derivatives_analytical(pbc):
+    assert_derivatives(
+        acsf(periodic=pbc, g5_params=default_g4), "analytical", pbc, attach=True
+    )
+
+
+@pytest.mark.parametrize("method", ("numerical", "analytical"))
 def test_derivatives_include(method):
     assert_derivatives_include(acsf(), method, True)
 
 
-@pytest.mark.parametrize("method", ("numerical",))
+@pytest.mark.parametrize("method", ("numerical", "analytical"))
 def test_derivatives_exclude(method):
     assert_derivatives_exclude(acsf(), method, True)
 
 
+@pytest.mark.parametrize("pbc", (False, True))
+@pytest.mark.parametrize("dtype", ("float32", "float64"))
+def test_derivatives_sparse(pbc, dtype):
+    """Tests that the sparse analytical derivatives, which are created
+    natively, match the dense ones.
+    """
+    system = get_complex_periodic()
+    system.set_pbc(pbc)
+    centers = [38, 0, 5]
+    include = [3, 0, 3, 10]
+    derivatives = []
+    descriptors = []
+    for is_sparse in (False, True):
+        descriptor = acsf(
+            r_cut=3, periodic=pbc, sparse=is_sparse, g5_params=default_g4, dtype=dtype
+        )([system])
+        d, c = descriptor.derivatives(
+            system, centers=centers, include=include, attach=True, method="analytical"
+        )
+        derivatives.append(d)
+        descriptors.append(c)
+    assert type(derivatives[1]) == sparse.COO
+    assert derivatives[1].dtype == dtype
+    assert derivatives[1].shape == derivatives[0].shape
+    assert derivatives[1].nnz < derivatives[0].size
+    assert np.array_equal(derivatives[1].todense(), derivatives[0])
+    assert np.array_equal(descriptors[1].todense(), descriptors[0])
+
+
 # =============================================================================
 # Tests that are specific to this descriptor.
 def test_exceptions():
@@ -329,3 +367,36 @@ def test_periodicity():
     assert feat[0, 0] == pytest.approx(
         12 * 0.5 * (np.cos(np.pi * np.sqrt(2) / 2 * 5 / r_cut) + 1)
     )
+
+
+def test_centers_order():
+    """Tests that the centers can be given in any order and multiple times."""
+    system = get_complex_periodic()
+    desc = acsf(r_cut=3, periodic=True, g5_params=default_g4)([system])
+    centers = [5, 0, 5, 2]
+    feat = desc.create(system)
+    assert np.allclose(desc.create(system, centers), feat[centers], rtol=1e-12, atol=0)
+
+    derivatives_all, _ = desc.derivatives(system, attach=True, method="analytical")
+    derivatives, descriptor = desc.derivatives(
+        system, centers=centers, attach=True, method="analytical"
+    )
+    assert np.allclose(descriptor, feat[centers], rtol=1e-12, atol=0)
+    assert np.allclose(derivatives, derivatives_all[centers], rtol=1e-12, atol=1e-15)
+
+
+def test_small_cell():
+    """Tests that periodic cells smaller than the cutoff, where an atom sees
+    many periodic images of itself and of its neighbours, give the same
+    output as a supercell.
+    """
+    r_cut = 6
+    primitive = bulk("NaCl", "rocksalt", a=4)
+    assert np.all(primitive.cell.lengths() < r_cut)
+    supercell = primitive * (4, 4, 4)
+    g5 = [[0.1, 1, 1], [0.2, 2, -1]]
+    desc = acsf(r_cut=r_cut, periodic=True, g5_params=g5)([primitive])
+    feat = desc.create(primitive)
+    feat_supercell = desc.create(supercell, centers=[0, 1])
+    assert feat.sum() != 0
+    assert np.allclose(feat, feat_supercell, rtol=1e-10, atol=0)
@@ -18,8 +18,10 @@ from conftest import (
     get_complex_periodic,
     get_simple_periodic,
     get_simple_finite,
+    get_complex_finite,
 )
 from dscribe.descriptors import CoulombMatrix
+import dscribe.ext
 
 
 # =============================================================================
@@ -189,6 +191,59 @@ def test_features(permutation):
     assert np.allclose(cm, cm_assumed)
 
 
+@pytest.mark.parametrize("permutation", ["none", "sorted_l2"])
+def test_triangular(permutation):
+    """Tests that the triangular output contains the upper triangle of the
+    full matrix and that it can be unflattened back to the full matrix.
+    """
+    n_atoms_max = 7
+    system = get_complex_finite()
+    full = CoulombMatrix(n_atoms_max=n_atoms_max, permutation=permutation)
+    desc = CoulombMatrix(
+        n_atoms_max=n_atoms_max, permutation=permutation, triangular=True
+    )
+    assert desc.get_number_of_features() == n_atoms_max * (n_atoms_max + 1) / 2
+    cm_full = full.unflatten(full.create(system))
+    cm = desc.create(system)
+    assert np.array_equal(cm, cm_full[np.triu_indices(n_atoms_max)])
+    assert np.array_equal(desc.unflatten(cm), cm_full)
+
+    with pytest.raises(ValueError):
+        CoulombMatrix(n_atoms_max=5, permutation="eigenspectrum", triangular=True)
+
+
+@pytest.mark.parametrize(
+    "permutation", ["none", "eigenspectrum", "sorted_l2", "random"]
+)
+def test_create_batch(permutation):
+    """Tests that creating many systems with one call is identical to
+    creating them one by one, and that the output does not depend on the
+    number of native threads.
+    """
+    systems = 3 * [get_simple_finite(), get_complex_finite(), get_simple_periodic()]
+    kwargs = {"n_atoms_max": 7, "permutation": permutation}
+    if permutation == "random":
+        kwargs.update({"sigma": 100, "seed": 7})
+    n_threads = dscribe.ext.get_num_threads()
+    try:
+        dscribe.ext.set_num_threads(1)
+        batch = CoulombMatrix(**kwargs).create(systems)
+        dscribe.ext.set_num_threads(4)
+        desc = CoulombMatrix(**kwargs)
+        assert np.array_equal(desc.create(systems), batch)
+
+        # The random permutation changes between the calls. The noise of each
+        # system in a batch is drawn separately, so only the other
+        # permutations match the single system output.
+        if permutation == "random":
+            assert not np.array_equal(desc.create(systems), batch)
+        else:
+            for i_sys, system in enumerate(systems):
+                assert np.array_equal(batch[i_sys], desc.create(system))
+    finally:
+        dscribe.ext.set_num_threads(n_threads)
+
+
 def test_periodicity():
     """Tests that periodicity is not taken into account in Coulomb matrix
     even if the system is set as periodic.
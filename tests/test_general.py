@@ -1,14 +1,15 @@
 import math
+from concurrent.futures import ThreadPoolExecutor
 
 import numpy as np
 import pytest
 from ase.lattice.cubic import SimpleCubicFactory
-from ase.build import bulk
+from ase.build import bulk, molecule
 import ase.data
 from ase import Atoms
 
 from dscribe.core import System
-from dscribe.descriptors import ACSF, SOAP
+from dscribe.descriptors import ACSF, MBTR, SOAP, CoulombMatrix
 from dscribe.utils.species import symbols_to_numbers
 from dscribe.utils.geometry import get_extended_system
 import dscribe.ext
@@ -339,6 +340,38 @@ def test_cell_list():
     assert distances[0] == pytest.approx(0.2, abs=0, rel=7)
 
 
+def test_cell_list_periodic():
+    """Tests that the periodic cell list finds the same neighbours as a cell
+    list built for the periodically extended system.
+    """
+    system = Atoms(
+        cell=[[0.0, 2.0, 2.0], [2.0, 0.0, 2.0], [2.0, 2.0, 0.5]],
+        positions=[[0, 0, 0], [0.95, 0, 0], [0.3, 1.1, 0.4]],
+        symbols=["H", "O", "H"],
+        pbc=[True, False, True],
+    )
+    pos = system.get_positions()
+    cell = system.get_cell()
+    pbc = system.get_pbc()
+    for cutoff in [1, 2.5, 4]:
+        ext = dscribe.ext.extend_system(
+            pos, system.get_atomic_numbers(), cell, pbc, cutoff
+        )
+        cell_list = dscribe.ext.CellList(pos, cutoff, cell, pbc)
+        cell_list_ext = dscribe.ext.CellList(ext.positions, cutoff)
+        for position in [*pos, [1.5, -0.5, 3.0]]:
+            result = cell_list.get_neighbours_for_position(*position)
+            result_ext = cell_list_ext.get_neighbours_for_position(*position)
+            found = sorted(zip(result.indices, result.distances))
+            expected = sorted(
+                zip(ext.indices[result_ext.indices], result_ext.distances)
+            )
+            assert [x[0] for x in found] == [x[0] for x in expected]
+            assert np.allclose(
+                [x[1] for x in found], [x[1] for x in expected], atol=1e-12, rtol=0
+            )
+
+
 def test_cdf():
     """Test that the implementation of the gaussian value through the
     cumulative distribution function works as expected.
@@ -519,3 +552,157 @@ def test_verbose_create():
     """Tests the verbose flag in create."""
     desc = SOAP(species=[1, 8], r_cut=3, n_max=5, l_max=5, periodic=True)
     desc.create([H2O, H2O], verbose=True)
+
+
+def test_native_threads():
+    """Tests that the number of native threads can be controlled and that the
+    results do not depend on it or on running the descriptors in Python
+    threads.
+    """
+    n_threads = dscribe.ext.get_num_threads()
+    system = bulk("NaCl", crystalstructure="rocksalt", a=5.64) * (2, 2, 2)
+    soap = SOAP(species=[11, 17], r_cut=5, n_max=3, l_max=3, periodic=True)
+    acsf = ACSF(
+        species=[11, 17],
+        r_cut=5,
+        g2_params=[[1, 2], [4, 5]],
+        g4_params=[[1, 2, 1], [1, 4, -1]],
+        periodic=True,
+    )
+    try:
+        dscribe.ext.set_num_threads(1)
+        assert dscribe.ext.get_num_threads() == 1
+        soap_serial = soap.create(system)
+        acsf_serial = acsf.create(system)
+
+        dscribe.ext.set_num_threads(4)
+        assert dscribe.ext.get_num_threads() == 4
+        assert np.array_equal(soap.create(system), soap_serial)
+        assert np.array_equal(acsf.create(system), acsf_serial)
+
+        # Python threads running the C++ extension concurrently
+        with ThreadPoolExecutor(max_workers=4) as executor:
+            soap_threads = list(executor.map(soap.create, [system] * 4))
+            acsf_threads = list(executor.map(acsf.create, [system] * 4))
+        for i in range(4):
+            assert np.array_equal(soap_threads[i], soap_serial)
+            assert np.array_equal(acsf_threads[i], acsf_serial)
+
+        # Values below one select all hardware threads
+        dscribe.ext.set_num_threads(0)
+        assert dscribe.ext.get_num_threads() >= 1
+    finally:
+        dscribe.ext.set_num_threads(n_threads)
+
+
+def test_profiling():
+    """Tests that the profiling statistics of the C++ extension are only
+    collected when enabled and that they can be reset.
+    """
+    system = bulk("NaCl", crystalstructure="rocksalt", a=5.64) * (2, 2, 2)
+    soap = SOAP(species=[11, 17], r_cut=5, n_max=3, l_max=3, periodic=True)
+    mbtr = MBTR(
+        species=[11, 17],
+        geometry={"function": "inverse_distance"},
+        grid={"min": 0, "max": 1, "n": 10, "sigma": 0.1},
+        weighting={"function": "exp", "scale": 0.5, "threshold": 1e-3},
+        periodic=True,
+    )
+    assert not dscribe.ext.get_profiling()
+    try:
+        dscribe.ext.reset_profiling_stats()
+        soap.create(system)
+        assert dscribe.ext.get_profiling_stats() == {}
+
+        dscribe.ext.set_profiling(True)
+        assert dscribe.ext.get_profiling()
+        expected = soap.create(system)
+        mbtr.create(system)
+        stats = dscribe.ext.get_profiling_stats()
+        soap_stats = stats["SOAPGTO"]
+        assert soap_stats["counters"]["centers"] == len(system)
+        assert soap_stats["counters"]["neighbours"] > len(system)
+        for phase in ["neighbours", "expansion", "power_spectrum"]:
+            assert soap_stats["phases"][phase]["time"] >= 0
+            assert soap_stats["phases"][phase]["calls"] > 0
+        assert "derivatives" not in soap_stats["phases"]
+        assert stats["CellList"]["phases"]["build"]["calls"] > 0
+        assert stats["MBTR"]["phases"]["k2"]["calls"] > 0
+
+        # The statistics are aggregated over the calls until reset
+        soap.derivatives(system, method="analytical")
+        stats = dscribe.ext.get_profiling_stats()
+        assert stats["SOAPGTO"]["counters"]["centers"] == 2 * len(system)
+        assert stats["SOAPGTO"]["phases"]["derivatives"]["calls"] > 0
+        dscribe.ext.reset_profiling_stats()
+        assert dscribe.ext.get_profiling_stats() == {}
+
+        # The profiling does not change the output
+        assert np.array_equal(soap.create(system), expected)
+    finally:
+        dscribe.ext.set_profiling(False)
+        dscribe.ext.reset_profiling_stats()
+
+
+def test_preallocated_output(tmp_path):
+    """Tests that the output of multiple systems is written into preallocated
+    arrays by every job.
+    """
+    water = molecule("H2O")
+    rattled = water.copy()
+    rattled.rattle(0.1, seed=1)
+    systems = [water, rattled]
+    soap = SOAP(species=[1, 8], r_cut=3, n_max=2, l_max=2)
+    cm = CoulombMatrix(n_atoms_max=3)
+    for desc in (soap, cm):
+        name = type(desc).__name__
+        expected = desc.create(systems)
+        expected_d, expected_c = desc.derivatives(systems)
+        for n_jobs in (1, 2):
+            path = tmp_path / "{}_{}.npy".format(name, n_jobs)
+            out = np.lib.format.open_memmap(
+                path, mode="w+", dtype=np.float64, shape=expected.shape
+            )
+            assert desc.create(systems, n_jobs=n_jobs, out=out) is out
+            assert np.allclose(np.load(path), expected)
+
+            out_d = np.lib.format.open_memmap(
+                tmp_path / "{}_{}_d.npy".format(name, n_jobs),
+                mode="w+",
+                dtype=np.float64,
+                shape=expected_d.shape,
+            )
+            out_c = np.lib.format.open_memmap(
+                tmp_path / "{}_{}_c.npy".format(name, n_jobs),
+                mode="w+",
+                dtype=np.float64,
+                shape=expected_c.shape,
+            )
+            desc.derivatives(systems, n_jobs=n_jobs, out=(out_d, out_c))
+            assert np.allclose(out_d, expected_d)
+            assert np.allclose(out_c, expected_c)
+
+        # Single systems and regular numpy arrays in a single process
+        out = np.zeros(expected.shape[1:], dtype=np.float32)
+        desc.create(systems[0], out=out)
+        assert np.allclose(out, expected[0], atol=1e-6)
+        out_d = np.zeros(expected_d.shape[1:])
+        desc.derivatives(systems[0], return_descriptor=False, out=out_d)
+        assert np.allclose(out_d, expected_d[0])
+
+        # Separate processes cannot write into numpy arrays
+        with pytest.raises(ValueError):
+            desc.create(systems, n_jobs=2, out=np.zeros(expected.shape))
+
+        # The shape must match the output
+        with pytest.raises(ValueError):
+            desc.create(systems, out=np.zeros(expected.shape[1:]))
+        with pytest.raises(ValueError):
+            desc.derivatives(systems, out=np.zeros(expected_d.shape))
+
+    # Variable sized and sparse output cannot be preallocated
+    with pytest.raises(ValueError):
+        soap.create([water, molecule("H2")], out=np.zeros((2, 3, 1)))
+    sparse_soap = SOAP(species=[1, 8], r_cut=3, n_max=2, l_max=2, sparse=True)
+    with pytest.raises(ValueError):
+        sparse_soap.create(systems, out=np.zeros(expected.shape))
@@ -1,4 +1,6 @@
+import pytest
 import numpy as np
+import sparse
 from ase.build import molecule
 
 from dscribe.descriptors import SOAP
@@ -270,3 +272,74 @@ def test_sparse():
     a_feat = desc.create(a)
     kernel = REMatchKernel(metric="linear", alpha=0.1, threshold=1e-6)
     kernel.create([a_feat])
+
+
+@pytest.mark.parametrize("kernel_class", [AverageKernel, REMatchKernel])
+@pytest.mark.parametrize("metric", ["linear", "polynomial", "rbf", "laplacian"])
+def test_native(kernel_class, metric):
+    """Tests that the C++ extension gives the same kernel as the python
+    implementation.
+    """
+
+    class PythonKernel(kernel_class):
+        def get_extension(self, n_features):
+            return None
+
+    desc = SOAP(
+        species=[1, 6, 8],
+        r_cut=5.0,
+        n_max=2,
+        l_max=2,
+        sigma=0.2,
+        periodic=False,
+        sparse=False,
+    )
+    x = [desc.create(molecule(name)) for name in ["H2O", "CO2", "CH3OH"]]
+    y = [desc.create(molecule(name)) for name in ["H2O2", "CH4"]]
+    kwargs = {"metric": metric, "gamma": 0.5}
+    if kernel_class == REMatchKernel:
+        kwargs.update({"alpha": 0.5, "threshold": 1e-8})
+    native = kernel_class(**kwargs)
+    python = PythonKernel(**kwargs)
+    assert np.allclose(native.create(x), python.create(x), rtol=1e-10, atol=0)
+    assert np.allclose(native.create(x, y), python.create(x, y), rtol=1e-10, atol=0)
+
+    # Outputs for multiple systems can be used directly
+    batch = desc.create([molecule("H2O"), molecule("H2O2")])
+    assert np.allclose(
+        native.create(np.array([batch[0], batch[0]])),
+        python.create([batch[0], batch[0]]),
+        rtol=1e-10,
+        atol=0,
+    )
+
+    # Sparse features are calculated in python without densifying them
+    x_sparse = [sparse.COO.from_numpy(x_i) for x_i in x]
+    assert not native.is_sparse(x)
+    assert native.is_sparse(x_sparse)
+    assert np.allclose(native.create(x_sparse), python.create(x), rtol=1e-10, atol=0)
+
+
+@pytest.mark.parametrize("kernel_class", [AverageKernel, REMatchKernel])
+@pytest.mark.parametrize("method", ["get_pairwise_matrix", "get_global_similarity"])
+def test_native_overridden(kernel_class, method):
+    """Tests that subclasses which change the pairwise or the global
+    similarity are calculated in python.
+    """
+
+    def overridden(self, *args, **kwargs):
+        return 2 * getattr(kernel_class, method)(self, *args, **kwargs)
+
+    subclass = type("Subclass", (kernel_class,), {method: overridden})
+    kwargs = {"metric": "linear", "normalize_kernel": False}
+    if kernel_class == REMatchKernel:
+        kwargs.update({"alpha": 0.5, "threshold": 1e-8})
+    assert kernel_class(**kwargs).get_extension(3) is not None
+    assert subclass(**kwargs).get_extension(3) is None
+
+    # Both overrides scale the average kernel, but only the global similarity
+    # scales the REMatch kernel.
+    x = [np.array([[1.0, 0.0, 0.0], [0.0, 1.0, 0.0]]), np.array([[1.0, 1.0, 0.0]])]
+    if kernel_class == AverageKernel or method == "get_global_similarity":
+        expected = 2 * kernel_class(**kwargs).create(x)
+        assert np.allclose(subclass(**kwargs).create(x), expected)
@@ -155,12 +155,33 @@ def test_derivatives_numerical(pbc, attach):
     assert_derivatives(lmbtr_default_k2(), "numerical", pbc, attach=attach)
 
 
-@pytest.mark.parametrize("method", ("numerical",))
+@pytest.mark.parametrize("pbc", (False, True))
+@pytest.mark.parametrize(
+    "setup, attach",
+    [
+        pytest.param(default_k2, False, id="K2 not attached"),
+        pytest.param(default_k2, True, id="K2 attached"),
+        pytest.param(
+            {
+                **default_k3,
+                "geometry": {"function": "cosine"},
+                "grid": {"min": -1, "max": 1, "sigma": 0.05, "n": 50},
+            },
+            True,
+            id="K3 attached",
+        ),
+    ],
+)
+def test_derivatives_analytical(pbc, setup, attach):
+    assert_derivatives(lmbtr(**setup), "analytical", pbc, attach=attach)
+
+
+@pytest.mark.parametrize("method", ("numerical", "analytical"))
 def test_derivatives_include(method):
     assert_derivatives_include(lmbtr_default_k2(), method, False)
 
 
-@pytest.mark.parametrize("method", ("numerical",))
+@pytest.mark.parametrize("method", ("numerical", "analytical"))
 def test_derivatives_exclude(method):
     assert_derivatives_exclude(lmbtr_default_k2(), method, False)
 
@@ -5,6 +5,7 @@ import pytest
 import numpy as np
 from ase import Atoms, geometry
 from ase.build import bulk
+import dscribe.ext
 from dscribe.descriptors import MBTR
 
 from conftest import (
@@ -937,3 +938,37 @@ def test_periodic_images_1(setup):
     tricl_sum = abs(np.sum(triclinic_cell))
     assert diff1 / tricl_sum < 0.05
     assert diff2 / tricl_sum < 0.05
+
+
+@pytest.mark.parametrize(
+    "weighting",
+    [
+        {"function": "exp", "scale": 0.5, "threshold": 1e-2},
+        {"function": "smooth_cutoff", "r_cut": 4},
+    ],
+)
+def test_native_threads(weighting):
+    """Tests that splitting the k=3 triplets between native threads does not
+    change the output.
+    """
+    desc = MBTR(
+        species=[1, 8],
+        geometry={"function": "cosine"},
+        grid={"min": -1, "max": 1, "sigma": 0.1, "n": 50},
+        weighting=weighting,
+        periodic=True,
+    )
+    system = bulk("H", "fcc", a=2.0, cubic=True) * (2, 2, 1)
+    system.set_chemical_symbols(["H", "O"] * (len(system) // 2))
+    n_threads = dscribe.ext.get_num_threads()
+    try:
+        dscribe.ext.set_num_threads(1)
+        derivatives_serial, descriptor_serial = desc.derivatives(
+            system, method="analytical"
+        )
+        dscribe.ext.set_num_threads(3)
+        derivatives, descriptor = desc.derivatives(system, method="analytical")
+        assert np.allclose(descriptor, descriptor_serial, rtol=1e-10, atol=1e-12)
+        assert np.allclose(derivatives, derivatives_serial, rtol=1e-10, atol=1e-12)
+    finally:
+        dscribe.ext.set_num_threads(n_threads)
@@ -1,7 +1,9 @@
 import pytest
 from pathlib import Path
 import itertools
+import pickle
 import numpy as np
+import sparse
 from ase import Atoms
 from conftest import (
     assert_n_features,
@@ -18,8 +20,10 @@ from conftest import (
     assert_derivatives_exclude,
     assert_derivatives_include,
     get_simple_finite,
+    get_complex_periodic,
 )
 from dscribe.descriptors import SOAP
+import dscribe.ext
 
 
 # =============================================================================
@@ -276,10 +280,12 @@ def test_sparse():
     assert_sparse(soap)
 
 
-@pytest.mark.parametrize("rbf", ["gto", "polynomial"])
-def test_symmetries(rbf):
+@pytest.mark.parametrize(
+    "rbf, l_max", [("gto", default_l_max), ("polynomial", default_l_max), ("gto", 24)]
+)
+def test_symmetries(rbf, l_max):
     # Local descriptors are not permutation symmetric.
-    assert_symmetries(soap(rbf=rbf), True, True, False)
+    assert_symmetries(soap(rbf=rbf, l_max=l_max), True, True, False)
 
 
 def test_periodic():
@@ -315,7 +321,17 @@ def test_derivatives_numerical(pbc, attach, average, rbf, crossover):
     assert_derivatives(descriptor_func, "numerical", pbc, attach=attach)
 
 
-@pytest.mark.parametrize("pbc, average, rbf", [(False, "off", "gto")])
+@pytest.mark.parametrize(
+    "pbc, average, rbf",
+    [
+        (False, "off", "gto"),
+        (True, "off", "gto"),
+        (False, "inner", "gto"),
+        (True, "inner", "gto"),
+        (False, "outer", "gto"),
+        (True, "outer", "gto"),
+    ],
+)
 @pytest.mark.parametrize("attach", (False, True))
 @pytest.mark.parametrize("crossover", (True, False))
 def test_derivatives_analytical(pbc, attach, average, rbf, crossover):
@@ -333,6 +349,177 @@ def test_derivatives_analytical(pbc, attach, average, rbf, crossover):
     assert_derivatives(descriptor_func, "analytical", pbc, attach=attach)
 
 
+@pytest.mark.parametrize("pbc", (False, True))
+def test_specialized_kernel(pbc):
+    """Tests the kernel that is compiled for n_max=8 and l_max=6 against the
+    generic kernel. With a single species, the degrees up to 6 of the generic
+    output with l_max=7 are identical to the output with l_max=6.
+    """
+    system = get_complex_periodic()
+    system.set_pbc(pbc)
+    centers = [0, 3, 17]
+    args = {"r_cut": 4, "n_max": 8, "species": ["C"]}
+    specialized = SOAP(l_max=6, periodic=pbc, **args)
+    generic = SOAP(l_max=7, periodic=pbc, **args)
+    n_pairs = 8 * 9 // 2
+
+    def truncate(output):
+        shape = output.shape[:-1]
+        output = output.reshape(shape + (8, n_pairs))
+        return output[..., :7, :].reshape(shape + (-1,))
+
+    derivatives, descriptor = specialized.derivatives(
+        system, centers=centers, method="analytical"
+    )
+    derivatives_generic, descriptor_generic = generic.derivatives(
+        system, centers=centers, method="analytical"
+    )
+    assert descriptor.shape[-1] == specialized.get_number_of_features()
+    assert np.allclose(descriptor, truncate(descriptor_generic), rtol=1e-10)
+    assert np.allclose(derivatives, truncate(derivatives_generic), rtol=1e-10)
+    assert_symmetries(soap(n_max=8, l_max=6), True, True, False)
+
+
+@pytest.mark.parametrize("pbc", (False, True))
+@pytest.mark.parametrize("crossover", (True, False))
+@pytest.mark.parametrize("weighting", (None, {"function": "poly", "c": 2, "m": 3, "r0": 4}))
+def test_derivatives_analytical_polynomial(pbc, crossover, weighting):
+    """Tests the analytical derivatives of the polynomial basis against the
+    numerical ones. With attach=False, centers on top of atoms are avoided:
+    there the finite differences of the numerically integrated coefficients
+    with l > 2 are not reliable.
+    """
+    descriptor_func = soap(
+        r_cut=3,
+        n_max=4,
+        l_max=4,
+        rbf="polynomial",
+        sparse=False,
+        crossover=crossover,
+        periodic=pbc,
+        weighting=weighting,
+        dtype="float64",
+    )
+    if weighting is None:
+        assert_derivatives(descriptor_func, "analytical", pbc, attach=True)
+
+    system = get_complex_periodic()
+    system.set_pbc(pbc)
+    descriptor = descriptor_func([system])
+    centers = [np.sum(system.get_cell(), axis=0) / 2, system.get_positions()[0] + 0.3]
+    for attach, i_centers in ((False, centers), (True, [38, 0])):
+        numerical, d_numerical = descriptor.derivatives(
+            system, centers=i_centers, attach=attach, method="numerical"
+        )
+        analytical, d_analytical = descriptor.derivatives(
+            system, centers=i_centers, attach=attach, method="analytical"
+        )
+        assert np.allclose(d_numerical, d_analytical, rtol=0, atol=1e-12)
+        assert np.max(np.abs(analytical)) > 1e-8
+        assert np.allclose(numerical, analytical, rtol=0.5e-3, atol=1e-4)
+
+
+@pytest.mark.parametrize("pbc", (False, True))
+@pytest.mark.parametrize("attach", (False, True))
+@pytest.mark.parametrize("dtype", ("float32", "float64"))
+def test_derivatives_sparse(pbc, attach, dtype):
+    """Tests that the sparse analytical derivatives, which are created
+    natively, match the dense ones.
+    """
+    system = get_complex_periodic()
+    system.set_pbc(pbc)
+    if attach:
+        centers = [38, 0, 5]
+    else:
+        centers = [np.sum(system.get_cell(), axis=0) / 2, system.get_positions()[0]]
+    include = [3, 0, 3, 10]
+    derivatives = []
+    descriptors = []
+    for is_sparse in (False, True):
+        descriptor = soap(
+            r_cut=3, n_max=4, l_max=4, sparse=is_sparse, periodic=pbc, dtype=dtype
+        )([system])
+        d, c = descriptor.derivatives(
+            system, centers=centers, include=include, attach=attach, method="analytical"
+        )
+        derivatives.append(d)
+        descriptors.append(c)
+    assert type(derivatives[1]) == sparse.COO
+    assert derivatives[1].dtype == dtype
+    assert derivatives[1].shape == derivatives[0].shape
+    assert derivatives[1].nnz < derivatives[0].size
+    assert np.array_equal(derivatives[1].todense(), derivatives[0])
+    assert np.array_equal(descriptors[1].todense(), descriptors[0])
+
+
+@pytest.mark.parametrize("rbf", ("gto", "polynomial"))
+@pytest.mark.parametrize("average", ("off", "inner", "outer"))
+def test_single_precision(rbf, average):
+    """Tests that single precision output matches the double precision output
+    when it is written directly by the extension.
+    """
+    system = get_complex_periodic()
+    centers = [0, 5, 10]
+    outputs = {}
+    for dtype in ("float32", "float64"):
+        descriptor = soap(
+            r_cut=3, n_max=4, l_max=4, rbf=rbf, average=average, dtype=dtype
+        )([system])
+        d, c = descriptor.derivatives(
+            system, centers=centers, include=[0, 3], method="auto"
+        )
+        batch = descriptor.create_batch([system, system], centers=[centers, centers])
+        outputs[dtype] = (descriptor.create(system, centers=centers), batch, d, c)
+    for single, double in zip(outputs["float32"], outputs["float64"]):
+        assert single.dtype == np.float32
+        scale = np.max(np.abs(double))
+        assert np.allclose(single, double, rtol=0, atol=1e-6 * scale)
+
+
+@pytest.mark.parametrize("pbc", (False, True))
+@pytest.mark.parametrize("attach", (False, True))
+def test_derivatives_stencil_order(pbc, attach):
+    """Tests that the fourth order finite difference stencil agrees with the
+    analytical derivatives more closely than the second order one.
+    """
+    descriptor_func = soap(
+        r_cut=3,
+        n_max=4,
+        l_max=4,
+        rbf="gto",
+        sparse=False,
+        periodic=pbc,
+        dtype="float64",
+    )
+    system = get_complex_periodic()
+    system.set_pbc(pbc)
+    descriptor = descriptor_func([system])
+    if attach:
+        centers = [38, 0]
+    else:
+        centers = [np.sum(system.get_cell(), axis=0) / 2, system.get_positions()[0]]
+    analytical, _ = descriptor.derivatives(
+        system, centers=centers, attach=attach, method="analytical"
+    )
+    errors = []
+    for stencil_order in (2, 4):
+        numerical, _ = descriptor.derivatives(
+            system,
+            centers=centers,
+            attach=attach,
+            method="numerical",
+            stencil_order=stencil_order,
+        )
+        errors.append(np.max(np.abs(numerical - analytical)))
+    assert errors[1] < 1e-9
+    assert errors[1] < errors[0]
+
+    with pytest.raises(ValueError):
+        descriptor.derivatives(
+            system, centers=centers, attach=attach, method="numerical", stencil_order=3
+        )
+
+
 @pytest.mark.parametrize("method", ("numerical", "analytical"))
 def test_derivatives_include(method):
     assert_derivatives_include(soap(), method, False)
@@ -444,32 +631,18 @@ def test_exceptions():
         SOAP(**args)
 
     # Test that trying to get analytical derivatives with averaged output
-    # raises an exception
+    # and the polynomial basis raises an exception
     centers = [[0.0, 0.0, 0.0]]
+    args["weighting"] = None
     with pytest.raises(ValueError):
         args["average"] = "inner"
-        soap = SOAP(**args)
+        soap = SOAP(**args, rbf="polynomial")
         soap.derivatives(system, centers=centers, method="analytical")
     with pytest.raises(ValueError):
         args["average"] = "outer"
-        soap = SOAP(**args)
-        soap.derivatives(system, centers=centers, method="analytical")
-
-    # Test that trying to get analytical derivatives with polynomial basis
-    # raises an exception.
-    with pytest.raises(ValueError):
-        args["average"] = "off"
-        args["rbf"] = "polynomial"
-        soap = SOAP(**args)
+        soap = SOAP(**args, rbf="polynomial")
         soap.derivatives(system, centers=centers, method="analytical")
 
-    # Test that trying to get analytical derivatives with periodicity on
-    # raises an exception
-    with pytest.raises(ValueError):
-        args["periodic"] = True
-        args["rbf"] = "rbf"
-        soap = SOAP(**args)
-        soap.derivatives(system, centers=centers, method="analytical")
 
 
 w_poly = {"function": "poly", "c": 2, "m": 3, "r0": 4}
@@ -756,3 +929,220 @@ def test_rbf_orthonormality():
         # Check that the basis functions for each l are orthonormal
         diff = S - np.eye(n_max)
         assert np.allclose(diff, np.zeros((n_max, n_max)), atol=1e-3)
+
+
+@pytest.mark.parametrize("rbf", ["gto", "polynomial"])
+@pytest.mark.parametrize("average", ["off", "inner", "outer"])
+def test_native_threads(rbf, average):
+    """Tests that splitting the centers between native threads does not
+    change the output.
+    """
+    system, centers, args = get_soap_default_setup()
+    soap = SOAP(**args, rbf=rbf, average=average)
+    method = "analytical" if rbf == "gto" and average == "off" else "numerical"
+    n_threads = dscribe.ext.get_num_threads()
+    try:
+        dscribe.ext.set_num_threads(1)
+        derivatives_serial, descriptor_serial = soap.derivatives(system, method=method)
+        dscribe.ext.set_num_threads(3)
+        derivatives, descriptor = soap.derivatives(system, method=method)
+        assert np.array_equal(descriptor, descriptor_serial)
+        assert np.array_equal(derivatives, derivatives_serial)
+    finally:
+        dscribe.ext.set_num_threads(n_threads)
+
+
+def test_workspace_reuse():
+    """Tests that reusing the native SOAP object, and thus its workspace, for
+    systems of different size gives the same output as a fresh object.
+    """
+    system, centers, args = get_soap_default_setup()
+    soap = SOAP(**args, rbf="gto")
+    small = system
+    large = system.copy()
+    large.set_cell([5, 5, 5])
+    large = large * (1, 1, 3)
+
+    def create(soap_gto, atoms):
+        out = soap.init_descriptor_array(len(centers))
+        soap_gto.create(
+            out,
+            atoms.get_positions(),
+            atoms.get_atomic_numbers(),
+            np.array(centers, dtype=np.float64),
+        )
+        return out
+
+    def native():
+        return dscribe.ext.SOAPGTO(
+            soap._r_cut,
+            soap._n_max,
+            soap._l_max,
+            soap._eta,
+            soap._weighting,
+            soap.crossover,
+            soap.average,
+            soap.get_cutoff_padding(),
+            soap._alphas.flatten(),
+            soap._betas.flatten(),
+            soap._atomic_numbers,
+            soap.periodic,
+        )
+
+    soap_gto = native()
+    large_first = create(soap_gto, large)
+    small_reused = create(soap_gto, small)
+    large_reused = create(soap_gto, large)
+    assert np.array_equal(small_reused, create(native(), small))
+    assert np.array_equal(large_reused, large_first)
+    assert np.allclose(small_reused, soap.create(small, centers=centers))
+
+
+@pytest.mark.parametrize("rbf", ["gto", "polynomial"])
+def test_extension_reuse(rbf):
+    """Tests that the C++ extension object is reused between calls, created
+    again when the settings change, and not included when pickling.
+    """
+    system, centers, args = get_soap_default_setup()
+    soap = SOAP(**args, rbf=rbf, periodic=False)
+    first = soap.create(system, centers=centers)
+    extension = soap.get_extension()
+    assert np.array_equal(soap.create(system, centers=centers), first)
+    assert soap.get_extension() is extension
+
+    soap.periodic = True
+    assert soap.get_extension() is not extension
+    soap.periodic = False
+
+    unpickled = pickle.loads(pickle.dumps(soap))
+    assert np.array_equal(unpickled.create(system, centers=centers), first)
+
+
+@pytest.mark.parametrize("rbf", ["gto", "polynomial"])
+@pytest.mark.parametrize("average", ["off", "inner", "outer"])
+@pytest.mark.parametrize("n_threads", [1, 3])
+def test_create_batch(rbf, average, n_threads):
+    """Tests that creating the output for multiple systems with one native
+    call gives the same output as creating it separately for each system.
+    """
+    system, centers, args = get_soap_default_setup()
+    soap = SOAP(**args, rbf=rbf, average=average, periodic=True)
+    finite = system.copy()
+    finite.set_cell([4, 4, 4])
+    periodic = finite.copy()
+    periodic.set_pbc(True)
+    systems = [finite, periodic * (1, 1, 2), periodic, finite * (2, 1, 1)]
+    systems_centers = [None, [0, 2], [[0.1, 0.2, 0.3]], centers]
+    n_threads_old = dscribe.ext.get_num_threads()
+    try:
+        dscribe.ext.set_num_threads(n_threads)
+        batch = soap.create_batch(systems, systems_centers)
+    finally:
+        dscribe.ext.set_num_threads(n_threads_old)
+    for i_batch, i_system, i_centers in zip(batch, systems, systems_centers):
+        expected = soap.create(i_system, i_centers)
+        assert np.allclose(i_batch, expected, rtol=0, atol=1e-12)
+
+
+def get_trajectory(system, n_frames, step, seed=7):
+    """Returns frames in which the atoms take random steps and are wrapped
+    back into the cell when periodic.
+    """
+    rng = np.random.default_rng(seed)
+    frames = []
+    frame = system.copy()
+    for _ in range(n_frames):
+        frame = frame.copy()
+        frame.positions += rng.normal(scale=step, size=frame.positions.shape)
+        if frame.pbc.any():
+            frame.wrap()
+        frames.append(frame)
+    return frames
+
+
+@pytest.mark.parametrize("rbf", ["gto", "polynomial"])
+@pytest.mark.parametrize("average", ["off", "outer"])
+@pytest.mark.parametrize("pbc", [False, True])
+def test_trajectory(rbf, average, pbc):
+    """Tests that reusing the Verlet list between the frames of a trajectory
+    gives the same output as creating each frame separately.
+    """
+    system, centers, args = get_soap_default_setup()
+    soap = SOAP(**args, rbf=rbf, average=average, periodic=True)
+    system = system.copy()
+    system.set_cell([4, 4, 4])
+    system.set_pbc(pbc)
+    frames = get_trajectory(system, 30, 0.05)
+    for i_centers in [None, [0, 2, [0.1, 0.2, 0.3]]]:
+        trajectory = soap.create_trajectory(frames, i_centers, skin=0.3)
+        expected = soap.create(frames, [i_centers] * len(frames))
+        assert trajectory.shape == expected.shape
+        assert np.allclose(trajectory, expected, rtol=0, atol=1e-10)
+
+
+def test_trajectory_tolerance():
+    """Tests that the output of the centers is reused when their neighbours
+    move less than the tolerance.
+    """
+    system, centers, args = get_soap_default_setup()
+    soap = SOAP(**args, periodic=True)
+    system = system.copy()
+    system.set_cell([4, 4, 4])
+    system.set_pbc(True)
+    frames = get_trajectory(system, 10, 1e-5)
+    trajectory = soap.create_trajectory(frames, tolerance=1e-2)
+    assert np.allclose(trajectory[0], soap.create(frames[0]), rtol=0, atol=1e-10)
+    for output in trajectory:
+        assert np.array_equal(output, trajectory[0])
+
+    # Large steps are calculated again
+    frames = get_trajectory(system, 10, 0.05)
+    trajectory = soap.create_trajectory(frames, tolerance=1e-6)
+    expected = soap.create(frames)
+    assert np.allclose(trajectory, expected, rtol=0, atol=1e-10)
+
+    with pytest.raises(ValueError):
+        SOAP(**args, average="inner").create_trajectory(frames, tolerance=1e-2)
+
+
+def test_trajectory_stats():
+    """Tests that the Verlet list is only rebuilt when the atoms have moved
+    more than half of the skin, and that only the centers whose neighbourhood
+    has changed are calculated again.
+    """
+    system, centers, args = get_soap_default_setup()
+    soap = SOAP(**args)
+    n_atoms = len(system)
+
+    # A rigid translation by 0.07 per frame exceeds half of the skin every
+    # third frame.
+    frames = []
+    for i_frame in range(10):
+        frame = system.copy()
+        frame.translate([0.07 * i_frame, 0, 0])
+        frames.append(frame)
+    output, stats = soap.create_trajectory(frames, skin=0.3, return_stats=True)
+    assert np.allclose(output, soap.create(frames), rtol=0, atol=1e-10)
+    assert stats["n_frames"] == 10
+    assert stats["n_rebuilds"] == 4
+    assert stats["n_computed_centers"] == 10 * n_atoms
+
+    # The neighbourhoods do not change in the translation, so the centers are
+    # only calculated when the list is rebuilt.
+    output, stats = soap.create_trajectory(
+        frames, skin=0.3, tolerance=1e-6, return_stats=True
+    )
+    assert np.allclose(output, soap.create(frames), rtol=0, atol=1e-10)
+    assert stats["n_rebuilds"] == 4
+    assert stats["n_computed_centers"] == 4 * n_atoms
+
+    # Moving one atom changes the neighbourhood of every center, without
+    # exceeding the skin.
+    moved = [f.copy() for f in frames[:3]]
+    moved[1].positions[0] += [0, 0.01, 0]
+    output, stats = soap.create_trajectory(
+        moved, skin=0.3, tolerance=1e-6, return_stats=True
+    )
+    assert np.allclose(output, soap.create(moved), rtol=0, atol=1e-10)
+    assert stats["n_rebuilds"] == 1
+    assert stats["n_computed_centers"] == 3 * n_atoms